@@ -0,0 +1,177 @@
+/*
+ * FreeRTOS Kernel V10.4.6
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Deferred binary logging.
+ *
+ * printf() formats the message and waits for the UART in the calling task,
+ * which is far too slow for interrupts, critical sections and time critical
+ * tasks.  The logPRINTFn() macros below instead store the address of the
+ * format string, a timestamp and up to four 32 bit arguments in a RAM ring
+ * buffer, which takes a few dozen cycles.  A low priority log task empties the
+ * ring every configDEFERRED_LOG_PERIOD_MS, so formatting and output happen
+ * when nothing more important needs the CPU.
+ *
+ * Space in the ring is claimed with LDREX/STREX by trace_ring.c, the ring code
+ * shared with the trace recorder, so logging never disables interrupts and can
+ * be used from any interrupt and from inside critical sections.  When the ring
+ * is full messages are dropped and counted, logging never blocks.
+ *
+ * In logMODE_TEXT the log task formats each message with snprintf() and writes
+ * one line of text per message:
+ *
+ *     [   12.345678] I: message
+ *
+ * where the time is in seconds since the cycle counter started and the letter
+ * is the level.  In logMODE_BINARY the task writes the raw records instead, so
+ * no formatting is done on the target at all.  The records are framed as
+ *
+ *     0xA5 0x5A 'L' 'G' | type | length (2 bytes) | payload | checksum
+ *
+ * like the trace recorder frames, so they can share the UART with printf()
+ * output.  Tools/logdec in the repository root reads the format strings from
+ * the .axf file of the same build and prints the messages as above.
+ *
+ * Because only the address of the format string is stored, the format must be
+ * a string literal.  The arguments are stored as 32 bit words, so the
+ * conversions that work are those of int sized values and pointers: %d %i %u
+ * %x %X %o %c %p, with the usual flags, width and precision.  A %s argument
+ * must point to a constant string that still exists when the message is
+ * formatted; in logMODE_BINARY it must be in flash so the decoder can find it.
+ * Floating point values are not supported.
+ *
+ * Set configUSE_DEFERRED_LOG to 1 in FreeRTOSConfig.h, define
+ * configDEFERRED_LOG_WRITE(), include this header where messages are logged and
+ * call vLogEnable() once before starting the scheduler.  Messages logged before
+ * that are kept until the log task runs.
+ */
+
+#ifndef DEFERRED_LOG_H
+#define DEFERRED_LOG_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include deferred_log.h"
+#endif
+
+/* Output modes for configDEFERRED_LOG_MODE. */
+#define logMODE_TEXT      0
+#define logMODE_BINARY    1
+
+/* Message levels.  The level is stored in the record and shown as E, W, I or
+ * D in the output. */
+#define logLEVEL_ERROR    1
+#define logLEVEL_WARN     2
+#define logLEVEL_INFO     3
+#define logLEVEL_DEBUG    4
+
+#ifndef configDEFERRED_LOG_MODE
+    #define configDEFERRED_LOG_MODE    logMODE_TEXT
+#endif
+
+/* Messages above this level are removed at compile time. */
+#ifndef configDEFERRED_LOG_LEVEL
+    #define configDEFERRED_LOG_LEVEL    logLEVEL_DEBUG
+#endif
+
+/* Size of the ring buffer in 32 bit words.  A message takes three words plus
+ * one per argument.  Must be a power of 2. */
+#ifndef configDEFERRED_LOG_BUFFER_WORDS
+    #define configDEFERRED_LOG_BUFFER_WORDS    256
+#endif
+
+#ifndef configDEFERRED_LOG_TASK_PRIORITY
+    #define configDEFERRED_LOG_TASK_PRIORITY    1
+#endif
+
+/* snprintf() needs more stack than most tasks. */
+#ifndef configDEFERRED_LOG_TASK_STACK_DEPTH
+    #define configDEFERRED_LOG_TASK_STACK_DEPTH    ( configMINIMAL_STACK_SIZE * 2 )
+#endif
+
+#ifndef configDEFERRED_LOG_PERIOD_MS
+    #define configDEFERRED_LOG_PERIOD_MS    20
+#endif
+
+/* Longest line logMODE_TEXT writes, including the time and level prefix.
+ * Longer messages are cut short. */
+#ifndef configDEFERRED_LOG_LINE_LENGTH
+    #define configDEFERRED_LOG_LINE_LENGTH    96
+#endif
+
+/* Frame types. */
+#define logFRAME_HEADER     ( ( uint8_t ) 'H' )
+#define logFRAME_RECORDS    ( ( uint8_t ) 'R' )
+#define logFRAME_DROPPED    ( ( uint8_t ) 'D' )
+
+/* Each record starts with a header word holding the record length in words in
+ * bits 0 to 7 and the level in bits 8 to 15, followed by the cycle counter, the
+ * address of the format string and the arguments. */
+#define logRECORD_HEADER( ulLevel, ulArgs )    ( ( uint32_t ) ( 3U + ( ulArgs ) ) | ( ( uint32_t ) ( ulLevel ) << 8 ) )
+#define logRECORD_WORDS( ulHeader )            ( ( ulHeader ) & 0xFFU )
+#define logRECORD_LEVEL( ulHeader )            ( ( ( ulHeader ) >> 8 ) & 0xFFU )
+#define logMAX_ARGS                            4U
+
+/*
+ * Log a message with 0 to 4 arguments.  ulLevel is one of logLEVEL_xxx and
+ * pcFormat a string literal in printf() syntax, without a line ending.  Safe to
+ * call from any task or interrupt, and inside critical sections.  The macros
+ * expand to nothing when configUSE_DEFERRED_LOG is 0.
+ */
+#if ( configUSE_DEFERRED_LOG == 1 )
+    #define logPRINTF0( ulLevel, pcFormat )                                                          \
+        do { if( ( ulLevel ) <= configDEFERRED_LOG_LEVEL ) vLogWrite( logRECORD_HEADER( ( ulLevel ), 0U ), ( pcFormat ), 0U, 0U, 0U, 0U ); } while( 0 )
+    #define logPRINTF1( ulLevel, pcFormat, a )                                                       \
+        do { if( ( ulLevel ) <= configDEFERRED_LOG_LEVEL ) vLogWrite( logRECORD_HEADER( ( ulLevel ), 1U ), ( pcFormat ), ( uint32_t ) ( a ), 0U, 0U, 0U ); } while( 0 )
+    #define logPRINTF2( ulLevel, pcFormat, a, b )                                                    \
+        do { if( ( ulLevel ) <= configDEFERRED_LOG_LEVEL ) vLogWrite( logRECORD_HEADER( ( ulLevel ), 2U ), ( pcFormat ), ( uint32_t ) ( a ), ( uint32_t ) ( b ), 0U, 0U ); } while( 0 )
+    #define logPRINTF3( ulLevel, pcFormat, a, b, c )                                                 \
+        do { if( ( ulLevel ) <= configDEFERRED_LOG_LEVEL ) vLogWrite( logRECORD_HEADER( ( ulLevel ), 3U ), ( pcFormat ), ( uint32_t ) ( a ), ( uint32_t ) ( b ), ( uint32_t ) ( c ), 0U ); } while( 0 )
+    #define logPRINTF4( ulLevel, pcFormat, a, b, c, d )                                              \
+        do { if( ( ulLevel ) <= configDEFERRED_LOG_LEVEL ) vLogWrite( logRECORD_HEADER( ( ulLevel ), 4U ), ( pcFormat ), ( uint32_t ) ( a ), ( uint32_t ) ( b ), ( uint32_t ) ( c ), ( uint32_t ) ( d ) ); } while( 0 )
+#else
+    #define logPRINTF0( ulLevel, pcFormat )
+    #define logPRINTF1( ulLevel, pcFormat, a )
+    #define logPRINTF2( ulLevel, pcFormat, a, b )
+    #define logPRINTF3( ulLevel, pcFormat, a, b, c )
+    #define logPRINTF4( ulLevel, pcFormat, a, b, c, d )
+#endif
+
+/* Logging API. */
+void vLogEnable( void );
+uint32_t ulLogGetDropped( void );
+
+/* Called by the logPRINTFn() macros only.  ulHeader is built with
+ * logRECORD_HEADER() and says how many of the arguments are stored. */
+void vLogWrite( uint32_t ulHeader,
+                const char * pcFormat,
+                uint32_t ulArg1,
+                uint32_t ulArg2,
+                uint32_t ulArg3,
+                uint32_t ulArg4 );
+
+#endif /* DEFERRED_LOG_H */
@@ -0,0 +1,121 @@
+/*
+ * FreeRTOS Kernel V10.4.6
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+
+/* Lock-free ring buffer and output framing - see trace_ring.h. */
+
+#include "FreeRTOS.h"
+#include "trace_ring.h"
+
+#if ( ( configUSE_TRACE_RECORDER == 1 ) || ( configUSE_DEFERRED_LOG == 1 ) )
+
+#if !defined( portLOAD_EXCLUSIVE ) || !defined( portSTORE_EXCLUSIVE ) || !defined( portCLEAR_EXCLUSIVE )
+    #error The trace recorder and the deferred log need portLOAD_EXCLUSIVE(), portSTORE_EXCLUSIVE() and portCLEAR_EXCLUSIVE() from the port
+#endif
+
+/*-----------------------------------------------------------*/
+
+uint32_t ulTraceRingAtomicAdd( volatile uint32_t * pulTarget,
+                               uint32_t ulValue )
+{
+    uint32_t ulOld;
+
+    do
+    {
+        ulOld = portLOAD_EXCLUSIVE( pulTarget );
+    } while( portSTORE_EXCLUSIVE( ulOld + ulValue, pulTarget ) != 0U );
+
+    return ulOld;
+}
+/*-----------------------------------------------------------*/
+
+int32_t lTraceRingReserve( TraceRing_t * pxRing,
+                           uint32_t ulSize,
+                           uint32_t ulSlots,
+                           BaseType_t xDropWhenFull,
+                           uint32_t * pulTimestamp )
+{
+    uint32_t ulHead;
+
+    do
+    {
+        ulHead = portLOAD_EXCLUSIVE( &( pxRing->ulHead ) );
+
+        if( ( xDropWhenFull != pdFALSE ) && ( ( ulHead + ulSlots - pxRing->ulTail ) > ulSize ) )
+        {
+            portCLEAR_EXCLUSIVE();
+            ( void ) ulTraceRingAtomicAdd( &( pxRing->ulDropped ), 1U );
+            return -1;
+        }
+
+        *pulTimestamp = DWT->CYCCNT;
+    } while( portSTORE_EXCLUSIVE( ulHead + ulSlots, &( pxRing->ulHead ) ) != 0U );
+
+    return ( int32_t ) ( ulHead & ( ulSize - 1U ) );
+}
+/*-----------------------------------------------------------*/
+
+uint16_t usTraceRingFrame( uint8_t * pucFrame,
+                           const char * pcTag,
+                           uint8_t ucType,
+                           uint16_t usLength )
+{
+    uint8_t ucSum;
+    uint16_t x;
+
+    pucFrame[ 0 ] = 0xA5U;
+    pucFrame[ 1 ] = 0x5AU;
+    pucFrame[ 2 ] = ( uint8_t ) pcTag[ 0 ];
+    pucFrame[ 3 ] = ( uint8_t ) pcTag[ 1 ];
+    pucFrame[ 4 ] = ucType;
+    pucFrame[ 5 ] = ( uint8_t ) usLength;
+    pucFrame[ 6 ] = ( uint8_t ) ( usLength >> 8 );
+
+    ucSum = 0U;
+
+    for( x = 4U; x < ( uint16_t ) ( usLength + ringFRAME_PAYLOAD ); x++ )
+    {
+        ucSum += pucFrame[ x ];
+    }
+
+    pucFrame[ usLength + ringFRAME_PAYLOAD ] = ucSum;
+
+    return ( uint16_t ) ( usLength + ringFRAME_OVERHEAD );
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRingPut32( uint8_t * pucDest,
+                      uint32_t ulValue )
+{
+    pucDest[ 0 ] = ( uint8_t ) ulValue;
+    pucDest[ 1 ] = ( uint8_t ) ( ulValue >> 8 );
+    pucDest[ 2 ] = ( uint8_t ) ( ulValue >> 16 );
+    pucDest[ 3 ] = ( uint8_t ) ( ulValue >> 24 );
+}
+
+#endif /* ( configUSE_TRACE_RECORDER == 1 ) || ( configUSE_DEFERRED_LOG == 1 ) */
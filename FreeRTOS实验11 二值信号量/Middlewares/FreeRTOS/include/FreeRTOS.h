@@ -608,6 +608,55 @@
     #define traceTIMER_COMMAND_RECEIVED( pxTimer, xMessageID, xMessageValue )
 #endif
 
+#ifndef configUSE_TRACE_RECORDER
+
+/* Set to 1 to build the binary event trace recorder in trace_recorder.c.  The
+ * trace hook macros it needs come from trace_recorder.h, which must then be
+ * included at the end of FreeRTOSConfig.h. */
+    #define configUSE_TRACE_RECORDER    0
+#endif
+
+#ifndef configUSE_HEAP_TRACKER
+
+/* Set to 1 to record the owning task, call site and time of every live heap
+ * block, and the bytes allocated by each task - see heap_track.h. */
+    #define configUSE_HEAP_TRACKER    0
+#endif
+
+#if ( configUSE_HEAP_TRACKER == 1 )
+
+/* The heap tracker in heap_track.c records allocations through the same hooks.
+ * Keep the trace recorder's heap events when both are used. */
+    void vHeapTrackMalloc( uint8_t ucHeap,
+                           void * pvAddress,
+                           size_t xSize,
+                           void * pvCaller );
+    void vHeapTrackFree( void * pvAddress );
+
+    #ifndef configHEAP_TRACK_CALLER
+
+/* The return address of the function it is used in, reported by the heap
+ * tracker as the call site of an allocation. */
+        #if defined( __CC_ARM )
+            #define configHEAP_TRACK_CALLER()    ( ( void * ) __return_address() )
+        #elif defined( __GNUC__ )
+            #define configHEAP_TRACK_CALLER()    __builtin_return_address( 0 )
+        #else
+            #define configHEAP_TRACK_CALLER()    ( ( void * ) 0 )
+        #endif
+    #endif
+
+    #if ( configUSE_TRACE_RECORDER == 1 )
+        #undef traceMALLOC
+        #undef traceFREE
+        #define traceMALLOC( pvAddress, uiSize )    do { vTraceRecordParam( trcEVT_MALLOC, 0, ( pvAddress ), ( uiSize ) ); vHeapTrackMalloc( 0U, ( pvAddress ), ( uiSize ), configHEAP_TRACK_CALLER() ); } while( 0 )
+        #define traceFREE( pvAddress, uiSize )      do { vTraceRecordParam( trcEVT_FREE, 0, ( pvAddress ), ( uiSize ) ); vHeapTrackFree( pvAddress ); } while( 0 )
+    #elif !defined( traceMALLOC )
+        #define traceMALLOC( pvAddress, uiSize )    vHeapTrackMalloc( 0U, ( pvAddress ), ( uiSize ), configHEAP_TRACK_CALLER() )
+        #define traceFREE( pvAddress, uiSize )      vHeapTrackFree( pvAddress )
+    #endif
+#endif
+
 #ifndef traceMALLOC
     #define traceMALLOC( pvAddress, uiSize )
 #endif
@@ -752,6 +801,49 @@
     #define traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xReceivedLength )
 #endif
 
+#ifndef configUSE_CPU_LOAD
+
+/* Set to 1 to build the windowed CPU load service in cpu_load.c.  Its API and
+ * remaining options are in cpu_load.h. */
+    #define configUSE_CPU_LOAD    0
+#endif
+
+#ifndef configCPU_LOAD_ISR_TIME
+
+/* Set to 1, with configUSE_CPU_LOAD, to also measure the time spent in the
+ * interrupt handlers that call traceISR_ENTER() and traceISR_EXIT(). */
+    #define configCPU_LOAD_ISR_TIME    0
+#endif
+
+#if ( ( configUSE_CPU_LOAD == 1 ) && ( configCPU_LOAD_ISR_TIME == 1 ) )
+
+/* The CPU load service in cpu_load.c times interrupts through the same hooks.
+ * Keep the trace recorder's interrupt events when both are used. */
+    void vCpuLoadISREnter( void );
+    void vCpuLoadISRExit( void );
+
+    #if ( configUSE_TRACE_RECORDER == 1 )
+        #undef traceISR_ENTER
+        #undef traceISR_EXIT
+        #define traceISR_ENTER()    do { vCpuLoadISREnter(); vTraceISREnter(); } while( 0 )
+        #define traceISR_EXIT()     do { vTraceISRExit(); vCpuLoadISRExit(); } while( 0 )
+    #elif !defined( traceISR_ENTER )
+        #define traceISR_ENTER()    vCpuLoadISREnter()
+        #define traceISR_EXIT()     vCpuLoadISRExit()
+    #endif
+#endif
+
+#ifndef traceISR_ENTER
+
+/* Called by interrupt handlers on entry and exit so interrupt activity can be
+ * traced.  The kernel does not call these itself. */
+    #define traceISR_ENTER()
+#endif
+
+#ifndef traceISR_EXIT
+    #define traceISR_EXIT()
+#endif
+
 #ifndef configGENERATE_RUN_TIME_STATS
     #define configGENERATE_RUN_TIME_STATS    0
 #endif
@@ -842,6 +934,14 @@
     #define configUSE_STATS_FORMATTING_FUNCTIONS    0
 #endif
 
+#ifndef configTASK_STATS_CHUNK_SIZE
+
+/* The number of tasks read each time the streaming stats functions, such as
+ * xTaskListStream(), suspend the scheduler.  The functions hold this many
+ * TaskStatus_t structures and task names on the calling task's stack. */
+    #define configTASK_STATS_CHUNK_SIZE    4
+#endif
+
 #ifndef portASSERT_IF_INTERRUPT_PRIORITY_INVALID
     #define portASSERT_IF_INTERRUPT_PRIORITY_INVALID()
 #endif
@@ -923,6 +1023,75 @@
     #define configMESSAGE_BUFFER_LENGTH_TYPE    size_t
 #endif
 
+#ifndef configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS
+
+/* Set to 1 to include support for message buffers that can be written by any
+ * number of tasks and interrupts at once - see
+ * xMessageBufferCreateMultiProducer().  Defaults to 0 so existing stream
+ * buffers do not grow. */
+    #define configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS    0
+#endif
+
+#ifndef configUSE_STREAM_BUFFER_MAX_LATENCY
+
+/* Set to 1 to include xStreamBufferSetMaxLatency(), which bounds how long data
+ * can wait below a stream buffer's trigger level before the reader is
+ * unblocked. */
+    #define configUSE_STREAM_BUFFER_MAX_LATENCY    0
+#endif
+
+#ifndef configUSE_DEFERRED_LOG
+
+/* Set to 1 to build the deferred logging service in deferred_log.c.  Its API
+ * and remaining options are in deferred_log.h. */
+    #define configUSE_DEFERRED_LOG    0
+#endif
+
+#ifndef configUSE_TASK_LATENCY_STATS
+
+/* Set to 1 to measure, for every task, the time from leaving the Blocked or
+ * Suspended state to running, and the period of tasks woken by a timeout.  The
+ * results are reported in the xLatencyStats member of TaskStatus_t. */
+    #define configUSE_TASK_LATENCY_STATS    0
+#endif
+
+#if ( configUSE_TASK_LATENCY_STATS == 1 )
+    #ifndef configTASK_LATENCY_TIMESTAMP
+        #error If configUSE_TASK_LATENCY_STATS is set to 1 then configTASK_LATENCY_TIMESTAMP() must be defined to read a free running 32-bit counter, such as the DWT cycle counter.
+    #endif
+
+    #ifndef configTASK_LATENCY_COUNTS_PER_US
+        #error If configUSE_TASK_LATENCY_STATS is set to 1 then configTASK_LATENCY_COUNTS_PER_US must be defined to the number of configTASK_LATENCY_TIMESTAMP() counts in one microsecond.
+    #endif
+#endif
+
+#ifndef configUSE_STACK_PROFILER
+
+/* Set to 1 to have the idle task measure, a few words at a time, how much of
+ * its stack each task has used, call vApplicationStackMarginHook() when a task
+ * comes within configSTACK_PROFILER_MARGIN_WORDS of the end of its stack, and
+ * report a recommended stack depth in TaskStatus_t. */
+    #define configUSE_STACK_PROFILER    0
+#endif
+
+#ifndef configSTACK_PROFILER_WORDS_PER_STEP
+
+/* The most stack words the stack profiler checks each time round the idle
+ * task loop, which bounds how long the scheduler is suspended for. */
+    #define configSTACK_PROFILER_WORDS_PER_STEP    32
+#endif
+
+#ifndef configSTACK_PROFILER_MARGIN_WORDS
+
+/* vApplicationStackMarginHook() is called when fewer than this many stack words
+ * have never been used. */
+    #define configSTACK_PROFILER_MARGIN_WORDS    16
+#endif
+
+#if ( configUSE_STACK_PROFILER == 1 ) && ( configUSE_TRACE_FACILITY != 1 )
+    #error configUSE_TRACE_FACILITY must be set to 1 in FreeRTOSConfig.h to use the stack profiler, which visits the tasks in task number order.
+#endif
+
 /* Sanity check the configuration. */
 #if ( configUSE_TICKLESS_IDLE != 0 )
     #if ( INCLUDE_vTaskSuspend != 1 )
@@ -1165,6 +1334,26 @@ typedef struct xSTATIC_LIST
     #endif
 } StaticList_t;
 
+#if ( configUSE_TASK_LATENCY_STATS == 1 )
+
+/* Wakeup latency statistics of one task.  Latencies and periods are in
+ * configTASK_LATENCY_TIMESTAMP() counts.  Defined here rather than in task.h
+ * because StaticTask_t below must have room for it. */
+    #define tskLATENCY_HISTOGRAM_BUCKETS    12
+
+    typedef struct xTASK_LATENCY_STATS
+    {
+        uint64_t ullTotalLatency;                                /* Sum of all the latencies, for the average. */
+        uint32_t ulWakeups;                                      /* Number of wakeups measured. */
+        uint32_t ulMinLatency;                                   /* Shortest time from leaving the Blocked or Suspended state to running. */
+        uint32_t ulMaxLatency;                                   /* Longest time from leaving the Blocked or Suspended state to running. */
+        uint32_t ulMinPeriod;                                    /* Shortest time between two runs that each followed a timed wakeup. */
+        uint32_t ulMaxPeriod;                                    /* Longest time between two runs that each followed a timed wakeup. */
+        uint32_t ulHistogram[ tskLATENCY_HISTOGRAM_BUCKETS ];    /* Bucket 0: under 1us, bucket n: 2^(n-1)us to 2^n us, the last bucket also counts everything longer. */
+    } TaskLatencyStats_t;
+
+#endif /* configUSE_TASK_LATENCY_STATS */
+
 /*
  * In line with software engineering best practice, especially when supplying a
  * library that is likely to change in future versions, FreeRTOS implements a
@@ -1209,6 +1398,15 @@ typedef struct xSTATIC_TCB
     #if ( configGENERATE_RUN_TIME_STATS == 1 )
         configRUN_TIME_COUNTER_TYPE ulDummy16;
     #endif
+    #if ( configUSE_TASK_LATENCY_STATS == 1 )
+        TaskLatencyStats_t xDummy23;
+        uint32_t ulDummy24[ 2 ];
+        uint8_t ucDummy25[ 2 ];
+    #endif
+    #if ( configUSE_STACK_PROFILER == 1 )
+        configSTACK_DEPTH_TYPE uxDummy26[ 2 ];
+        uint8_t ucDummy27;
+    #endif
     #if ( configUSE_NEWLIB_REENTRANT == 1 )
         struct  _reent xDummy17;
     #endif
@@ -1348,6 +1546,12 @@ typedef struct xSTATIC_STREAM_BUFFER
     #if ( configUSE_TRACE_FACILITY == 1 )
         UBaseType_t uxDummy4;
     #endif
+    #if ( configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS == 1 )
+        size_t uxDummy5;
+    #endif
+    #if ( configUSE_STREAM_BUFFER_MAX_LATENCY == 1 )
+        TickType_t xDummy6[ 2 ];
+    #endif
 } StaticStreamBuffer_t;
 
 /* Message buffers are built on stream buffers. */
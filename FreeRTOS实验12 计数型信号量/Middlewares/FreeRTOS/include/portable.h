@@ -90,6 +90,22 @@
     #define configSTACK_ALLOCATION_FROM_SEPARATE_HEAP    0
 #endif
 
+#ifndef configUSE_HEAP_FRAG_STATS
+    /* Set to 1 to have heap_4.c or heap_5.c keep the data returned by
+     * vPortGetHeapFragStats(). */
+    #define configUSE_HEAP_FRAG_STATS    0
+#endif
+
+#ifndef configHEAP_FRAG_SIZE_CLASSES
+    /* The number of size classes in the histograms of HeapFragStats_t. */
+    #define configHEAP_FRAG_SIZE_CLASSES    8
+#endif
+
+#ifndef configHEAP_FAILURE_LOG_LENGTH
+    /* The number of failed allocations HeapFragStats_t remembers. */
+    #define configHEAP_FAILURE_LOG_LENGTH    4
+#endif
+
 /* *INDENT-OFF* */
 #ifdef __cplusplus
     extern "C" {
@@ -150,6 +166,34 @@ typedef struct xHeapStats
     size_t xNumberOfSuccessfulFrees;        /* The number of calls to vPortFree() that has successfully freed a block of memory. */
 } HeapStats_t;
 
+/* The state of the heap when a call to pvPortMalloc() failed. */
+typedef struct xHeapFailure
+{
+    size_t xRequestedSize;                  /* The size passed to pvPortMalloc(). */
+    size_t xAvailableHeapSpaceInBytes;      /* The sum of all the free blocks. */
+    size_t xSizeOfLargestFreeBlockInBytes;  /* The largest free block, including its block header. */
+    size_t xNumberOfFreeBlocks;             /* The number of free blocks. */
+    TickType_t xTimeInTicks;                /* The tick count at the time of the failure. */
+} HeapFailure_t;
+
+/* Used to pass information about heap fragmentation out of
+ * vPortGetHeapFragStats().  Sizes are put into power of two classes: class 0
+ * holds sizes below 32 bytes, class n sizes from ( 16 << n ) to
+ * ( ( 32 << n ) - 1 ) bytes, and the last class every larger size too.  The
+ * counters cover the time since the heap was initialised or
+ * vPortResetHeapFragStats() was called. */
+typedef struct xHeapFragStats
+{
+    size_t xFreeBlocksBySize[ configHEAP_FRAG_SIZE_CLASSES ]; /* The number of free blocks in each size class, block headers included, at the time vPortGetHeapFragStats() is called. */
+    size_t xRequestsBySize[ configHEAP_FRAG_SIZE_CLASSES ];   /* The number of calls to pvPortMalloc() in each class of requested size. */
+    size_t xFailuresBySize[ configHEAP_FRAG_SIZE_CLASSES ];   /* The number of those calls that returned NULL. */
+    size_t xLargestRequest;                                   /* The largest size passed to pvPortMalloc().  Allocations of this size are at risk once it gets close to the largest free block. */
+    uint16_t usFragmentation;                                 /* The share of the free bytes outside the largest free block, in 0.01% units, at the time vPortGetHeapFragStats() is called.  0 means all the free space is in one block. */
+    uint16_t usWorstFragmentation;                            /* The highest usFragmentation seen by vPortGetHeapFragStats() or at a failed allocation. */
+    size_t xNumberOfFailures;                                 /* The number of calls to pvPortMalloc() that returned NULL. */
+    HeapFailure_t xFailures[ configHEAP_FAILURE_LOG_LENGTH ]; /* The most recent failures, oldest first.  Only the first xNumberOfFailures entries are valid if there have been fewer than configHEAP_FAILURE_LOG_LENGTH. */
+} HeapFragStats_t;
+
 /*
  * Used to define multiple heap regions for use by heap_5.c.  This function
  * must be called before any calls to pvPortMalloc() - not creating a task,
@@ -169,6 +213,23 @@ void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) PRIVILEG
  */
 void vPortGetHeapStats( HeapStats_t * pxHeapStats );
 
+#if ( configUSE_HEAP_FRAG_STATS == 1 )
+
+/*
+ * Returns a HeapFragStats_t structure filled with the free block and request
+ * size histograms, the fragmentation index and the most recent allocation
+ * failures.  Only provided by heap_4.c and heap_5.c.  Call it periodically to
+ * follow fragmentation over time.
+ */
+    void vPortGetHeapFragStats( HeapFragStats_t * pxHeapFragStats );
+
+/*
+ * Clears the request histograms, the failure log, the largest request and the
+ * worst fragmentation.
+ */
+    void vPortResetHeapFragStats( void );
+#endif
+
 /*
  * Map to the memory management routines required for the port.
  */
@@ -0,0 +1,396 @@
+/*
+ * FreeRTOS Kernel V10.4.6
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Deferred binary logging - see deferred_log.h. */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "deferred_log.h"
+#include "trace_ring.h"
+
+#if ( configUSE_DEFERRED_LOG == 1 )
+
+#if ( ( configDEFERRED_LOG_BUFFER_WORDS & ( configDEFERRED_LOG_BUFFER_WORDS - 1 ) ) != 0 )
+    #error configDEFERRED_LOG_BUFFER_WORDS must be a power of 2.
+#endif
+
+#if ( configDEFERRED_LOG_LINE_LENGTH < 48 )
+    #error configDEFERRED_LOG_LINE_LENGTH must be at least 48, the time and level prefix alone takes 18 characters.
+#endif
+
+#ifndef configDEFERRED_LOG_WRITE
+    #error configDEFERRED_LOG_WRITE( data, len ) must be defined in FreeRTOSConfig.h to use the deferred log.
+#endif
+
+#define logWORD_MASK            ( ( uint32_t ) configDEFERRED_LOG_BUFFER_WORDS - 1U )
+#define logMAX_RECORD_WORDS     ( 3U + logMAX_ARGS )
+#define logWORDS_PER_FRAME      64U
+#define logFORMAT_VERSION       1U
+#define logRESYNC_PERIOD_MS     2000U   /* Binary mode resends the header this often. */
+
+/* The DWT cycle counter provides the timestamps. */
+#define logTIMESTAMP()          ( DWT->CYCCNT )
+
+typedef struct DeferredLog
+{
+    TraceRing_t xRing;             /* Words reserved, words handed to the log task and messages lost. */
+    volatile uint32_t ulWords[ configDEFERRED_LOG_BUFFER_WORDS ];
+} DeferredLog_t;
+
+static DeferredLog_t xDeferredLog;
+
+static TaskHandle_t xLogTask = NULL;
+
+#if ( configDEFERRED_LOG_MODE == logMODE_BINARY )
+    static uint8_t ucLogFrame[ ringFRAME_OVERHEAD + ( logWORDS_PER_FRAME * sizeof( uint32_t ) ) ];
+#else
+    static char cLogLine[ configDEFERRED_LOG_LINE_LENGTH ];
+#endif
+
+/*-----------------------------------------------------------*/
+
+void vLogWrite( uint32_t ulHeader,
+                const char * pcFormat,
+                uint32_t ulArg1,
+                uint32_t ulArg2,
+                uint32_t ulArg3,
+                uint32_t ulArg4 )
+{
+    volatile uint32_t * pulWords = xDeferredLog.ulWords;
+    uint32_t ulWords = logRECORD_WORDS( ulHeader );
+    uint32_t ulTimestamp;
+    uint32_t ulIndex;
+    int32_t lSlot;
+
+    lSlot = lTraceRingReserve( &( xDeferredLog.xRing ), ( uint32_t ) configDEFERRED_LOG_BUFFER_WORDS, ulWords, pdTRUE, &ulTimestamp );
+
+    if( lSlot >= 0 )
+    {
+        ulIndex = ( uint32_t ) lSlot;
+
+        /* The words after the header are filled first.  The header is written
+         * last and commits the record, so the log task never sees a record
+         * that is only partly written. */
+        pulWords[ ( ulIndex + 1U ) & logWORD_MASK ] = ulTimestamp;
+        pulWords[ ( ulIndex + 2U ) & logWORD_MASK ] = ( uint32_t ) pcFormat;
+
+        if( ulWords > 3U )
+        {
+            pulWords[ ( ulIndex + 3U ) & logWORD_MASK ] = ulArg1;
+
+            if( ulWords > 4U )
+            {
+                pulWords[ ( ulIndex + 4U ) & logWORD_MASK ] = ulArg2;
+
+                if( ulWords > 5U )
+                {
+                    pulWords[ ( ulIndex + 5U ) & logWORD_MASK ] = ulArg3;
+
+                    if( ulWords > 6U )
+                    {
+                        pulWords[ ( ulIndex + 6U ) & logWORD_MASK ] = ulArg4;
+                    }
+                }
+            }
+        }
+
+        pulWords[ ulIndex ] = ulHeader;
+    }
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulLogGetDropped( void )
+{
+    return xDeferredLog.xRing.ulDropped;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Copy the committed record at the tail of the ring to pulRecord and free its
+ * words.  Every word is cleared before the tail moves past it, so a header
+ * slot always reads zero until its writer commits.  Returns the length of the
+ * record in words, or 0 if there is none or its writer has not finished.
+ */
+static uint32_t prvLogTake( uint32_t * pulRecord )
+{
+    volatile uint32_t * pulWords = xDeferredLog.ulWords;
+    uint32_t ulTail = xDeferredLog.xRing.ulTail;
+    uint32_t ulWords;
+    uint32_t x;
+
+    if( ulTail == xDeferredLog.xRing.ulHead )
+    {
+        return 0U;
+    }
+
+    ulWords = logRECORD_WORDS( pulWords[ ulTail & logWORD_MASK ] );
+
+    if( ulWords == 0U )
+    {
+        return 0U;
+    }
+
+    configASSERT( ( ulWords >= 3U ) && ( ulWords <= logMAX_RECORD_WORDS ) );
+
+    for( x = 0U; x < ulWords; x++ )
+    {
+        pulRecord[ x ] = pulWords[ ( ulTail + x ) & logWORD_MASK ];
+        pulWords[ ( ulTail + x ) & logWORD_MASK ] = 0U;
+    }
+
+    xDeferredLog.xRing.ulTail = ulTail + ulWords;
+
+    return ulWords;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configDEFERRED_LOG_MODE == logMODE_BINARY )
+
+/*
+ * Wrap the usLength payload bytes already at ucLogFrame[ 7 ] in a frame and
+ * write it out.
+ */
+    static void prvLogSendFrame( uint8_t ucType,
+                                 uint16_t usLength )
+    {
+        configDEFERRED_LOG_WRITE( ucLogFrame, usTraceRingFrame( ucLogFrame, "LG", ucType, usLength ) );
+    }
+/*-----------------------------------------------------------*/
+
+/*
+ * Header payload: version, maximum arguments per record, two reserved bytes
+ * and the CPU clock in Hz.
+ */
+    static void prvLogSendHeader( void )
+    {
+        uint8_t * pucPayload = &( ucLogFrame[ 7 ] );
+
+        pucPayload[ 0 ] = logFORMAT_VERSION;
+        pucPayload[ 1 ] = ( uint8_t ) logMAX_ARGS;
+        pucPayload[ 2 ] = 0U;
+        pucPayload[ 3 ] = 0U;
+        vTraceRingPut32( &( pucPayload[ 4 ] ), ( uint32_t ) configCPU_CLOCK_HZ );
+
+        prvLogSendFrame( logFRAME_HEADER, 8U );
+    }
+/*-----------------------------------------------------------*/
+
+/*
+ * Records payload: whole records as they are in the ring, little endian.
+ */
+    static void prvLogDrain( void )
+    {
+        uint32_t ulRecord[ logMAX_RECORD_WORDS ];
+        uint32_t ulWords;
+        uint16_t usCount = 0U;
+        uint32_t x;
+
+        while( ( ulWords = prvLogTake( ulRecord ) ) != 0U )
+        {
+            if( ( usCount + ulWords ) > logWORDS_PER_FRAME )
+            {
+                prvLogSendFrame( logFRAME_RECORDS, ( uint16_t ) ( usCount * sizeof( uint32_t ) ) );
+                usCount = 0U;
+            }
+
+            for( x = 0U; x < ulWords; x++ )
+            {
+                vTraceRingPut32( &( ucLogFrame[ 7U + ( usCount * sizeof( uint32_t ) ) ] ), ulRecord[ x ] );
+                usCount++;
+            }
+        }
+
+        if( usCount != 0U )
+        {
+            prvLogSendFrame( logFRAME_RECORDS, ( uint16_t ) ( usCount * sizeof( uint32_t ) ) );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+/*
+ * Dropped payload: timestamp and the messages lost since the last report.
+ */
+    static void prvLogReportDropped( uint32_t * pulReported )
+    {
+        uint32_t ulDropped = xDeferredLog.xRing.ulDropped;
+        uint8_t * pucPayload = &( ucLogFrame[ 7 ] );
+
+        if( ulDropped != *pulReported )
+        {
+            vTraceRingPut32( &( pucPayload[ 0 ] ), logTIMESTAMP() );
+            vTraceRingPut32( &( pucPayload[ 4 ] ), ulDropped - *pulReported );
+            prvLogSendFrame( logFRAME_DROPPED, 8U );
+            *pulReported = ulDropped;
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvLogTask( void * pvParameters )
+    {
+        TickType_t xLastResync;
+        uint32_t ulReported = 0U;
+
+        ( void ) pvParameters;
+
+        prvLogSendHeader();
+        xLastResync = xTaskGetTickCount();
+
+        for( ; ; )
+        {
+            /* A host that attaches late needs the header for the clock rate. */
+            if( ( xTaskGetTickCount() - xLastResync ) >= pdMS_TO_TICKS( logRESYNC_PERIOD_MS ) )
+            {
+                prvLogSendHeader();
+                xLastResync = xTaskGetTickCount();
+            }
+
+            prvLogDrain();
+            prvLogReportDropped( &ulReported );
+
+            vTaskDelay( pdMS_TO_TICKS( configDEFERRED_LOG_PERIOD_MS ) );
+        }
+    }
+
+#else /* configDEFERRED_LOG_MODE == logMODE_BINARY */
+
+/*
+ * Write the first xLength characters of cLogLine followed by a line ending.
+ * snprintf() returns the length the text would have had, so xLength is
+ * limited to what fits.
+ */
+    static void prvLogSendLine( size_t xLength )
+    {
+        if( xLength > ( sizeof( cLogLine ) - 3U ) )
+        {
+            xLength = sizeof( cLogLine ) - 3U;
+        }
+
+        cLogLine[ xLength ] = '\r';
+        cLogLine[ xLength + 1U ] = '\n';
+
+        configDEFERRED_LOG_WRITE( ( const uint8_t * ) cLogLine, ( uint16_t ) ( xLength + 2U ) );
+    }
+/*-----------------------------------------------------------*/
+
+/*
+ * Convert a cycle counter reading to microseconds since the counter started.
+ * The counter wraps within a minute, so it is extended to 64 bits here.  The
+ * log task calls this every period even when there is nothing to format, and
+ * ulTimestamp must be no older than one wrap.
+ */
+    static uint64_t prvLogMicroseconds( uint32_t ulTimestamp )
+    {
+        static uint64_t ullNow = 0U;
+        static uint32_t ulLast = 0U;
+        uint32_t ulNow = logTIMESTAMP();
+
+        ullNow += ( uint32_t ) ( ulNow - ulLast );
+        ulLast = ulNow;
+
+        return ( ullNow - ( uint32_t ) ( ulNow - ulTimestamp ) ) / ( ( uint32_t ) configCPU_CLOCK_HZ / 1000000U );
+    }
+/*-----------------------------------------------------------*/
+
+/*
+ * Write the time and level prefix of a line to cLogLine and return its length.
+ */
+    static size_t prvLogPrefix( uint32_t ulTimestamp,
+                                uint32_t ulLevel )
+    {
+        static const char cLevels[] = "?EWID";
+        uint64_t ullTime = prvLogMicroseconds( ulTimestamp );
+        int lLength;
+
+        lLength = snprintf( cLogLine, sizeof( cLogLine ), "[%5lu.%06lu] %c: ",
+                            ( unsigned long ) ( ullTime / 1000000U ), ( unsigned long ) ( ullTime % 1000000U ),
+                            cLevels[ ( ulLevel < ( sizeof( cLevels ) - 1U ) ) ? ulLevel : 0U ] );
+
+        return ( size_t ) lLength;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvLogTask( void * pvParameters )
+    {
+        uint32_t ulRecord[ logMAX_RECORD_WORDS ] = { 0U };
+        uint32_t ulReported = 0U;
+        uint32_t ulDropped;
+        size_t xLength;
+        int lMessage;
+
+        ( void ) pvParameters;
+
+        for( ; ; )
+        {
+            ( void ) prvLogMicroseconds( logTIMESTAMP() );
+
+            while( prvLogTake( ulRecord ) != 0U )
+            {
+                xLength = prvLogPrefix( ulRecord[ 1 ], logRECORD_LEVEL( ulRecord[ 0 ] ) );
+
+                /* All four argument words are passed.  Those of a shorter
+                 * record hold stale values, which printf() ignores because the
+                 * format does not use them. */
+                lMessage = snprintf( &( cLogLine[ xLength ] ), sizeof( cLogLine ) - xLength, ( const char * ) ulRecord[ 2 ],
+                                     ulRecord[ 3 ], ulRecord[ 4 ], ulRecord[ 5 ], ulRecord[ 6 ] );
+
+                prvLogSendLine( xLength + ( size_t ) ( ( lMessage > 0 ) ? lMessage : 0 ) );
+            }
+
+            ulDropped = xDeferredLog.xRing.ulDropped;
+
+            if( ulDropped != ulReported )
+            {
+                xLength = prvLogPrefix( logTIMESTAMP(), logLEVEL_WARN );
+                lMessage = snprintf( &( cLogLine[ xLength ] ), sizeof( cLogLine ) - xLength, "--- %lu log messages dropped ---",
+                                     ( unsigned long ) ( ulDropped - ulReported ) );
+                prvLogSendLine( xLength + ( size_t ) ( ( lMessage > 0 ) ? lMessage : 0 ) );
+                ulReported = ulDropped;
+            }
+
+            vTaskDelay( pdMS_TO_TICKS( configDEFERRED_LOG_PERIOD_MS ) );
+        }
+    }
+
+#endif /* configDEFERRED_LOG_MODE == logMODE_BINARY */
+/*-----------------------------------------------------------*/
+
+void vLogEnable( void )
+{
+    portENABLE_CYCLE_COUNTER();
+
+    if( xLogTask == NULL )
+    {
+        ( void ) xTaskCreate( prvLogTask, "Log", configDEFERRED_LOG_TASK_STACK_DEPTH, NULL,
+                              configDEFERRED_LOG_TASK_PRIORITY, &xLogTask );
+    }
+}
+
+#endif /* configUSE_DEFERRED_LOG == 1 */
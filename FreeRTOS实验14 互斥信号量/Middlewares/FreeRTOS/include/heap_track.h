@@ -0,0 +1,144 @@
+/*
+ * FreeRTOS Kernel V10.4.6
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Heap allocation tracker.
+ *
+ * xPortGetFreeHeapSize() shows that memory is leaking, but not who leaks it.
+ * With configUSE_HEAP_TRACKER set to 1, every block handed out by
+ * pvPortMalloc(), and by mymalloc() when MALLOC_TRACK is 1 in malloc.h, is
+ * recorded in a fixed table of configHEAP_TRACK_MAX_BLOCKS entries together
+ * with:
+ * - the task that allocated it, or none if the scheduler had not started;
+ * - the call site, the return address of pvPortMalloc() or mymalloc();
+ * - the tick count at the time of the allocation.
+ * The record is removed again when the block is freed, so the table always
+ * holds the live blocks.  xHeapTrackDump() lists the blocks older than a given
+ * age, which after a while are the leak candidates.  The call site can be
+ * looked up in the linker map file.
+ *
+ * The bytes each task currently has allocated, and the most it has ever had,
+ * are kept in a second table of configHEAP_TRACK_MAX_TASKS entries.  A block
+ * stays charged to the task that allocated it, whichever task frees it.  The
+ * entry of a deleted task is kept, with a NULL handle, until it owns no more
+ * blocks and the entry is needed for another task.
+ *
+ * Sizes are as the heap sees them, so pvPortMalloc() blocks include the heap_4
+ * block header and alignment padding.  Blocks allocated while either table is
+ * full are not recorded, and are counted in ulUntrackedBlocks instead.
+ *
+ * pvPortMalloc() and vPortFree() reach the tracker through traceMALLOC() and
+ * traceFREE(), which still feed the trace recorder if that is also enabled.
+ */
+
+#ifndef HEAP_TRACK_H
+#define HEAP_TRACK_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include heap_track.h"
+#endif
+
+#include "task.h"
+
+/* The number of live blocks that can be recorded. */
+#ifndef configHEAP_TRACK_MAX_BLOCKS
+    #define configHEAP_TRACK_MAX_BLOCKS    64
+#endif
+
+/* The number of tasks whose allocations can be counted. */
+#ifndef configHEAP_TRACK_MAX_TASKS
+    #define configHEAP_TRACK_MAX_TASKS    16
+#endif
+
+/* Values of the ucHeap argument of vHeapTrackMalloc(). */
+#define heaptrackHEAP_FREERTOS            ( ( uint8_t ) 0U )                        /* pvPortMalloc(). */
+#define heaptrackHEAP_MALLOC( memx )      ( ( uint8_t ) ( ( memx ) + 1U ) )         /* mymalloc() memory pool memx. */
+
+/* Allocations of one task. */
+typedef struct HeapTrackTask
+{
+    TaskHandle_t xHandle;                   /* NULL once the task has been deleted. */
+    size_t xCurrentBytes;                   /* Bytes of the task's blocks not yet freed. */
+    size_t xPeakBytes;                      /* Highest xCurrentBytes. */
+    uint32_t ulAllocations;                 /* Blocks allocated by the task. */
+    char cName[ configMAX_TASK_NAME_LEN ];  /* Copied at the task's first allocation. */
+} HeapTrackTask_t;
+
+/* Totals of the tracker. */
+typedef struct HeapTrackStats
+{
+    UBaseType_t uxLiveBlocks;               /* Blocks in the table. */
+    size_t xLiveBytes;                      /* Bytes of the blocks in the table. */
+    UBaseType_t uxPeakLiveBlocks;           /* Highest uxLiveBlocks, to size configHEAP_TRACK_MAX_BLOCKS. */
+    uint32_t ulUntrackedBlocks;             /* Blocks allocated while a table was full. */
+} HeapTrackStats_t;
+
+/*
+ * Records an allocation.  pvCaller is the call site to report, normally
+ * configHEAP_TRACK_CALLER() used inside the allocation function.  Called from
+ * traceMALLOC() and mymalloc(), so there is no need to call it directly unless
+ * another allocator is to be tracked.  Must not be called from an interrupt.
+ */
+void vHeapTrackMalloc( uint8_t ucHeap,
+                       void * pvAddress,
+                       size_t xSize,
+                       void * pvCaller );
+
+/*
+ * Removes the record of a block that is being freed.  Called from traceFREE()
+ * and myfree().
+ */
+void vHeapTrackFree( void * pvAddress );
+
+/*
+ * Copies the totals of the tracker to pxStats.
+ */
+void vHeapTrackGetStats( HeapTrackStats_t * pxStats );
+
+/*
+ * Copies the allocations of up to uxArraySize tasks to pxTasks.  Returns the
+ * number of entries written.
+ */
+UBaseType_t uxHeapTrackGetTasks( HeapTrackTask_t * pxTasks,
+                                 UBaseType_t uxArraySize );
+
+/*
+ * Writes every recorded block allocated at least xMinAge ticks ago to pxWrite
+ * as CSV text, starting with the header line
+ * "heap,address,size,caller,age_ms,task".  heap is "rtos" for pvPortMalloc()
+ * and "memN" for mymalloc() pool N, addresses are in hex, and task is "-" for
+ * blocks allocated before the scheduler started.  The blocks are read one at a
+ * time, so the scheduler is only suspended briefly, but blocks allocated or
+ * freed during the dump may or may not be listed.  Returns pdFAIL if pxWrite
+ * did, otherwise pdPASS.
+ */
+BaseType_t xHeapTrackDump( TickType_t xMinAge,
+                           TaskStatsWriteFunction_t pxWrite,
+                           void * pvContext );
+
+#endif /* HEAP_TRACK_H */
@@ -34,6 +34,11 @@
 #include "FreeRTOS.h"
 #include "task.h"
 
+#if ( configUSE_CRITICAL_PROFILER == 1 )
+    #include <stdio.h>
+    #include <string.h>
+#endif
+
 #ifndef configKERNEL_INTERRUPT_PRIORITY
     #define configKERNEL_INTERRUPT_PRIORITY    255
 #endif
@@ -105,6 +110,25 @@
  * have bit-0 clear, as it is loaded into the PC on exit from an ISR. */
 #define portSTART_ADDRESS_MASK                ( ( StackType_t ) 0xfffffffeUL )
 
+#if ( configUSE_CRITICAL_PROFILER == 1 )
+
+/* Number of call sites the critical section profiler keeps apart.  Sites seen
+ * after the table is full are added together in one extra entry. */
+    #ifndef configCRITICAL_PROFILER_SITES
+        #define configCRITICAL_PROFILER_SITES    16
+    #endif
+
+/* The DWT cycle counter times the masked sections. */
+    #define portDWT_CYCCNT_REG                ( *( ( volatile uint32_t * ) 0xe0001004 ) )
+    #define portCYCLES_PER_US                 ( configCPU_CLOCK_HZ / 1000000UL )
+
+    #define portCRITICAL_PROFILE_START( ulSite )    prvCriticalProfileStart( ulSite )
+    #define portCRITICAL_PROFILE_END()              prvCriticalProfileEnd()
+#else
+    #define portCRITICAL_PROFILE_START( ulSite )
+    #define portCRITICAL_PROFILE_END()
+#endif
+
 /*
  * Setup the timer to generate the tick interrupts.  The implementation in this
  * file is weak to allow application writers to change the timer used to
@@ -135,6 +159,20 @@ static void prvTaskExitError( void );
  * variable. */
 static UBaseType_t uxCriticalNesting = 0xaaaaaaaa;
 
+#if ( configUSE_CRITICAL_PROFILER == 1 )
+
+/*
+ * Start and end timing a masked section.  Both are called with interrupts
+ * masked, and only when BASEPRI moves from or to 0.
+ */
+    static void prvCriticalProfileStart( uint32_t ulSite );
+    static void prvCriticalProfileEnd( void );
+
+    static CriticalProfile_t xCriticalProfile[ configCRITICAL_PROFILER_SITES + 1 ];
+    static uint32_t ulCriticalStart = 0;
+    static uint32_t ulCriticalSite = 0; /* 0 while no masked section is being timed. */
+#endif
+
 /*
  * The number of SysTick increments that make up one tick period.
  */
@@ -340,6 +378,14 @@ BaseType_t xPortStartScheduler( void )
     /* Initialise the critical nesting count ready for the first task. */
     uxCriticalNesting = 0;
 
+    #if ( configUSE_CRITICAL_PROFILER == 1 )
+        {
+            /* Interrupts have been masked since the first task was created and
+             * are unmasked by the first task starting, which is not timed. */
+            ulCriticalSite = 0;
+        }
+    #endif
+
     /* Start the first task. */
     prvStartFirstTask();
 
@@ -358,7 +404,21 @@ void vPortEndScheduler( void )
 
 void vPortEnterCritical( void )
 {
-    portDISABLE_INTERRUPTS();
+    #if ( configUSE_CRITICAL_PROFILER == 1 )
+        {
+            /* Charge the masked time to the caller rather than to this
+             * function. */
+            if( ulPortRaiseBASEPRI() == 0 )
+            {
+                prvCriticalProfileStart( ( uint32_t ) __return_address() );
+            }
+        }
+    #else
+        {
+            portDISABLE_INTERRUPTS();
+        }
+    #endif
+
     uxCriticalNesting++;
 
     /* This is not the interrupt safe version of the enter critical function so
@@ -385,6 +445,229 @@ void vPortExitCritical( void )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_CRITICAL_PROFILER == 1 )
+
+    static void prvCriticalProfileStart( uint32_t ulSite )
+    {
+        ulCriticalStart = portDWT_CYCCNT_REG;
+        ulCriticalSite = ulSite;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvCriticalProfileEnd( void )
+    {
+        uint32_t ulCycles = portDWT_CYCCNT_REG - ulCriticalStart;
+        uint32_t ulBucket;
+        CriticalProfile_t * pxProfile = &( xCriticalProfile[ configCRITICAL_PROFILER_SITES ] );
+        UBaseType_t x;
+
+        if( ulCriticalSite == 0 )
+        {
+            /* Masked before the profiler started timing. */
+            return;
+        }
+
+        /* Sites are added in order, so the search can stop at the first free
+         * entry. */
+        for( x = 0; x < ( UBaseType_t ) configCRITICAL_PROFILER_SITES; x++ )
+        {
+            if( xCriticalProfile[ x ].ulSite == ulCriticalSite )
+            {
+                pxProfile = &( xCriticalProfile[ x ] );
+                break;
+            }
+
+            if( xCriticalProfile[ x ].ulSite == 0 )
+            {
+                pxProfile = &( xCriticalProfile[ x ] );
+                pxProfile->ulSite = ulCriticalSite;
+                break;
+            }
+        }
+
+        ulCriticalSite = 0;
+
+        pxProfile->ulCount++;
+        pxProfile->ullTotalCycles += ulCycles;
+
+        if( ulCycles > pxProfile->ulMaxCycles )
+        {
+            pxProfile->ulMaxCycles = ulCycles;
+        }
+
+        ulBucket = ulCycles / portCYCLES_PER_US;
+
+        if( ulBucket != 0 )
+        {
+            ulBucket = 32UL - ( uint32_t ) __clz( ulBucket );
+
+            if( ulBucket >= portCRITICAL_HISTOGRAM_BUCKETS )
+            {
+                ulBucket = portCRITICAL_HISTOGRAM_BUCKETS - 1;
+            }
+        }
+
+        pxProfile->ulHistogram[ ulBucket ]++;
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortProfileRaiseBASEPRI( void )
+    {
+        if( ulPortRaiseBASEPRI() == 0 )
+        {
+            prvCriticalProfileStart( ( uint32_t ) __return_address() );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    uint32_t ulPortProfileRaiseBASEPRI( void )
+    {
+        uint32_t ulOriginalBASEPRI = ulPortRaiseBASEPRI();
+
+        /* A nested call from an interrupt keeps the outer section's site. */
+        if( ulOriginalBASEPRI == 0 )
+        {
+            prvCriticalProfileStart( ( uint32_t ) __return_address() );
+        }
+
+        return ulOriginalBASEPRI;
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortProfileSetBASEPRI( uint32_t ulNewMaskValue )
+    {
+        /* Take the time while still masked so the statistics need no other
+         * protection. */
+        if( ulNewMaskValue == 0 )
+        {
+            prvCriticalProfileEnd();
+        }
+
+        vPortSetBASEPRI( ulNewMaskValue );
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortCriticalProfilerReset( void )
+    {
+        portDISABLE_INTERRUPTS();
+        {
+            portENABLE_CYCLE_COUNTER();
+
+            memset( xCriticalProfile, 0, sizeof( xCriticalProfile ) );
+            ulCriticalSite = 0;
+        }
+        portENABLE_INTERRUPTS();
+    }
+/*-----------------------------------------------------------*/
+
+/*
+ * Fill pucOrder with the indexes of the used entries of xCriticalProfile[],
+ * longest masked time first, and return how many there are.
+ */
+    static UBaseType_t prvCriticalProfileRank( uint8_t * pucOrder )
+    {
+        UBaseType_t x, y, uxUsed = 0;
+        uint8_t ucIndex;
+
+        taskENTER_CRITICAL();
+        {
+            for( x = 0; x <= ( UBaseType_t ) configCRITICAL_PROFILER_SITES; x++ )
+            {
+                if( xCriticalProfile[ x ].ulCount == 0 )
+                {
+                    continue;
+                }
+
+                ucIndex = ( uint8_t ) x;
+
+                for( y = uxUsed; ( y > 0 ) && ( xCriticalProfile[ pucOrder[ y - 1 ] ].ulMaxCycles < xCriticalProfile[ ucIndex ].ulMaxCycles ); y-- )
+                {
+                    pucOrder[ y ] = pucOrder[ y - 1 ];
+                }
+
+                pucOrder[ y ] = ucIndex;
+                uxUsed++;
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        return uxUsed;
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxPortGetCriticalProfile( CriticalProfile_t * const pxProfileArray,
+                                          const UBaseType_t uxArraySize )
+    {
+        uint8_t ucOrder[ configCRITICAL_PROFILER_SITES + 1 ];
+        UBaseType_t x, uxUsed;
+
+        uxUsed = prvCriticalProfileRank( ucOrder );
+
+        if( uxUsed > uxArraySize )
+        {
+            uxUsed = uxArraySize;
+        }
+
+        /* One entry at a time, so copying does not add a long masked section
+         * of its own. */
+        for( x = 0; x < uxUsed; x++ )
+        {
+            taskENTER_CRITICAL();
+            {
+                pxProfileArray[ x ] = xCriticalProfile[ ucOrder[ x ] ];
+            }
+            taskEXIT_CRITICAL();
+        }
+
+        return uxUsed;
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortCriticalProfilerReport( char * pcWriteBuffer,
+                                      size_t xBufferLength )
+    {
+        uint8_t ucOrder[ configCRITICAL_PROFILER_SITES + 1 ];
+        CriticalProfile_t xProfile;
+        UBaseType_t x, uxUsed;
+        uint32_t ulBucket;
+        size_t xLength;
+
+        /* One line per site, longest masked time first.  Map the site
+         * addresses to functions with the linker map file. */
+        uxUsed = prvCriticalProfileRank( ucOrder );
+        xLength = ( size_t ) snprintf( pcWriteBuffer, xBufferLength, "site       count    max(us)  avg(us)  histogram <1us,1us,2us..%uus+\r\n",
+                                       1U << ( portCRITICAL_HISTOGRAM_BUCKETS - 2 ) );
+
+        for( x = 0; ( x < uxUsed ) && ( xLength < xBufferLength ); x++ )
+        {
+            taskENTER_CRITICAL();
+            {
+                xProfile = xCriticalProfile[ ucOrder[ x ] ];
+            }
+            taskEXIT_CRITICAL();
+
+            xLength += ( size_t ) snprintf( &( pcWriteBuffer[ xLength ] ), xBufferLength - xLength, "0x%08x %-8u %-8u %-8u",
+                                            ( unsigned int ) xProfile.ulSite,
+                                            ( unsigned int ) xProfile.ulCount,
+                                            ( unsigned int ) ( xProfile.ulMaxCycles / portCYCLES_PER_US ),
+                                            ( unsigned int ) ( xProfile.ullTotalCycles / xProfile.ulCount / portCYCLES_PER_US ) );
+
+            for( ulBucket = 0; ( ulBucket < portCRITICAL_HISTOGRAM_BUCKETS ) && ( xLength < xBufferLength ); ulBucket++ )
+            {
+                xLength += ( size_t ) snprintf( &( pcWriteBuffer[ xLength ] ), xBufferLength - xLength, " %u",
+                                                ( unsigned int ) xProfile.ulHistogram[ ulBucket ] );
+            }
+
+            if( xLength < xBufferLength )
+            {
+                xLength += ( size_t ) snprintf( &( pcWriteBuffer[ xLength ] ), xBufferLength - xLength, "\r\n" );
+            }
+        }
+    }
+
+#endif /* configUSE_CRITICAL_PROFILER */
+/*-----------------------------------------------------------*/
+
 __asm void xPortPendSVHandler( void )
 {
     extern uxCriticalNesting;
@@ -432,6 +715,7 @@ void xPortSysTickHandler( void )
      * known - therefore the slightly faster vPortRaiseBASEPRI() function is used
      * in place of portSET_INTERRUPT_MASK_FROM_ISR(). */
     vPortRaiseBASEPRI();
+    portCRITICAL_PROFILE_START( ( uint32_t ) xPortSysTickHandler );
     {
         /* Increment the RTOS tick. */
         if( xTaskIncrementTick() != pdFALSE )
@@ -441,6 +725,7 @@ void xPortSysTickHandler( void )
             portNVIC_INT_CTRL_REG = portNVIC_PENDSVSET_BIT;
         }
     }
+    portCRITICAL_PROFILE_END();
 
     vPortClearBASEPRIFromISR();
 }
@@ -73,6 +73,16 @@ TaskHandle_t task3_handler;
 /*互斥信号量*/
 QueueHandle_t mutex_semaphore_handler;
 
+/*忙等nms毫秒，模拟占用CPU的耗时操作
+delay_ms在调度器运行时会调用vTaskDelay让出CPU，这里不能用*/
+static void busy_wait_ms(uint16_t nms)
+{
+    while (nms--)
+    {
+        delay_us(1000);
+    }
+}
+
 /*任务1:
 低优先级任务，同高优先级一样的操作，不同的是低优先级任务占用信号量的时间久一点*/
 void task1( void * pvParameters )
@@ -83,7 +93,7 @@ void task1( void * pvParameters )
         xSemaphoreTake(mutex_semaphore_handler, portMAX_DELAY);   /*获取信号量并死等*/
 
         printf("low_task ing\r\n");
-        delay_ms(3000);                                           /*即使正在执行 delay_ms，如果有更高优先级的任务就绪，仍会被抢占*/
+        busy_wait_ms(3000);                                        /*忙等期间如果有更高优先级的任务就绪，仍会被抢占*/
 
         printf("low_task释放信号量\r\n");
         xSemaphoreGive(mutex_semaphore_handler);                  /*释放信号量*/
@@ -114,7 +124,7 @@ void task3( void * pvParameters )
         xSemaphoreTake(mutex_semaphore_handler, portMAX_DELAY);   /*获取信号量并死等*/
 
         printf("high_task ing\r\n");
-        delay_ms(1000);
+        busy_wait_ms(1000);
 
         printf("high_task释放信号量\r\n");
         xSemaphoreGive(mutex_semaphore_handler);         /*释放信号量*/
@@ -0,0 +1,71 @@
+/**
+ ****************************************************************************************************
+ * @file        lcd_comp.h
+ * @author      正点原子团队(ALIENTEK)
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       LCD 脏矩形画布(离屏合成) 驱动代码
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 STM32F103开发板
+ * 在线视频:www.yuanzige.com
+ * 技术论坛:www.openedv.com
+ * 公司网址:www.alientek.com
+ * 购买地址:openedv.taobao.com
+ *
+ * 使用说明
+ * 1, 画布对应屏幕上的一块矩形区域, 像素缓存(RGB565)由用户提供, 大小为 width * height * 2 字节,
+ *    F103 的 SRAM 放不下整屏缓存, 一般只给需要频繁刷新的控件区域开画布.
+ * 2, lcd_comp_xxx 绘图函数只写缓存(坐标为屏幕坐标, 超出画布的部分被裁掉), 并按
+ *    LCD_COMP_TILE_SIZE 大小的方块记录脏区域.
+ * 3, lcd_comp_flush 把相邻的脏方块合并成矩形, 每个矩形只开一次窗口写到屏幕, 重叠的控件
+ *    在缓存里多次绘制也只会写屏一次, 不会闪烁.
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __LCD_COMP_H
+#define __LCD_COMP_H
+
+#include "./SYSTEM/sys/sys.h"
+
+
+/******************************************************************************************/
+/* 画布参数 定义 */
+
+#define LCD_COMP_TILE_SHIFT         4                               /* 脏方块大小 = 2^4 = 16 * 16 点 */
+#define LCD_COMP_TILE_SIZE          (1 << LCD_COMP_TILE_SHIFT)
+#define LCD_COMP_MAX_TILE_COLS      32                              /* 每行方块数上限, 即画布宽度 <= 512 */
+#define LCD_COMP_MAX_TILE_ROWS      50                              /* 方块行数上限, 即画布高度 <= 800 */
+
+/******************************************************************************************/
+
+/* 画布控制块 */
+typedef struct
+{
+    uint16_t *buf;                              /* 像素缓存, width * height 个RGB565点 */
+    uint16_t x, y;                              /* 画布左上角在屏幕上的坐标 */
+    uint16_t width, height;                     /* 画布宽度和高度 */
+    uint8_t tcols, trows;                       /* 方块列数和行数 */
+    uint32_t dirty[LCD_COMP_MAX_TILE_ROWS];     /* 脏方块位图, dirty[行] 的第 n 位对应第 n 列方块 */
+} _lcd_comp;
+
+
+uint8_t lcd_comp_init(_lcd_comp *comp, uint16_t *buf, uint16_t x, uint16_t y, uint16_t width, uint16_t height); /* 初始化画布 */
+void lcd_comp_invalidate(_lcd_comp *comp, uint16_t sx, uint16_t sy, uint16_t ex, uint16_t ey);                  /* 标记区域需要刷新 */
+void lcd_comp_flush(_lcd_comp *comp);                                                                           /* 把脏区域写到屏幕 */
+
+void lcd_comp_draw_point(_lcd_comp *comp, uint16_t x, uint16_t y, uint16_t color);                              /* 画点 */
+void lcd_comp_fill(_lcd_comp *comp, uint16_t sx, uint16_t sy, uint16_t ex, uint16_t ey, uint16_t color);        /* 纯色填充矩形 */
+void lcd_comp_color_fill(_lcd_comp *comp, uint16_t sx, uint16_t sy, uint16_t ex, uint16_t ey, uint16_t *color); /* 彩色填充矩形 */
+void lcd_comp_draw_line(_lcd_comp *comp, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color);   /* 画直线 */
+void lcd_comp_show_char(_lcd_comp *comp, uint16_t x, uint16_t y, char chr, uint8_t size, uint8_t mode, uint16_t color);     /* 显示一个字符 */
+void lcd_comp_show_string(_lcd_comp *comp, uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t size, char *p, uint16_t color);  /* 显示字符串 */
+
+#endif
@@ -71,6 +71,21 @@
 struct StreamBufferDef_t;
 typedef struct StreamBufferDef_t * StreamBufferHandle_t;
 
+/**
+ * Describes a region of a stream buffer's storage area in place, without the
+ * data being copied.  A region that wraps around the end of the storage area
+ * is described by two spans, otherwise pucSecond is NULL and xSecondLength is
+ * 0.  Used by the zero copy API functions xStreamBufferSendReserve(),
+ * xStreamBufferReceivePeek() and their message buffer equivalents.
+ */
+typedef struct xSTREAM_BUFFER_SPAN
+{
+    uint8_t * pucFirst;   /* Start of the first contiguous region. */
+    size_t xFirstLength;  /* Number of bytes in the first region. */
+    uint8_t * pucSecond;  /* Start of the storage area if the region wraps, otherwise NULL. */
+    size_t xSecondLength; /* Number of bytes in the second region, or 0. */
+} StreamBufferSpan_t;
+
 
 /**
  * stream_buffer.h
@@ -759,6 +774,51 @@ size_t xStreamBufferBytesAvailable( StreamBufferHandle_t xStreamBuffer ) PRIVILE
 BaseType_t xStreamBufferSetTriggerLevel( StreamBufferHandle_t xStreamBuffer,
                                          size_t xTriggerLevel ) PRIVILEGED_FUNCTION;
 
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * BaseType_t xStreamBufferSetMaxLatency( StreamBufferHandle_t xStreamBuffer, TickType_t xMaxLatencyTicks );
+ * @endcode
+ *
+ * Sets the longest time data can sit in a stream buffer below the stream
+ * buffer's trigger level before a task that is blocked on the stream buffer to
+ * wait for data is moved out of the blocked state.  A task blocked on a read is
+ * then unblocked when the trigger level is reached, when the oldest unread byte
+ * has been in the stream buffer for xMaxLatencyTicks ticks, or when its block
+ * time expires - whichever happens first.
+ *
+ * This allows a high trigger level to be used to batch data, so the reader
+ * runs once per batch rather than once per byte, while still bounding how
+ * long a trickle of data can be delayed.  No software timer is used - the
+ * reader simply blocks until the latency deadline.  The cost is that the first
+ * bytes written to an empty stream buffer briefly unblock a waiting reader so
+ * it can shorten its block time to the deadline.
+ *
+ * While a maximum latency is set, a read with a non zero block time waits for
+ * the trigger level or the latency deadline even if some data is already
+ * available.  A read with a block time of 0 still returns whatever data is
+ * available.
+ *
+ * configUSE_STREAM_BUFFER_MAX_LATENCY must be set to 1 in FreeRTOSConfig.h
+ * for this function to be available.
+ *
+ * @param xStreamBuffer The handle of the stream buffer being updated.
+ *
+ * @param xMaxLatencyTicks The maximum latency in ticks.  Setting 0 removes the
+ * maximum latency, restoring the normal trigger level behaviour.
+ *
+ * @return pdTRUE if the maximum latency was set.  pdFALSE if xStreamBuffer is
+ * a message buffer, as every message unblocks a message buffer's reader.
+ *
+ * \defgroup xStreamBufferSetMaxLatency xStreamBufferSetMaxLatency
+ * \ingroup StreamBufferManagement
+ */
+#if ( configUSE_STREAM_BUFFER_MAX_LATENCY == 1 )
+    BaseType_t xStreamBufferSetMaxLatency( StreamBufferHandle_t xStreamBuffer,
+                                           TickType_t xMaxLatencyTicks ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * stream_buffer.h
  *
@@ -840,7 +900,345 @@ BaseType_t xStreamBufferSendCompletedFromISR( StreamBufferHandle_t xStreamBuffer
 BaseType_t xStreamBufferReceiveCompletedFromISR( StreamBufferHandle_t xStreamBuffer,
                                                  BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferSendReserve( StreamBufferHandle_t xStreamBuffer,
+ *                                  size_t xDataLengthBytes,
+ *                                  StreamBufferSpan_t * const pxSpan,
+ *                                  TickType_t xTicksToWait );
+ * @endcode
+ *
+ * The zero copy equivalent of xStreamBufferSend().  Rather than copying data
+ * into the stream buffer, xStreamBufferSendReserve() describes where in the
+ * buffer's own storage area the next xDataLengthBytes bytes should be placed,
+ * so a DMA engine or a protocol encoder can write them there directly.  The
+ * data is not visible to the reader until xStreamBufferSendCommit() is called.
+ *
+ * The free space may wrap around the end of the storage area, in which case
+ * the reservation is described by two spans, pxSpan->pucFirst and
+ * pxSpan->pucSecond, that must be filled in that order.
+ *
+ * If the stream buffer is being used as a message buffer then either the whole
+ * message is reserved or nothing is reserved, as with xStreamBufferSend().
+ *
+ * ***NOTE***:  Reserving space counts as writing to the stream buffer, so the
+ * single writer restriction described for xStreamBufferSend() applies until
+ * the matching commit has been made.  Only one reservation can be outstanding
+ * at a time, and nothing else may be sent to the stream buffer between a
+ * reserve and its commit.
+ *
+ * @param xStreamBuffer The handle of the stream buffer in which space is being
+ * reserved.
+ *
+ * @param xDataLengthBytes The maximum number of bytes to reserve.
+ *
+ * @param pxSpan Set to describe the reserved region.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for xDataLengthBytes bytes of space to become
+ * available, exactly as for xStreamBufferSend().
+ *
+ * @return The number of bytes reserved, which is also
+ * pxSpan->xFirstLength + pxSpan->xSecondLength.
+ *
+ * Example use:
+ * @code{c}
+ * void vAFunction( StreamBufferHandle_t xStreamBuffer )
+ * {
+ * StreamBufferSpan_t xSpan;
+ * size_t xReserved;
+ *
+ *  // Ask for up to 64 bytes of space, waiting up to 10ms for it.
+ *  xReserved = xStreamBufferSendReserve( xStreamBuffer, 64, &xSpan, pdMS_TO_TICKS( 10 ) );
+ *
+ *  if( xReserved > 0 )
+ *  {
+ *      // Fill xSpan.pucFirst then xSpan.pucSecond in place, then publish the
+ *      // bytes actually written.
+ *      xStreamBufferSendCommit( xStreamBuffer, xReserved );
+ *  }
+ * }
+ * @endcode
+ * \defgroup xStreamBufferSendReserve xStreamBufferSendReserve
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferSendReserve( StreamBufferHandle_t xStreamBuffer,
+                                 size_t xDataLengthBytes,
+                                 StreamBufferSpan_t * const pxSpan,
+                                 TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferSendReserveFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                         size_t xDataLengthBytes,
+ *                                         StreamBufferSpan_t * const pxSpan );
+ * @endcode
+ *
+ * An interrupt safe version of xStreamBufferSendReserve() that never blocks.
+ *
+ * \defgroup xStreamBufferSendReserveFromISR xStreamBufferSendReserveFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferSendReserveFromISR( StreamBufferHandle_t xStreamBuffer,
+                                        size_t xDataLengthBytes,
+                                        StreamBufferSpan_t * const pxSpan ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferSendCommit( StreamBufferHandle_t xStreamBuffer,
+ *                                 size_t xDataLengthBytes );
+ * @endcode
+ *
+ * Makes the first xDataLengthBytes bytes of the region previously returned by
+ * xStreamBufferSendReserve() visible to the reader, and unblocks the reader if
+ * the trigger level has been reached.  xDataLengthBytes must not be greater
+ * than the number of bytes reserved, but can be less (for example when a DMA
+ * transfer completes early).  Committing 0 bytes abandons the reservation.
+ *
+ * If the stream buffer is being used as a message buffer then
+ * xDataLengthBytes is the length of the message that is stored.
+ *
+ * @param xStreamBuffer The handle of the stream buffer being written to.
+ *
+ * @param xDataLengthBytes The number of bytes that were written into the
+ * reserved region.
+ *
+ * @return The number of bytes committed.
+ *
+ * \defgroup xStreamBufferSendCommit xStreamBufferSendCommit
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferSendCommit( StreamBufferHandle_t xStreamBuffer,
+                                size_t xDataLengthBytes ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferSendCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                        size_t xDataLengthBytes,
+ *                                        BaseType_t * const pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * An interrupt safe version of xStreamBufferSendCommit().
+ * *pxHigherPriorityTaskWoken is set to pdTRUE if committing the data unblocked
+ * a task that has a priority above the interrupted task, exactly as for
+ * xStreamBufferSendFromISR().
+ *
+ * \defgroup xStreamBufferSendCommitFromISR xStreamBufferSendCommitFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferSendCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+                                       size_t xDataLengthBytes,
+                                       BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferReceivePeek( StreamBufferHandle_t xStreamBuffer,
+ *                                  StreamBufferSpan_t * const pxSpan,
+ *                                  TickType_t xTicksToWait );
+ * @endcode
+ *
+ * The zero copy equivalent of xStreamBufferReceive().  Describes the data
+ * waiting in the stream buffer in place, so it can be parsed or handed to a
+ * DMA engine without first being copied out.  The data stays in the buffer
+ * until xStreamBufferReceiveConsume() is called.
+ *
+ * If the stream buffer is being used as a message buffer then pxSpan describes
+ * the next message only, not including its length.
+ *
+ * ***NOTE***:  Peeking counts as reading from the stream buffer, so the single
+ * reader restriction described for xStreamBufferReceive() applies until the
+ * data has been consumed.
+ *
+ * @param xStreamBuffer The handle of the stream buffer being read.
+ *
+ * @param pxSpan Set to describe the data available to the reader.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for data to become available, exactly as for
+ * xStreamBufferReceive().
+ *
+ * @return The number of bytes described by pxSpan.
+ *
+ * \defgroup xStreamBufferReceivePeek xStreamBufferReceivePeek
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReceivePeek( StreamBufferHandle_t xStreamBuffer,
+                                 StreamBufferSpan_t * const pxSpan,
+                                 TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferReceivePeekFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                         StreamBufferSpan_t * const pxSpan );
+ * @endcode
+ *
+ * An interrupt safe version of xStreamBufferReceivePeek() that never blocks.
+ *
+ * \defgroup xStreamBufferReceivePeekFromISR xStreamBufferReceivePeekFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReceivePeekFromISR( StreamBufferHandle_t xStreamBuffer,
+                                        StreamBufferSpan_t * const pxSpan ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferReceiveConsume( StreamBufferHandle_t xStreamBuffer,
+ *                                     size_t xBytesConsumed );
+ * @endcode
+ *
+ * Removes xBytesConsumed bytes previously described by
+ * xStreamBufferReceivePeek() from the stream buffer, making the space
+ * available to the writer and unblocking the writer if it was waiting for
+ * space.  If the stream buffer is being used as a message buffer then the whole
+ * of the next message is removed and xBytesConsumed is ignored.
+ *
+ * @param xStreamBuffer The handle of the stream buffer being read.
+ *
+ * @param xBytesConsumed The number of bytes to remove from the stream buffer.
+ *
+ * @return The number of bytes removed.
+ *
+ * \defgroup xStreamBufferReceiveConsume xStreamBufferReceiveConsume
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReceiveConsume( StreamBufferHandle_t xStreamBuffer,
+                                    size_t xBytesConsumed ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferReceiveConsumeFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                            size_t xBytesConsumed,
+ *                                            BaseType_t * const pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * An interrupt safe version of xStreamBufferReceiveConsume().
+ * *pxHigherPriorityTaskWoken is set to pdTRUE if freeing the space unblocked a
+ * task that has a priority above the interrupted task.
+ *
+ * \defgroup xStreamBufferReceiveConsumeFromISR xStreamBufferReceiveConsumeFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReceiveConsumeFromISR( StreamBufferHandle_t xStreamBuffer,
+                                           size_t xBytesConsumed,
+                                           BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS == 1 )
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferMultiProducerReserve( StreamBufferHandle_t xStreamBuffer,
+ *                                           size_t xDataLengthBytes,
+ *                                           StreamBufferSpan_t * const pxSpan );
+ * @endcode
+ *
+ * Reserves space for a message of xDataLengthBytes bytes in a message buffer
+ * created with xMessageBufferCreateMultiProducer() or
+ * xMessageBufferCreateMultiProducerStatic(), and describes the space in pxSpan
+ * (as two spans if it wraps around the end of the storage area).
+ *
+ * Unlike xStreamBufferSendReserve(), any number of tasks and interrupts can
+ * hold a reservation at the same time.  The space is claimed with LDREX/STREX
+ * and never with interrupts masked - the message is then written in place and
+ * published with xStreamBufferMultiProducerCommit().  Messages are received
+ * in the order in which they were reserved, so a message is not seen by the
+ * reader until all the messages reserved before it have also been committed.
+ * Every reservation must therefore be committed, and should be committed
+ * promptly.
+ *
+ * This function never blocks, and can be called from a task or an interrupt.
+ *
+ * configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS must be set to 1 in
+ * FreeRTOSConfig.h for this function to be available.
+ *
+ * @param xStreamBuffer The handle of the multi producer message buffer.
+ *
+ * @param xDataLengthBytes The length of the message.  Must be greater than 0.
+ *
+ * @param pxSpan Set to describe the reserved space.
+ *
+ * @return xDataLengthBytes if the space was reserved, or 0 if there was not
+ * enough free space.
+ *
+ * \defgroup xStreamBufferMultiProducerReserve xStreamBufferMultiProducerReserve
+ * \ingroup StreamBufferManagement
+ */
+    size_t xStreamBufferMultiProducerReserve( StreamBufferHandle_t xStreamBuffer,
+                                              size_t xDataLengthBytes,
+                                              StreamBufferSpan_t * const pxSpan ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferMultiProducerCommit( StreamBufferHandle_t xStreamBuffer,
+ *                                          const StreamBufferSpan_t * const pxSpan );
+ * @endcode
+ *
+ * Marks the message reserved by xStreamBufferMultiProducerReserve() and
+ * described by pxSpan as complete.  The message, and any messages reserved
+ * after it that have already been committed, become visible to the reader as
+ * soon as all the messages reserved before it have been committed.  A reader
+ * that is blocked on the message buffer is unblocked if there is a complete
+ * message to read.
+ *
+ * @param xStreamBuffer The handle of the multi producer message buffer.
+ *
+ * @param pxSpan The span returned by xStreamBufferMultiProducerReserve().
+ *
+ * @return The length of the message committed.
+ *
+ * \defgroup xStreamBufferMultiProducerCommit xStreamBufferMultiProducerCommit
+ * \ingroup StreamBufferManagement
+ */
+    size_t xStreamBufferMultiProducerCommit( StreamBufferHandle_t xStreamBuffer,
+                                             const StreamBufferSpan_t * const pxSpan ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferMultiProducerCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                                 const StreamBufferSpan_t * const pxSpan,
+ *                                                 BaseType_t * const pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * An interrupt safe version of xStreamBufferMultiProducerCommit().
+ * *pxHigherPriorityTaskWoken is set to pdTRUE if the commit unblocked a reader
+ * that has a priority above the interrupted task.
+ *
+ * \defgroup xStreamBufferMultiProducerCommitFromISR xStreamBufferMultiProducerCommitFromISR
+ * \ingroup StreamBufferManagement
+ */
+    size_t xStreamBufferMultiProducerCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+                                                    const StreamBufferSpan_t * const pxSpan,
+                                                    BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS */
+
 /* Functions below here are not part of the public API. */
+
+/* Passed as the xIsMessageBuffer parameter of the create functions to create a
+ * message buffer that can be written by more than one task or interrupt. */
+#define sbTYPE_MULTI_PRODUCER_MESSAGE_BUFFER    ( ( BaseType_t ) 2 )
+
 StreamBufferHandle_t xStreamBufferGenericCreate( size_t xBufferSizeBytes,
                                                  size_t xTriggerLevelBytes,
                                                  BaseType_t xIsMessageBuffer ) PRIVILEGED_FUNCTION;
@@ -53,6 +53,10 @@
 #define MEM1_ALLOC_TABLE_SIZE   MEM1_MAX_SIZE/MEM1_BLOCK_SIZE   /* 内存表大小 */
 
 
+/* 分配跟踪, 1: mymalloc/myfree也记录到FreeRTOS的分配跟踪器(heap_track.c), 需要configUSE_HEAP_TRACKER为1 */
+#define MALLOC_TRACK            0
+
+
 
 /* 如果没有定义NULL, 定义NULL */
 #ifndef NULL
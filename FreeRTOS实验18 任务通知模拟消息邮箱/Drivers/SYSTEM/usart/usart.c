@@ -25,6 +25,20 @@
 #include "./SYSTEM/sys/sys.h"
 #include "./SYSTEM/usart/usart.h"
 
+#if USART_EN_TX_DMA || USART_EN_RX_DMA
+/* DMA收发需要用到FreeRTOS的流缓冲区和信号量 */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "timers.h"
+#include "stream_buffer.h"
+#include "string.h"
+#endif
+
+#if USART_EN_TX_DMA || (USART_EN_RX && USART_EN_RX_DMA)
+static void usart_os_init(void);
+#endif
+
 /******************************************************************************************/
 /* 加入以下代码, 支持printf函数, 而不需要选择use MicroLIB */
 
@@ -71,6 +85,316 @@ char *_sys_command_string(char *cmd, int len)
 FILE __stdout;
 
 
+#if USART_EN_TX_DMA
+
+DMA_HandleTypeDef g_dma_usart_tx;                   /* 发送DMA句柄 */
+
+static StreamBufferHandle_t g_usart_tx_sb = NULL;   /* 发送缓冲, 任务写入, DMA读出 */
+static SemaphoreHandle_t g_usart_tx_mutex = NULL;   /* 流缓冲区只允许一个写者, 多个任务printf时用它互斥 */
+static volatile uint16_t g_usart_tx_dma_len = 0;    /* DMA正在发送的字节数, 0表示DMA空闲 */
+
+static uint8_t g_usart_tx_line[USART_TX_LINE_SIZE]; /* printf行缓冲, 在临界区内读写, 不占用互斥量 */
+static uint16_t g_usart_tx_line_len = 0;            /* 行缓冲中的字节数 */
+static uint8_t g_usart_tx_chunk[USART_TX_LINE_SIZE];/* 从行缓冲取出等待写入发送缓冲区的内容, 由持有互斥量的任务使用 */
+
+/**
+ * @brief       启动DMA发送缓冲区中下一段连续的数据
+ * @note        只能在发送完成中断里或者临界区内调用, 且DMA必须空闲
+ * @param       无
+ * @retval      无
+ */
+static void usart_tx_dma_start(void)
+{
+    StreamBufferSpan_t span;
+
+    /* 数据不复制, DMA直接从流缓冲区的存储区发送. 数据回绕时先发送到存储区末尾的那一段 */
+    if (xStreamBufferReceivePeekFromISR(g_usart_tx_sb, &span) != 0)
+    {
+        g_usart_tx_dma_len = (uint16_t)span.xFirstLength;
+        HAL_UART_Transmit_DMA(&uartx_handler, span.pucFirst, (uint16_t)span.xFirstLength);
+    }
+}
+
+/**
+ * @brief       判断当前能否使用DMA发送
+ * @note        调度器没有运行, 在中断里, 或者关了中断时不能阻塞等待缓冲区, 只能直接发送.
+ *              空闲任务(包括其中的钩子函数)和定时器服务任务(包括定时器回调)也不允许阻塞, 同样直接发送
+ * @param       无
+ * @retval      1, 可以; 0, 不可以
+ */
+static uint8_t usart_tx_dma_usable(void)
+{
+    TaskHandle_t task;
+
+    if (xTaskGetSchedulerState() != taskSCHEDULER_RUNNING)
+    {
+        return 0;
+    }
+
+    if (__get_IPSR() != 0 || __get_PRIMASK() != 0 || __get_BASEPRI() != 0)
+    {
+        return 0;
+    }
+
+    task = xTaskGetCurrentTaskHandle();
+
+#if INCLUDE_xTaskGetIdleTaskHandle
+    if (task == xTaskGetIdleTaskHandle())
+    {
+        return 0;
+    }
+#endif
+
+#if configUSE_TIMERS
+    if (task == xTimerGetTimerDaemonTaskHandle())
+    {
+        return 0;
+    }
+#endif
+
+    usart_os_init();
+
+    return (g_usart_tx_sb != NULL && g_usart_tx_mutex != NULL);
+}
+
+/**
+ * @brief       把数据写入发送缓冲区, 并在DMA空闲时启动发送
+ * @note        调用前要先取得g_usart_tx_mutex. DMA在发送时, 由发送完成中断接着发
+ * @param       buf: 要发送的数据
+ * @param       len: 字节数
+ * @retval      无
+ */
+static void usart_tx_send(const uint8_t *buf, size_t len)
+{
+    size_t sent;
+
+    while (len)
+    {
+        sent = xStreamBufferSend(g_usart_tx_sb, buf, len, portMAX_DELAY);  /* 缓冲区放不下时等DMA发出一部分后再放 */
+        buf += sent;
+        len -= sent;
+
+        if (g_usart_tx_dma_len == 0)
+        {
+            taskENTER_CRITICAL();
+            if (g_usart_tx_dma_len == 0)
+            {
+                usart_tx_dma_start();
+            }
+            taskEXIT_CRITICAL();
+        }
+    }
+}
+
+/**
+ * @brief       取出行缓冲中的全部内容, 并清空行缓冲
+ * @note        任务, 中断和关中断时都可以调用
+ * @param       buf: 存放取出的内容, 大小为USART_TX_LINE_SIZE
+ * @retval      取出的字节数
+ */
+static uint16_t usart_tx_line_take(uint8_t *buf)
+{
+    UBaseType_t mask;
+    uint16_t len;
+
+    mask = taskENTER_CRITICAL_FROM_ISR();
+    len = g_usart_tx_line_len;
+    memcpy(buf, g_usart_tx_line, len);
+    g_usart_tx_line_len = 0;
+    taskEXIT_CRITICAL_FROM_ISR(mask);
+
+    return len;
+}
+
+/**
+ * @brief       把行缓冲中还没有发出的内容写入发送缓冲区
+ * @note        调用前要先取得g_usart_tx_mutex
+ * @param       无
+ * @retval      无
+ */
+static void usart_tx_line_flush(void)
+{
+    uint16_t len;
+
+    len = usart_tx_line_take(g_usart_tx_chunk); /* 先取出来, 发送时其他任务和中断可以接着往行缓冲里放 */
+
+    if (len != 0)
+    {
+        usart_tx_send(g_usart_tx_chunk, len);
+    }
+}
+
+/**
+ * @brief       用查询方式直接发出行缓冲中的内容
+ * @note        直接发送前调用, 保证先printf的内容先发出. 调用前DMA要已经发完当前这一段
+ * @param       无
+ * @retval      无
+ */
+static void usart_tx_line_direct(void)
+{
+    uint8_t line[USART_TX_LINE_SIZE];
+    uint16_t len;
+    uint16_t i;
+
+    len = usart_tx_line_take(line);
+
+    for (i = 0; i < len; i++)
+    {
+        while ((USART_UX->SR & 0X40) == 0);
+        USART_UX->DR = line[i];
+    }
+}
+
+/**
+ * @brief       查询DMA发送是否还有数据未发完
+ * @note        不包括行缓冲中还没有换行的内容
+ * @param       无
+ * @retval      1, 还有数据在发送; 0, 发送完成
+ */
+uint8_t usart_tx_busy(void)
+{
+    if (g_usart_tx_dma_len != 0)
+    {
+        return 1;
+    }
+
+    if (g_usart_tx_sb != NULL && xStreamBufferIsEmpty(g_usart_tx_sb) == pdFALSE)
+    {
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief       等待缓冲区中的数据全部发送完成
+ * @note        比如在复位或者进入停机模式前调用. 要靠DMA中断发送, 不能在关中断时调用
+ *              行缓冲中还没有换行的内容也一起发出
+ * @param       无
+ * @retval      无
+ */
+void usart_tx_flush(void)
+{
+    if (usart_tx_dma_usable())
+    {
+        xSemaphoreTake(g_usart_tx_mutex, portMAX_DELAY);
+        usart_tx_line_flush();
+        xSemaphoreGive(g_usart_tx_mutex);
+    }
+
+    while (usart_tx_busy())
+    {
+        if (usart_tx_dma_usable())
+        {
+            vTaskDelay(1);
+        }
+    }
+
+    while ((USART_UX->SR & 0X40) == 0);                 /* 等待最后一个字符移出 */
+}
+
+/* 重定义fputc函数, printf函数最终会通过调用fputc输出字符串到串口 */
+int fputc(int ch, FILE *f)
+{
+    uint8_t c = (uint8_t)ch;
+    uint8_t full;
+
+    if (usart_tx_dma_usable())
+    {
+        /* 按行发送: 字符先放入行缓冲, 遇到换行或行缓冲满时才写入发送缓冲区并启动DMA.
+         * 互斥量只在写发送缓冲区时占用, 函数返回前一定释放, 没有换行时不会挡住其他任务 */
+        taskENTER_CRITICAL();
+        g_usart_tx_line[g_usart_tx_line_len++] = c;
+        full = (g_usart_tx_line_len == USART_TX_LINE_SIZE);
+        taskEXIT_CRITICAL();
+
+        if (c == '\n' || full)
+        {
+            xSemaphoreTake(g_usart_tx_mutex, portMAX_DELAY);
+            usart_tx_line_flush();
+            xSemaphoreGive(g_usart_tx_mutex);
+        }
+
+        return ch;
+    }
+
+    /* 直接发送. 先等DMA把当前这一段发完, 避免两边同时写DR. 缓冲区中剩下的数据之后再由DMA发出 */
+    if (g_usart_tx_dma_len != 0)
+    {
+        while (USART_TX_DMA_CHANNEL->CNDTR != 0);
+    }
+
+    if (g_usart_tx_line_len != 0)
+    {
+        usart_tx_line_direct();         /* 行缓冲中还没有发出的内容在前, 先把它发出, 保持输出的顺序 */
+    }
+
+    while ((USART_UX->SR & 0X40) == 0); /* 等待上一个字符发送完成 */
+
+    USART_UX->DR = c;                   /* 将要发送的字符 ch 写入到DR寄存器 */
+    return ch;
+}
+
+/**
+ * @brief       发送一段数据
+ * @note        与printf共用发送缓冲区, 整段数据连续发出, 中间不会插入其他任务printf的内容.
+ *              可以发送二进制数据, 比如FreeRTOS追踪记录器的输出
+ * @param       buf: 要发送的数据
+ * @param       len: 字节数
+ * @retval      无
+ */
+void usart_write(const uint8_t *buf, uint16_t len)
+{
+    if (usart_tx_dma_usable() == 0)
+    {
+        while (len--)
+        {
+            fputc(*buf++, stdout);      /* 直接发送 */
+        }
+
+        return;
+    }
+
+    xSemaphoreTake(g_usart_tx_mutex, portMAX_DELAY);
+    usart_tx_line_flush();              /* 先发出printf还没有换行的内容 */
+    usart_tx_send(buf, len);
+    xSemaphoreGive(g_usart_tx_mutex);
+}
+
+/**
+ * @brief       UART发送完成回调, 此函数会被HAL_UART_IRQHandler()调用
+ * @note        释放刚发送完的缓冲区空间(唤醒等待空间的任务), 并接着发送下一段数据
+ * @param       huart:串口句柄
+ * @retval      无
+ */
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+    BaseType_t higher_priority_task_woken = pdFALSE;
+
+    if (huart->Instance == USART_UX)
+    {
+        xStreamBufferReceiveConsumeFromISR(g_usart_tx_sb, g_usart_tx_dma_len, &higher_priority_task_woken);
+        g_usart_tx_dma_len = 0;
+        usart_tx_dma_start();
+
+        portYIELD_FROM_ISR(higher_priority_task_woken);
+    }
+}
+
+/**
+ * @brief       发送DMA中断服务函数
+ * @param       无
+ * @retval      无
+ */
+void USART_TX_DMA_IRQHandler(void)
+{
+    traceISR_ENTER();
+    HAL_DMA_IRQHandler(&g_dma_usart_tx);
+    traceISR_EXIT();
+}
+
+#else
+
 /* 重定义fputc函数, printf函数最终会通过调用fputc输出字符串到串口 */
 int fputc(int ch, FILE *f)
 {
@@ -79,29 +403,309 @@ int fputc(int ch, FILE *f)
     USART_UX->DR = (uint8_t)ch;         /* 将要发送的字符 ch 写入到DR寄存器 */
     return ch;
 }
+
+/**
+ * @brief       发送一段数据
+ * @param       buf: 要发送的数据
+ * @param       len: 字节数
+ * @retval      无
+ */
+void usart_write(const uint8_t *buf, uint16_t len)
+{
+    while (len--)
+    {
+        while ((USART_UX->SR & 0X40) == 0);
+        USART_UX->DR = *buf++;
+    }
+}
+
+#endif
 #endif
 /******************************************************************************************/
 
 #if USART_EN_RX /* 如果使能了接收 */
 
-/* 接收缓冲, 最大USART_REC_LEN个字节. */
+/* 接收缓冲, 最大USART_REC_LEN个字节. DMA接收时用来拼接usart_read_line()读到的一行 */
 uint8_t g_usart_rx_buf[USART_REC_LEN];
 
 /*  接收状态
  *  bit15，      接收完成标志
  *  bit14，      接收到0x0d
  *  bit13~0，    接收到的有效字节数目
+ *  DMA接收时只表示g_usart_rx_buf中已拼好的字节数
 */
 uint16_t g_usart_rx_sta = 0;
 
 uint8_t aRxBuffer[RXBUFFERSIZE];  /* HAL库使用的串口接收缓冲 */
+
+#endif
+
 UART_HandleTypeDef uartx_handler; /* UART句柄 */
 
+#if USART_EN_RX && USART_EN_RX_DMA
+
+DMA_HandleTypeDef g_dma_usart_rx;                           /* 接收DMA句柄 */
+uint32_t g_usart_rx_lost = 0;                               /* 接收流缓冲区满而丢掉的字节数 */
+
+static uint8_t g_usart_rx_dma_buf[USART_RX_DMA_BUF_SIZE];   /* DMA循环接收缓冲区 */
+static uint16_t g_usart_rx_dma_pos = 0;                     /* DMA缓冲区中下一个要取走的位置 */
+static StreamBufferHandle_t g_usart_rx_sb = NULL;           /* 接收缓冲, DMA中断写入, 任务读出 */
+
+/* 空闲帧记录: 中断在每次总线空闲时记下这一帧结束时的累计字节数, 供usart_read_frame()使用 */
+#define USART_RX_FRAME_NUM      8
+static SemaphoreHandle_t g_usart_rx_frame_sem = NULL;       /* 计数信号量, 值为已结束但未读取的帧数 */
+static uint32_t g_usart_rx_frame_end[USART_RX_FRAME_NUM];   /* 各帧结束时的累计字节数 */
+static uint8_t g_usart_rx_frame_wr = 0;                     /* 中断写入位置 */
+static uint8_t g_usart_rx_frame_rd = 0;                     /* 任务读出位置 */
+static uint32_t g_usart_rx_total = 0;                       /* 写入流缓冲区的累计字节数 */
+static uint32_t g_usart_rx_read = 0;                        /* usart_read_frame()读走的累计字节数 */
+
 /**
- * @brief       串口X中断服务函数
+ * @brief       把DMA缓冲区中新收到的数据移到接收流缓冲区
+ * @note        在DMA半满/全满中断和串口空闲中断里调用(它们的优先级相同, 不会互相打断)
+ *              流缓冲区写入后会自动唤醒等待数据的任务
+ * @param       woken: 有更高优先级的任务被唤醒时置为pdTRUE
+ * @retval      无
+ */
+static void usart_rx_dma_update(BaseType_t *woken)
+{
+    uint16_t pos = USART_RX_DMA_BUF_SIZE - __HAL_DMA_GET_COUNTER(&g_dma_usart_rx);  /* DMA下一个要写的位置 */
+    size_t len, sent;
+
+    if (pos == USART_RX_DMA_BUF_SIZE)
+    {
+        pos = 0;
+    }
+
+    while (pos != g_usart_rx_dma_pos)
+    {
+        /* 数据回绕时分两次取, 先取到DMA缓冲区末尾 */
+        len = (pos > g_usart_rx_dma_pos) ? (pos - g_usart_rx_dma_pos) : (USART_RX_DMA_BUF_SIZE - g_usart_rx_dma_pos);
+        sent = xStreamBufferSendFromISR(g_usart_rx_sb, &g_usart_rx_dma_buf[g_usart_rx_dma_pos], len, woken);
+        g_usart_rx_lost += len - sent;
+        g_usart_rx_total += sent;
+
+        g_usart_rx_dma_pos += len;
+
+        if (g_usart_rx_dma_pos == USART_RX_DMA_BUF_SIZE)
+        {
+            g_usart_rx_dma_pos = 0;
+        }
+    }
+}
+
+/**
+ * @brief       串口空闲中断处理, 一帧数据接收结束
  * @param       无
  * @retval      无
  */
+static void usart_rx_idle(void)
+{
+    BaseType_t woken = pdFALSE;
+    uint8_t next;
+
+    usart_rx_dma_update(&woken);
+
+    /* 记录帧结束位置. 记录满了就并入上一帧 */
+    if (g_usart_rx_total != g_usart_rx_frame_end[(g_usart_rx_frame_wr + USART_RX_FRAME_NUM - 1) % USART_RX_FRAME_NUM])
+    {
+        next = (g_usart_rx_frame_wr + 1) % USART_RX_FRAME_NUM;
+
+        if (next != g_usart_rx_frame_rd)
+        {
+            g_usart_rx_frame_end[g_usart_rx_frame_wr] = g_usart_rx_total;
+            g_usart_rx_frame_wr = next;
+            xSemaphoreGiveFromISR(g_usart_rx_frame_sem, &woken);
+        }
+        else
+        {
+            g_usart_rx_frame_end[(g_usart_rx_frame_wr + USART_RX_FRAME_NUM - 1) % USART_RX_FRAME_NUM] = g_usart_rx_total;
+        }
+    }
+
+    portYIELD_FROM_ISR(woken);
+}
+
+/**
+ * @brief       启动DMA循环接收
+ * @param       无
+ * @retval      无
+ */
+static void usart_rx_dma_start(void)
+{
+    g_usart_rx_dma_pos = 0;
+    HAL_UART_Receive_DMA(&uartx_handler, g_usart_rx_dma_buf, USART_RX_DMA_BUF_SIZE);
+    __HAL_UART_ENABLE_IT(&uartx_handler, UART_IT_IDLE);     /* 开启空闲中断, 不足半个缓冲区的数据也能及时取走 */
+}
+
+/**
+ * @brief       读取收到的数据
+ * @param       buf:     数据存放地址
+ * @param       len:     最多读取的字节数
+ * @param       timeout: 没有数据时等待的时间, 单位: 系统节拍, portMAX_DELAY表示一直等待
+ * @retval      读到的字节数, 0表示超时
+ */
+uint16_t usart_read(uint8_t *buf, uint16_t len, uint32_t timeout)
+{
+    usart_os_init();
+
+    return (uint16_t)xStreamBufferReceive(g_usart_rx_sb, buf, len, timeout);
+}
+
+/**
+ * @brief       读取一行
+ * @note        以'\n'结束, 去掉'\r'和'\n', 并在末尾补'\0'. 空行被跳过
+ *              超过USART_REC_LEN个字节的行被拆成多行返回
+ *              超时时已经收到的半行保留下来, 下次调用接着拼
+ * @param       buf:     存放一行的地址
+ * @param       size:    buf的大小, 行太长时只保留前size-1个字节
+ * @param       timeout: 总的等待时间, 单位: 系统节拍, portMAX_DELAY表示一直等待
+ * @retval      这一行的长度, 0表示超时
+ */
+uint16_t usart_read_line(char *buf, uint16_t size, uint32_t timeout)
+{
+    StreamBufferSpan_t span;
+    TimeOut_t time_out;
+    TickType_t ticks_to_wait = timeout;
+    uint16_t len;
+    size_t i;
+    uint8_t ch, eol;
+
+    usart_os_init();
+    vTaskSetTimeOutState(&time_out);
+
+    while (1)
+    {
+        /* 不复制, 直接在流缓冲区里找换行符 */
+        if (xStreamBufferReceivePeek(g_usart_rx_sb, &span, ticks_to_wait) == 0)
+        {
+            return 0;
+        }
+
+        eol = 0;
+
+        for (i = 0; i < span.xFirstLength && eol == 0; i++)
+        {
+            ch = span.pucFirst[i];
+
+            if (ch == '\n')
+            {
+                eol = 1;
+            }
+            else if (ch != '\r')
+            {
+                g_usart_rx_buf[g_usart_rx_sta++] = ch;
+                eol = (g_usart_rx_sta == USART_REC_LEN);
+            }
+        }
+
+        xStreamBufferReceiveConsume(g_usart_rx_sb, i);
+
+        if (eol && g_usart_rx_sta != 0)
+        {
+            len = (g_usart_rx_sta < size) ? g_usart_rx_sta : (size - 1);
+            memcpy(buf, g_usart_rx_buf, len);
+            buf[len] = '\0';
+            g_usart_rx_sta = 0;
+            return len;
+        }
+
+        if (xTaskCheckForTimeOut(&time_out, &ticks_to_wait) != pdFALSE)
+        {
+            return 0;
+        }
+    }
+}
+
+/**
+ * @brief       读取一帧(以串口总线空闲分隔的一段数据)
+ * @note        与usart_read()/usart_read_line()不要混用, 否则帧的边界会错乱
+ * @param       buf:     数据存放地址
+ * @param       size:    buf的大小, 帧太长时多出的部分被丢弃
+ * @param       timeout: 没有帧时等待的时间, 单位: 系统节拍, portMAX_DELAY表示一直等待
+ * @retval      读到的字节数, 0表示超时
+ */
+uint16_t usart_read_frame(uint8_t *buf, uint16_t size, uint32_t timeout)
+{
+    uint32_t frame_len;
+    size_t len;
+
+    usart_os_init();
+
+    if (xSemaphoreTake(g_usart_rx_frame_sem, timeout) != pdTRUE)
+    {
+        return 0;
+    }
+
+    frame_len = g_usart_rx_frame_end[g_usart_rx_frame_rd] - g_usart_rx_read;
+    g_usart_rx_frame_rd = (g_usart_rx_frame_rd + 1) % USART_RX_FRAME_NUM;
+    g_usart_rx_read += frame_len;
+
+    len = xStreamBufferReceive(g_usart_rx_sb, buf, (frame_len < size) ? frame_len : size, 0);
+
+    if (frame_len > len)        /* 丢弃放不下的部分 */
+    {
+        xStreamBufferReceiveConsume(g_usart_rx_sb, frame_len - len);
+    }
+
+    return (uint16_t)len;
+}
+
+#endif
+
+#if USART_EN_TX_DMA || (USART_EN_RX && USART_EN_RX_DMA)
+
+static volatile uint8_t g_usart_os_ready = 0;               /* 流缓冲区和信号量已创建 */
+
+/**
+ * @brief       创建DMA收发用到的流缓冲区和信号量, 并启动DMA接收
+ * @note        在任务中第一次使用串口时调用, 不在usart_init()里创建:
+ *              调度器启动前调用FreeRTOS的API会进入临界区, 而临界区嵌套计数要等调度器启动时才清零,
+ *              退出临界区时不会恢复BASEPRI, 优先级5~15的中断会一直被屏蔽到调度器启动
+ * @param       无
+ * @retval      无
+ */
+static void usart_os_init(void)
+{
+    if (g_usart_os_ready)
+    {
+        return;
+    }
+
+    vTaskSuspendAll();                                      /* 防止两个任务同时创建 */
+
+    if (g_usart_os_ready == 0)
+    {
+#if USART_EN_TX_DMA
+        /* 触发等级设为缓冲区大小: 读者是DMA中断而不是任务, 不需要每写入一个字节就通知 */
+        g_usart_tx_sb = xStreamBufferCreate(USART_TX_BUF_SIZE, USART_TX_BUF_SIZE);
+        g_usart_tx_mutex = xSemaphoreCreateMutex();
+#if configUSE_TRACE_RECORDER
+        vTraceExcludeObject(g_usart_tx_sb);                 /* 串口发送追踪数据时产生的事件不再记录 */
+        vTraceExcludeObject(g_usart_tx_mutex);
+#endif
+#endif
+
+#if USART_EN_RX && USART_EN_RX_DMA
+        g_usart_rx_sb = xStreamBufferCreate(USART_RX_BUF_SIZE, 1);
+        g_usart_rx_frame_sem = xSemaphoreCreateCounting(USART_RX_FRAME_NUM, 0);
+        usart_rx_dma_start();                               /* DMA循环接收, 不再每个字节进一次中断 */
+#endif
+
+        g_usart_os_ready = 1;
+    }
+
+    xTaskResumeAll();
+}
+
+#endif
+
+/**
+ * @brief       串口X初始化函数
+ * @note        DMA收发用到的流缓冲区和信号量在任务中第一次使用串口时才创建, 见usart_os_init()
+ * @param       bound:波特率
+ * @retval      无
+ */
 void usart_init(uint32_t bound)
 {
     /* UART 初始化设置 */
@@ -114,10 +718,18 @@ void usart_init(uint32_t bound)
     uartx_handler.Init.Mode = UART_MODE_TX_RX;                               /* 收发模式 */
     HAL_UART_Init(&uartx_handler);                                           /* HAL_UART_Init()会使能UART1 */
 
-#if USART_EN_RX
+#if USART_EN_RX && !USART_EN_RX_DMA
     HAL_UART_Receive_IT(&uartx_handler, (uint8_t *)aRxBuffer, RXBUFFERSIZE); /* 该函数会开启接收中断：标志位UART_IT_RXNE，并且设置接收缓冲以及接收缓冲接收最大数据量 */
-    HAL_NVIC_EnableIRQ(USART_UX_IRQn);                  /* 使能USART1中断通道 */
+#endif
+
+#if USART_EN_RX || USART_EN_TX_DMA
+    /* DMA发送完成回调也要靠串口中断(TC)调用, 只发送不接收时同样要使能 */
+#if USART_EN_TX_DMA || USART_EN_RX_DMA
+    HAL_NVIC_SetPriority(USART_UX_IRQn, 6, 0);          /* 回调里要调用FreeRTOS的FromISR函数, 优先级必须在FreeRTOS可管理的范围内(5~15) */
+#else
     HAL_NVIC_SetPriority(USART_UX_IRQn, 3, 3);          /* 组2，最低优先级:抢占优先级3，子优先级3 */
+#endif
+    HAL_NVIC_EnableIRQ(USART_UX_IRQn);                  /* 使能USART1中断通道 */
 #endif
 }
 
@@ -148,15 +760,98 @@ void HAL_UART_MspInit(UART_HandleTypeDef *huart)
         gpio_initure.Pin = USART_RX_GPIO_PIN;               /* 串口RX脚 模式设置 */
         gpio_initure.Mode = GPIO_MODE_AF_INPUT;
         HAL_GPIO_Init(USART_RX_GPIO_PORT, &gpio_initure);   /* 串口RX脚 必须设置成输入模式 */
+
+#if USART_EN_TX_DMA
+        USART_TX_DMA_CLK_ENABLE();                          /* 使能DMA时钟 */
+
+        g_dma_usart_tx.Instance = USART_TX_DMA_CHANNEL;                     /* USART_TX 对应的DMA通道 */
+        g_dma_usart_tx.Init.Direction = DMA_MEMORY_TO_PERIPH;               /* 存储器到外设 */
+        g_dma_usart_tx.Init.PeriphInc = DMA_PINC_DISABLE;                   /* 外设地址不增加 */
+        g_dma_usart_tx.Init.MemInc = DMA_MINC_ENABLE;                       /* 存储器地址增加 */
+        g_dma_usart_tx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;      /* 外设数据宽度: 8位 */
+        g_dma_usart_tx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;         /* 存储器数据宽度: 8位 */
+        g_dma_usart_tx.Init.Mode = DMA_NORMAL;                              /* 普通模式, 每一段数据单独启动 */
+        g_dma_usart_tx.Init.Priority = DMA_PRIORITY_MEDIUM;                 /* 中等优先级 */
+        HAL_DMA_Init(&g_dma_usart_tx);
+
+        __HAL_LINKDMA(huart, hdmatx, g_dma_usart_tx);       /* 将DMA与USART联系起来(发送DMA) */
+
+        HAL_NVIC_SetPriority(USART_TX_DMA_IRQn, 6, 0);      /* 与串口中断同一优先级, 两者不会互相打断 */
+        HAL_NVIC_EnableIRQ(USART_TX_DMA_IRQn);
+#endif
+
+#if USART_EN_RX && USART_EN_RX_DMA
+        USART_RX_DMA_CLK_ENABLE();                          /* 使能DMA时钟 */
+
+        g_dma_usart_rx.Instance = USART_RX_DMA_CHANNEL;                     /* USART_RX 对应的DMA通道 */
+        g_dma_usart_rx.Init.Direction = DMA_PERIPH_TO_MEMORY;               /* 外设到存储器 */
+        g_dma_usart_rx.Init.PeriphInc = DMA_PINC_DISABLE;                   /* 外设地址不增加 */
+        g_dma_usart_rx.Init.MemInc = DMA_MINC_ENABLE;                       /* 存储器地址增加 */
+        g_dma_usart_rx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;      /* 外设数据宽度: 8位 */
+        g_dma_usart_rx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;         /* 存储器数据宽度: 8位 */
+        g_dma_usart_rx.Init.Mode = DMA_CIRCULAR;                            /* 循环模式, 一直接收 */
+        g_dma_usart_rx.Init.Priority = DMA_PRIORITY_HIGH;                   /* 高优先级, 接收不能丢数据 */
+        HAL_DMA_Init(&g_dma_usart_rx);
+
+        __HAL_LINKDMA(huart, hdmarx, g_dma_usart_rx);       /* 将DMA与USART联系起来(接收DMA) */
+
+        HAL_NVIC_SetPriority(USART_RX_DMA_IRQn, 6, 0);      /* 与串口中断同一优先级, 两者不会互相打断 */
+        HAL_NVIC_EnableIRQ(USART_RX_DMA_IRQn);
+#endif
     }
 }
 
+#if USART_EN_RX
+
 /**
  * @brief       UART数据接收回调接口
                 数据处理在这里进行
  * @param       huart:串口句柄
  * @retval      无
  */
+#if USART_EN_RX_DMA
+
+void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
+{
+    BaseType_t woken = pdFALSE;
+
+    if (huart->Instance == USART_UX)                    /* DMA缓冲区后半部分满 */
+    {
+        usart_rx_dma_update(&woken);
+        portYIELD_FROM_ISR(woken);
+    }
+}
+
+/**
+ * @brief       UART数据接收过半回调, DMA缓冲区前半部分满
+ * @param       huart:串口句柄
+ * @retval      无
+ */
+void HAL_UART_RxHalfCpltCallback(UART_HandleTypeDef *huart)
+{
+    BaseType_t woken = pdFALSE;
+
+    if (huart->Instance == USART_UX)
+    {
+        usart_rx_dma_update(&woken);
+        portYIELD_FROM_ISR(woken);
+    }
+}
+
+/**
+ * @brief       接收DMA中断服务函数
+ * @param       无
+ * @retval      无
+ */
+void USART_RX_DMA_IRQHandler(void)
+{
+    traceISR_ENTER();
+    HAL_DMA_IRQHandler(&g_dma_usart_rx);
+    traceISR_EXIT();
+}
+
+#else
+
 void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
 {
     if (huart->Instance == USART_UX)                    /* 如果是串口1 */
@@ -197,6 +892,11 @@ void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
     }
 }
 
+#endif
+#endif
+
+#if USART_EN_RX || USART_EN_TX_DMA
+
 /**
  * @brief       串口X中断服务函数
                 注意,读取USARTx->SR能避免莫名其妙的错误
@@ -205,10 +905,63 @@ void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
  */
 void USART_UX_IRQHandler(void)
 {
+#if USART_EN_TX_DMA || USART_EN_RX_DMA
+    traceISR_ENTER();
+#endif
+
+#if USART_EN_RX && USART_EN_RX_DMA
+    if (__HAL_UART_GET_FLAG(&uartx_handler, UART_FLAG_IDLE) != RESET)  /* 总线空闲, 一帧结束 */
+    {
+        __HAL_UART_CLEAR_IDLEFLAG(&uartx_handler);                      /* 读SR再读DR清除 */
+        usart_rx_idle();
+    }
+#endif
+
     HAL_UART_IRQHandler(&uartx_handler);                                /* 调用HAL库中断处理公用函数 */
+
+#if USART_EN_TX_DMA || USART_EN_RX_DMA
+    traceISR_EXIT();
+#endif
 }
 #endif
 
+#if USART_EN_TX_DMA || USART_EN_RX_DMA
+
+/**
+ * @brief       UART错误回调
+ * @note        DMA发送出错时HAL库会终止发送, 这里丢弃出错的这一段, 继续发送后面的数据
+ *              DMA接收时出现噪声/帧错误/溢出, HAL库会停止接收, 这里重新启动
+ * @param       huart:串口句柄
+ * @retval      无
+ */
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+    if (huart->Instance != USART_UX)
+    {
+        return;
+    }
+
+#if USART_EN_TX_DMA
+    if (g_usart_tx_dma_len != 0 && huart->gState == HAL_UART_STATE_READY)
+    {
+        HAL_UART_TxCpltCallback(huart);
+    }
+#endif
+
+#if USART_EN_RX && USART_EN_RX_DMA
+    if (g_usart_rx_sb != NULL && huart->RxState == HAL_UART_STATE_READY)    /* 接收还没启动时不处理 */
+    {
+        BaseType_t woken = pdFALSE;
+
+        usart_rx_dma_update(&woken);    /* 先取走停止前收到的数据 */
+        usart_rx_dma_start();
+        portYIELD_FROM_ISR(woken);
+    }
+#endif
+}
+
+#endif
+
 
 
 
@@ -101,16 +101,72 @@
     #define portYIELD_FROM_ISR( x )                     portEND_SWITCHING_ISR( x )
 /*-----------------------------------------------------------*/
 
+/* The DWT cycle counter timestamps the trace recorder, the deferred log, the
+ * CPU load interrupt time and the critical section profiler.  delay_init()
+ * starts it too, but those services must not depend on it, so each starts it
+ * again with portENABLE_CYCLE_COUNTER(). */
+    #define portDEMCR_REG                 ( *( ( volatile uint32_t * ) 0xe000edfc ) )
+    #define portDWT_CTRL_REG              ( *( ( volatile uint32_t * ) 0xe0001000 ) )
+    #define portDEMCR_TRCENA_BIT          ( 1UL << 24UL )
+    #define portDWT_CYCCNTENA_BIT         ( 1UL << 0UL )
+    #define portENABLE_CYCLE_COUNTER()    do { portDEMCR_REG |= portDEMCR_TRCENA_BIT; portDWT_CTRL_REG |= portDWT_CYCCNTENA_BIT; } while( 0 )
+/*-----------------------------------------------------------*/
+
 /* Critical section management. */
     extern void vPortEnterCritical( void );
     extern void vPortExitCritical( void );
 
-    #define portDISABLE_INTERRUPTS()                  vPortRaiseBASEPRI()
-    #define portENABLE_INTERRUPTS()                   vPortSetBASEPRI( 0 )
+/* Set configUSE_CRITICAL_PROFILER to 1 to measure, with the DWT cycle counter,
+ * how long interrupts stay masked by BASEPRI.  Every raise and restore then goes
+ * through port.c, which keeps the longest time and a histogram of times for
+ * each place that masked interrupts.  Masking with PRIMASK (__disable_irq())
+ * and the short mask inside the PendSV handler are not measured. */
+    #ifndef configUSE_CRITICAL_PROFILER
+        #define configUSE_CRITICAL_PROFILER    0
+    #endif
+
+    #if ( configUSE_CRITICAL_PROFILER == 1 )
+        extern void vPortProfileRaiseBASEPRI( void );
+        extern uint32_t ulPortProfileRaiseBASEPRI( void );
+        extern void vPortProfileSetBASEPRI( uint32_t ulNewMaskValue );
+
+        #define portDISABLE_INTERRUPTS()                  vPortProfileRaiseBASEPRI()
+        #define portENABLE_INTERRUPTS()                   vPortProfileSetBASEPRI( 0 )
+        #define portSET_INTERRUPT_MASK_FROM_ISR()         ulPortProfileRaiseBASEPRI()
+        #define portCLEAR_INTERRUPT_MASK_FROM_ISR( x )    vPortProfileSetBASEPRI( x )
+    #else
+        #define portDISABLE_INTERRUPTS()                  vPortRaiseBASEPRI()
+        #define portENABLE_INTERRUPTS()                   vPortSetBASEPRI( 0 )
+        #define portSET_INTERRUPT_MASK_FROM_ISR()         ulPortRaiseBASEPRI()
+        #define portCLEAR_INTERRUPT_MASK_FROM_ISR( x )    vPortSetBASEPRI( x )
+    #endif
+
     #define portENTER_CRITICAL()                      vPortEnterCritical()
     #define portEXIT_CRITICAL()                       vPortExitCritical()
-    #define portSET_INTERRUPT_MASK_FROM_ISR()         ulPortRaiseBASEPRI()
-    #define portCLEAR_INTERRUPT_MASK_FROM_ISR( x )    vPortSetBASEPRI( x )
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_CRITICAL_PROFILER == 1 )
+
+/* Histogram buckets of masked time: bucket 0 counts times under 1us, bucket n
+ * counts times from 2^(n-1)us up to 2^n us, and the last bucket also counts
+ * everything longer. */
+        #define portCRITICAL_HISTOGRAM_BUCKETS    12
+
+        typedef struct xCRITICAL_PROFILE
+        {
+            uint32_t ulSite;                                            /* Return address of the call that masked interrupts, 0 for the sites that did not fit in the table. */
+            uint32_t ulCount;                                           /* Times interrupts were masked from this site. */
+            uint32_t ulMaxCycles;                                       /* Longest masked time, in CPU cycles. */
+            uint64_t ullTotalCycles;                                    /* Sum of the masked times, in CPU cycles. */
+            uint32_t ulHistogram[ portCRITICAL_HISTOGRAM_BUCKETS ];
+        } CriticalProfile_t;
+
+        void vPortCriticalProfilerReset( void );
+        UBaseType_t uxPortGetCriticalProfile( CriticalProfile_t * const pxProfileArray,
+                                              const UBaseType_t uxArraySize );
+        void vPortCriticalProfilerReport( char * pcWriteBuffer,
+                                          size_t xBufferLength );
+    #endif
 
 /*-----------------------------------------------------------*/
 
@@ -144,6 +200,22 @@
     #endif /* taskRECORD_READY_PRIORITY */
 /*-----------------------------------------------------------*/
 
+/* Exclusive load and store of a 32 bit word, for the lock-free code that must
+ * not mask interrupts (multi-producer message buffers, the trace recorder and
+ * the deferred log).  portSTORE_EXCLUSIVE() returns 0 if the store was done, or
+ * 1 if the word may have been written since portLOAD_EXCLUSIVE(), in which case
+ * the caller starts again.  armcc 5.06 reports the intrinsics as deprecated,
+ * the warning is suppressed the same way CMSIS does. */
+    #if ( __ARMCC_VERSION < 5060020 )
+        #define portLOAD_EXCLUSIVE( pulAddress )              ( ( uint32_t ) __ldrex( pulAddress ) )
+        #define portSTORE_EXCLUSIVE( ulValue, pulAddress )    ( ( uint32_t ) __strex( ( ulValue ), ( pulAddress ) ) )
+    #else
+        #define portLOAD_EXCLUSIVE( pulAddress )              _Pragma( "push" ) _Pragma( "diag_suppress 3731" ) ( ( uint32_t ) __ldrex( pulAddress ) ) _Pragma( "pop" )
+        #define portSTORE_EXCLUSIVE( ulValue, pulAddress )    _Pragma( "push" ) _Pragma( "diag_suppress 3731" ) ( ( uint32_t ) __strex( ( ulValue ), ( pulAddress ) ) ) _Pragma( "pop" )
+    #endif
+    #define portCLEAR_EXCLUSIVE()                             __clrex()
+/*-----------------------------------------------------------*/
+
 /* Task function macros as described on the FreeRTOS.org WEB site.  These are
  * not necessary for to use this port.  They are defined so the common demo files
  * (which build with all the ports) will build. */
@@ -24,6 +24,15 @@
 
 #include "./MALLOC/malloc.h"
 
+#if MALLOC_TRACK
+#include "FreeRTOS.h"
+#include "heap_track.h"
+
+#if !configUSE_HEAP_TRACKER
+#error "MALLOC_TRACK需要在FreeRTOSConfig.h中将configUSE_HEAP_TRACKER设为1"
+#endif
+#endif
+
 
 /* 内存池(64字节对齐) */
 static __ALIGNED(64) uint8_t mem1base[MEM1_MAX_SIZE];                                     /* 内部SRAM内存池 */
@@ -211,6 +220,10 @@ void myfree(uint8_t memx, void *ptr)
 
     if (ptr == NULL)return;     /* 地址为0. */
 
+#if MALLOC_TRACK
+    vHeapTrackFree(ptr);        /* 删除分配记录 */
+#endif
+
     offset = (uint32_t)ptr - (uint32_t)mallco_dev.membase[memx];
     my_mem_free(memx, offset);  /* 释放内存 */
 }
@@ -232,6 +245,9 @@ void *mymalloc(uint8_t memx, uint32_t size)
     }
     else    /* 申请没问题, 返回首地址 */
     {
+#if MALLOC_TRACK
+        vHeapTrackMalloc(heaptrackHEAP_MALLOC(memx), (void *)((uint32_t)mallco_dev.membase[memx] + offset), size, configHEAP_TRACK_CALLER());  /* 记录调用位置和所属任务 */
+#endif
         return (void *)((uint32_t)mallco_dev.membase[memx] + offset);
     }
 }
@@ -254,6 +270,9 @@ void *myrealloc(uint8_t memx, void *ptr, uint32_t size)
     }
     else    /* 申请没问题, 返回首地址 */
     {
+#if MALLOC_TRACK
+        vHeapTrackMalloc(heaptrackHEAP_MALLOC(memx), (void *)((uint32_t)mallco_dev.membase[memx] + offset), size, configHEAP_TRACK_CALLER());
+#endif
         my_mem_copy((void *)((uint32_t)mallco_dev.membase[memx] + offset), ptr, size); /* 拷贝旧内存内容到新内存 */
         myfree(memx, ptr);  /* 释放旧内存 */
         return (void *)((uint32_t)mallco_dev.membase[memx] + offset);   /* 返回新内存首地址 */
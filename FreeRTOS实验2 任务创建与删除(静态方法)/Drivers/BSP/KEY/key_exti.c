@@ -0,0 +1,261 @@
+/**
+ ****************************************************************************************************
+ * @file        key_exti.c
+ * @author      正点原子团队(ALIENTEK)
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       按键输入(外部中断 + 事件队列) 驱动代码
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 STM32F103开发板
+ * 在线视频:www.yuanzige.com
+ * 技术论坛:www.openedv.com
+ * 公司网址:www.alientek.com
+ * 购买地址:openedv.taobao.com
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#include "./BSP/KEY/key_exti.h"
+
+#if KEY_EN_EXTI
+
+#include "FreeRTOS.h"
+#include "queue.h"
+#include "timers.h"
+
+
+#define KEY_EXTI_NUM        3                                       /* 按键个数 */
+#define KEY_EXTI_PINS       (KEY0_GPIO_PIN | KEY1_GPIO_PIN | WKUP_GPIO_PIN) /* 所有按键的中断线 */
+
+/* 按键引脚 */
+typedef struct
+{
+    GPIO_TypeDef *port;
+    uint16_t pin;
+    GPIO_PinState level;            /* 按下时的电平 */
+    uint32_t pull;                  /* 上拉/下拉 */
+    IRQn_Type irq;                  /* 中断号 */
+    uint8_t key;                    /* 键值 */
+} _key_pin;
+
+static const _key_pin g_key_pin[KEY_EXTI_NUM] =
+{
+    {KEY0_GPIO_PORT, KEY0_GPIO_PIN, GPIO_PIN_RESET, GPIO_PULLUP,   EXTI9_5_IRQn,   KEY0_PRES},
+    {KEY1_GPIO_PORT, KEY1_GPIO_PIN, GPIO_PIN_RESET, GPIO_PULLUP,   EXTI15_10_IRQn, KEY1_PRES},
+    {WKUP_GPIO_PORT, WKUP_GPIO_PIN, GPIO_PIN_SET,   GPIO_PULLDOWN, EXTI0_IRQn,     WKUP_PRES},
+};
+
+/* 按键状态, 时间单位为 KEY_EXTI_SCAN_MS */
+typedef struct
+{
+    uint8_t down;                   /* 确认后的状态, 1: 按下 */
+    uint8_t cnt;                    /* 引脚电平与确认状态不同的次数 */
+    uint16_t hold;                  /* 按下的时间 */
+} _key_state;
+
+static _key_state g_key_state[KEY_EXTI_NUM];
+static QueueHandle_t g_key_queue = NULL;
+static TimerHandle_t g_key_timer = NULL;
+
+#define KEY_EXTI_TICKS(ms)  (((ms) + KEY_EXTI_SCAN_MS - 1) / KEY_EXTI_SCAN_MS)
+
+/**
+ * @brief       发送按键事件, 在软件定时器任务中调用, 不能阻塞
+ * @param       key     : 键值
+ * @param       type    : 事件类型, KEY_EVT_xxx
+ * @retval      无
+ */
+static void key_exti_post(uint8_t key, uint8_t type)
+{
+    _key_event evt;
+
+    evt.key = key;
+    evt.type = type;
+    xQueueSend(g_key_queue, &evt, 0);   /* 队列满时丢弃 */
+}
+
+/**
+ * @brief       消抖定时器回调, 每 KEY_EXTI_SCAN_MS 采样一次所有按键
+ * @param       timer   : 定时器句柄
+ * @retval      无
+ */
+static void key_exti_timer_cb(TimerHandle_t timer)
+{
+    uint8_t i;
+    uint8_t busy = 0;
+    uint8_t raw;
+    _key_state *s;
+
+    for (i = 0; i < KEY_EXTI_NUM; i++)
+    {
+        s = &g_key_state[i];
+        raw = (HAL_GPIO_ReadPin(g_key_pin[i].port, g_key_pin[i].pin) == g_key_pin[i].level);
+
+        if (raw != s->down)
+        {
+            if (++s->cnt >= KEY_EXTI_TICKS(KEY_EXTI_DEBOUNCE_MS))   /* 电平保持足够久, 确认状态变化 */
+            {
+                s->down = raw;
+                s->cnt = 0;
+                s->hold = 0;
+                key_exti_post(g_key_pin[i].key, raw ? KEY_EVT_PRESS : KEY_EVT_RELEASE);
+            }
+        }
+        else
+        {
+            s->cnt = 0;                     /* 抖动, 重新计数 */
+        }
+
+        if (s->down)
+        {
+            if (s->hold < 0xFFFF) s->hold++;    /* 不连发时停在最大值, 防止溢出后再次产生长按事件 */
+
+            if (s->hold == KEY_EXTI_TICKS(KEY_EXTI_LONG_MS))
+            {
+                key_exti_post(g_key_pin[i].key, KEY_EVT_LONG);
+            }
+#if KEY_EXTI_REPEAT_MS
+            else if (s->hold == KEY_EXTI_TICKS(KEY_EXTI_LONG_MS) + KEY_EXTI_TICKS(KEY_EXTI_REPEAT_MS))
+            {
+                s->hold = KEY_EXTI_TICKS(KEY_EXTI_LONG_MS);
+                key_exti_post(g_key_pin[i].key, KEY_EVT_REPEAT);
+            }
+#endif
+        }
+
+        busy |= s->down | s->cnt;
+    }
+
+    if (busy == 0)
+    {
+        /* 先停定时器再打开中断线, 之后的边沿中断发出的启动命令排在停止命令后面, 不会丢失 */
+        xTimerStop(timer, 0);
+        __HAL_GPIO_EXTI_CLEAR_IT(KEY_EXTI_PINS);
+        EXTI->IMR |= KEY_EXTI_PINS;
+
+        for (i = 0; i < KEY_EXTI_NUM; i++)  /* 打开中断线之前按下的按键没有边沿中断, 这里补上 */
+        {
+            if (HAL_GPIO_ReadPin(g_key_pin[i].port, g_key_pin[i].pin) == g_key_pin[i].level)
+            {
+                EXTI->IMR &= ~KEY_EXTI_PINS;
+                xTimerStart(timer, 0);
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief       按键边沿中断处理, 屏蔽中断线并启动消抖定时器
+ * @param       pin     : 中断线
+ * @retval      无
+ */
+static void key_exti_irq(uint16_t pin)
+{
+    BaseType_t woken = pdFALSE;
+
+    if (__HAL_GPIO_EXTI_GET_IT(pin) != 0)
+    {
+        __HAL_GPIO_EXTI_CLEAR_IT(pin);
+        EXTI->IMR &= ~(uint32_t)pin;        /* 抖动期间不再进中断, 由定时器采样 */
+        xTimerStartFromISR(g_key_timer, &woken);
+    }
+
+    portYIELD_FROM_ISR(woken);
+}
+
+/**
+ * @brief       KEY0 中断服务函数
+ * @param       无
+ * @retval      无
+ */
+void EXTI9_5_IRQHandler(void)
+{
+    traceISR_ENTER();
+    key_exti_irq(KEY0_GPIO_PIN);
+    traceISR_EXIT();
+}
+
+/**
+ * @brief       KEY1 中断服务函数
+ * @param       无
+ * @retval      无
+ */
+void EXTI15_10_IRQHandler(void)
+{
+    traceISR_ENTER();
+    key_exti_irq(KEY1_GPIO_PIN);
+    traceISR_EXIT();
+}
+
+/**
+ * @brief       WKUP 中断服务函数
+ * @param       无
+ * @retval      无
+ */
+void EXTI0_IRQHandler(void)
+{
+    traceISR_ENTER();
+    key_exti_irq(WKUP_GPIO_PIN);
+    traceISR_EXIT();
+}
+
+/**
+ * @brief       中断按键初始化, 代替 key_init
+ * @note        需要在开启任务调度之前或之后调用一次, 软件定时器在调度器启动后才开始工作
+ * @param       无
+ * @retval      0, 成功; 1, 失败(内存不足)
+ */
+uint8_t key_exti_init(void)
+{
+    GPIO_InitTypeDef gpio_init_struct;
+    uint8_t i;
+
+    g_key_queue = xQueueCreate(KEY_EXTI_QUEUE_LEN, sizeof(_key_event));
+    g_key_timer = xTimerCreate("key", pdMS_TO_TICKS(KEY_EXTI_SCAN_MS) ? pdMS_TO_TICKS(KEY_EXTI_SCAN_MS) : 1,
+                               pdTRUE, NULL, key_exti_timer_cb);
+
+    if (g_key_queue == NULL || g_key_timer == NULL)
+    {
+        return 1;
+    }
+
+    KEY0_GPIO_CLK_ENABLE();                                     /* KEY0时钟使能 */
+    KEY1_GPIO_CLK_ENABLE();                                     /* KEY1时钟使能 */
+    WKUP_GPIO_CLK_ENABLE();                                     /* WKUP时钟使能 */
+    __HAL_RCC_AFIO_CLK_ENABLE();                                /* 外部中断线选择需要AFIO时钟 */
+
+    for (i = 0; i < KEY_EXTI_NUM; i++)
+    {
+        gpio_init_struct.Pin = g_key_pin[i].pin;
+        gpio_init_struct.Mode = GPIO_MODE_IT_RISING_FALLING;    /* 双边沿触发 */
+        gpio_init_struct.Pull = g_key_pin[i].pull;
+        gpio_init_struct.Speed = GPIO_SPEED_FREQ_HIGH;          /* 高速 */
+        HAL_GPIO_Init(g_key_pin[i].port, &gpio_init_struct);
+
+        HAL_NVIC_SetPriority(g_key_pin[i].irq, KEY_EXTI_IRQ_PRIO, 0);   /* 中断里要调用FreeRTOS的FromISR函数 */
+        HAL_NVIC_EnableIRQ(g_key_pin[i].irq);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief       等待按键事件
+ * @param       evt     : 收到的事件
+ * @param       wait    : 最长等待时间, 单位: 节拍, portMAX_DELAY 表示一直等待
+ * @retval      0, 收到事件; 1, 超时
+ */
+uint8_t key_exti_get(_key_event *evt, TickType_t wait)
+{
+    return (xQueueReceive(g_key_queue, evt, wait) == pdPASS) ? 0 : 1;
+}
+
+#endif
@@ -0,0 +1,379 @@
+/**
+ ****************************************************************************************************
+ * @file        lcd_comp.c
+ * @author      正点原子团队(ALIENTEK)
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       LCD 脏矩形画布(离屏合成) 驱动代码
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 STM32F103开发板
+ * 在线视频:www.yuanzige.com
+ * 技术论坛:www.openedv.com
+ * 公司网址:www.alientek.com
+ * 购买地址:openedv.taobao.com
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#include "./BSP/LCD/lcd.h"
+#include "./BSP/LCD/lcd_comp.h"
+
+
+/**
+ * @brief       将屏幕坐标的矩形裁剪到画布内, 并转换成画布坐标
+ * @param       comp   : 画布
+ * @param       sx,sy  : 左上角坐标(输入屏幕坐标, 输出画布坐标)
+ * @param       ex,ey  : 右下角坐标(输入屏幕坐标, 输出画布坐标)
+ * @retval      0, 裁剪后区域为空; 1, 区域有效;
+ */
+static uint8_t lcd_comp_clip(_lcd_comp *comp, uint16_t *sx, uint16_t *sy, uint16_t *ex, uint16_t *ey)
+{
+    if (*ex < *sx || *ey < *sy) return 0;
+
+    if (*ex < comp->x || *ey < comp->y) return 0;   /* 在画布左边/上边 */
+
+    if (*sx >= comp->x + comp->width || *sy >= comp->y + comp->height) return 0;    /* 在画布右边/下边 */
+
+    *sx = (*sx > comp->x) ? *sx - comp->x : 0;
+    *sy = (*sy > comp->y) ? *sy - comp->y : 0;
+    *ex = (*ex - comp->x < comp->width) ? *ex - comp->x : comp->width - 1;
+    *ey = (*ey - comp->y < comp->height) ? *ey - comp->y : comp->height - 1;
+    return 1;
+}
+
+/**
+ * @brief       标记画布坐标下的矩形区域为脏
+ * @param       comp   : 画布
+ * @param       (sx,sy),(ex,ey): 矩形对角坐标(画布坐标, 已裁剪)
+ * @retval      无
+ */
+static void lcd_comp_mark(_lcd_comp *comp, uint16_t sx, uint16_t sy, uint16_t ex, uint16_t ey)
+{
+    uint8_t r;
+    uint32_t mask;
+    uint8_t c0 = sx >> LCD_COMP_TILE_SHIFT;
+    uint8_t c1 = ex >> LCD_COMP_TILE_SHIFT;
+
+    mask = ((2U << c1) - 1) & ~((1U << c0) - 1);    /* 第 c0 ~ c1 位 */
+
+    for (r = sy >> LCD_COMP_TILE_SHIFT; r <= (ey >> LCD_COMP_TILE_SHIFT); r++)
+    {
+        comp->dirty[r] |= mask;
+    }
+}
+
+/**
+ * @brief       初始化画布
+ *   @note      初始化后整个画布标记为脏, 缓存内容由调用者负责绘制(如先 lcd_comp_fill 背景色).
+ * @param       comp         : 画布
+ * @param       buf          : 像素缓存, 至少 width * height 个 uint16_t
+ * @param       x,y          : 画布左上角在屏幕上的坐标
+ * @param       width,height : 画布宽度和高度, 必须大于0
+ * @retval      0, 成功; 1, 画布尺寸超出 LCD_COMP_MAX_TILE_COLS/ROWS 限制;
+ */
+uint8_t lcd_comp_init(_lcd_comp *comp, uint16_t *buf, uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+    uint8_t r;
+    uint16_t tcols = (width + LCD_COMP_TILE_SIZE - 1) >> LCD_COMP_TILE_SHIFT;
+    uint16_t trows = (height + LCD_COMP_TILE_SIZE - 1) >> LCD_COMP_TILE_SHIFT;
+
+    if (width == 0 || height == 0 || tcols > LCD_COMP_MAX_TILE_COLS || trows > LCD_COMP_MAX_TILE_ROWS)
+    {
+        return 1;
+    }
+
+    comp->buf = buf;
+    comp->x = x;
+    comp->y = y;
+    comp->width = width;
+    comp->height = height;
+    comp->tcols = tcols;
+    comp->trows = trows;
+
+    for (r = 0; r < LCD_COMP_MAX_TILE_ROWS; r++)
+    {
+        comp->dirty[r] = 0;
+    }
+
+    lcd_comp_mark(comp, 0, 0, width - 1, height - 1);
+    return 0;
+}
+
+/**
+ * @brief       标记区域需要刷新(缓存被直接修改时使用)
+ * @param       comp   : 画布
+ * @param       (sx,sy),(ex,ey): 矩形对角坐标(屏幕坐标)
+ * @retval      无
+ */
+void lcd_comp_invalidate(_lcd_comp *comp, uint16_t sx, uint16_t sy, uint16_t ex, uint16_t ey)
+{
+    if (lcd_comp_clip(comp, &sx, &sy, &ex, &ey))
+    {
+        lcd_comp_mark(comp, sx, sy, ex, ey);
+    }
+}
+
+/**
+ * @brief       把脏区域写到屏幕
+ *   @note      逐行扫描脏方块位图, 取出一段连续的脏方块后, 向下合并同样覆盖这一段的
+ *              方块行, 得到一个矩形, 每个矩形只开一次窗口写屏.
+ * @param       comp   : 画布
+ * @retval      无
+ */
+void lcd_comp_flush(_lcd_comp *comp)
+{
+    uint8_t r, r1, c0, c1;
+    uint32_t mask;
+    uint16_t px, py, pw, ph;
+
+    for (r = 0; r < comp->trows; r++)
+    {
+        while (comp->dirty[r])
+        {
+            for (c0 = 0; (comp->dirty[r] & (1U << c0)) == 0; c0++);     /* 第一个脏方块 */
+
+            for (c1 = c0; c1 + 1 < comp->tcols && (comp->dirty[r] & (1U << (c1 + 1))); c1++);  /* 连续脏方块 */
+
+            mask = ((2U << c1) - 1) & ~((1U << c0) - 1);
+            comp->dirty[r] &= ~mask;
+
+            for (r1 = r; r1 + 1 < comp->trows && (comp->dirty[r1 + 1] & mask) == mask; r1++)   /* 向下合并 */
+            {
+                comp->dirty[r1 + 1] &= ~mask;
+            }
+
+            px = c0 << LCD_COMP_TILE_SHIFT;
+            py = r << LCD_COMP_TILE_SHIFT;
+            pw = ((c1 + 1) << LCD_COMP_TILE_SHIFT) - px;
+            ph = ((r1 + 1) << LCD_COMP_TILE_SHIFT) - py;
+
+            if (px + pw > comp->width) pw = comp->width - px;   /* 最后一列/行方块可能不完整 */
+
+            if (py + ph > comp->height) ph = comp->height - py;
+
+            lcd_color_blit(comp->x + px, comp->y + py, pw, ph, comp->buf + (uint32_t)py * comp->width + px, comp->width);
+        }
+    }
+}
+
+/**
+ * @brief       画点
+ * @param       comp   : 画布
+ * @param       x,y    : 坐标(屏幕坐标)
+ * @param       color  : 点的颜色
+ * @retval      无
+ */
+void lcd_comp_draw_point(_lcd_comp *comp, uint16_t x, uint16_t y, uint16_t color)
+{
+    uint16_t ex = x, ey = y;
+
+    if (lcd_comp_clip(comp, &x, &y, &ex, &ey))
+    {
+        comp->buf[(uint32_t)y * comp->width + x] = color;
+        lcd_comp_mark(comp, x, y, x, y);
+    }
+}
+
+/**
+ * @brief       在指定区域内填充单个颜色
+ * @param       comp   : 画布
+ * @param       (sx,sy),(ex,ey): 填充矩形对角坐标(屏幕坐标)
+ * @param       color  : 要填充的颜色
+ * @retval      无
+ */
+void lcd_comp_fill(_lcd_comp *comp, uint16_t sx, uint16_t sy, uint16_t ex, uint16_t ey, uint16_t color)
+{
+    uint16_t i, j;
+    uint16_t *p;
+
+    if (lcd_comp_clip(comp, &sx, &sy, &ex, &ey) == 0) return;
+
+    for (i = sy; i <= ey; i++)
+    {
+        p = comp->buf + (uint32_t)i * comp->width;
+
+        for (j = sx; j <= ex; j++)
+        {
+            p[j] = color;
+        }
+    }
+
+    lcd_comp_mark(comp, sx, sy, ex, ey);
+}
+
+/**
+ * @brief       在指定区域内填充指定颜色块
+ * @param       comp   : 画布
+ * @param       (sx,sy),(ex,ey): 填充矩形对角坐标(屏幕坐标), 区域大小为:(ex - sx + 1) * (ey - sy + 1)
+ * @param       color  : 要填充的颜色数组首地址
+ * @retval      无
+ */
+void lcd_comp_color_fill(_lcd_comp *comp, uint16_t sx, uint16_t sy, uint16_t ex, uint16_t ey, uint16_t *color)
+{
+    uint16_t i, j;
+    uint16_t *p;
+    uint16_t ox = sx, oy = sy;
+    uint16_t stride = ex - sx + 1;  /* 源数据每行点数 */
+
+    if (lcd_comp_clip(comp, &sx, &sy, &ex, &ey) == 0) return;
+
+    color += (uint32_t)(sy + comp->y - oy) * stride + (sx + comp->x - ox);  /* 跳过被裁掉的部分 */
+
+    for (i = sy; i <= ey; i++)
+    {
+        p = comp->buf + (uint32_t)i * comp->width;
+
+        for (j = 0; j <= ex - sx; j++)
+        {
+            p[sx + j] = color[j];
+        }
+
+        color += stride;
+    }
+
+    lcd_comp_mark(comp, sx, sy, ex, ey);
+}
+
+/**
+ * @brief       画线
+ * @param       comp   : 画布
+ * @param       x1,y1  : 起点坐标(屏幕坐标)
+ * @param       x2,y2  : 终点坐标(屏幕坐标)
+ * @param       color  : 线的颜色
+ * @retval      无
+ */
+void lcd_comp_draw_line(_lcd_comp *comp, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color)
+{
+    uint16_t t;
+    int xerr = 0, yerr = 0, delta_x, delta_y, distance;
+    int incx, incy, row, col;
+    delta_x = x2 - x1;          /* 计算坐标增量 */
+    delta_y = y2 - y1;
+    row = x1;
+    col = y1;
+
+    if (delta_x > 0)incx = 1;   /* 设置单步方向 */
+    else if (delta_x == 0)incx = 0; /* 垂直线 */
+    else
+    {
+        incx = -1;
+        delta_x = -delta_x;
+    }
+
+    if (delta_y > 0)incy = 1;
+    else if (delta_y == 0)incy = 0; /* 水平线 */
+    else
+    {
+        incy = -1;
+        delta_y = -delta_y;
+    }
+
+    if ( delta_x > delta_y)distance = delta_x;  /* 选取基本增量坐标轴 */
+    else distance = delta_y;
+
+    for (t = 0; t <= distance + 1; t++ )   /* 画线输出 */
+    {
+        lcd_comp_draw_point(comp, row, col, color); /* 画点 */
+        xerr += delta_x ;
+        yerr += delta_y ;
+
+        if (xerr > distance)
+        {
+            xerr -= distance;
+            row += incx;
+        }
+
+        if (yerr > distance)
+        {
+            yerr -= distance;
+            col += incy;
+        }
+    }
+}
+
+/**
+ * @brief       在指定位置显示一个字符
+ * @param       comp  : 画布
+ * @param       x,y   : 坐标(屏幕坐标)
+ * @param       chr   : 要显示的字符:" "--->"~"
+ * @param       size  : 字体大小 12/16/24/32
+ * @param       mode  : 叠加方式(1); 非叠加方式(0);
+ * @param       color : 字符的颜色;
+ * @retval      无
+ */
+void lcd_comp_show_char(_lcd_comp *comp, uint16_t x, uint16_t y, char chr, uint8_t size, uint8_t mode, uint16_t color)
+{
+    uint16_t rows[32];
+    uint16_t sx = x, sy = y, ex, ey;
+    uint16_t i, j;
+    uint16_t line;
+    uint16_t *p;
+
+    if (lcd_get_glyph(chr, size, rows)) return;  /* 字符或字体大小不支持 */
+
+    ex = x + size / 2 - 1;
+    ey = y + size - 1;
+
+    if (lcd_comp_clip(comp, &sx, &sy, &ex, &ey) == 0) return;
+
+    for (i = sy; i <= ey; i++)
+    {
+        line = rows[i + comp->y - y] >> (sx + comp->x - x);    /* 跳过左边被裁掉的列 */
+        p = comp->buf + (uint32_t)i * comp->width;
+
+        for (j = sx; j <= ex; j++)
+        {
+            if (line & 0x01)
+            {
+                p[j] = color;
+            }
+            else if (mode == 0)
+            {
+                p[j] = g_back_color;
+            }
+
+            line >>= 1;
+        }
+    }
+
+    lcd_comp_mark(comp, sx, sy, ex, ey);
+}
+
+/**
+ * @brief       显示字符串
+ * @param       comp        : 画布
+ * @param       x,y         : 起始坐标(屏幕坐标)
+ * @param       width,height: 区域大小
+ * @param       size        : 选择字体 12/16/24/32
+ * @param       p           : 字符串首地址
+ * @param       color       : 字符串的颜色;
+ * @retval      无
+ */
+void lcd_comp_show_string(_lcd_comp *comp, uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t size, char *p, uint16_t color)
+{
+    uint16_t x0 = x;
+    width += x;
+    height += y;
+
+    while ((*p <= '~') && (*p >= ' '))   /* 判断是不是非法字符! */
+    {
+        if (x >= width)
+        {
+            x = x0;
+            y += size;
+        }
+
+        if (y >= height)break;  /* 退出 */
+
+        lcd_comp_show_char(comp, x, y, *p, size, 0, color);
+        x += size / 2;
+        p++;
+    }
+}
@@ -47,11 +47,42 @@
 #define USART_UX_IRQHandler                 USART1_IRQHandler
 #define USART_UX_CLK_ENABLE()               do{ __HAL_RCC_USART1_CLK_ENABLE(); }while(0)  /* USART1 时钟使能 */
 
+/* 发送DMA 定义(USART1_TX 固定对应 DMA1 通道4, 修改USART_UX时要一起修改) */
+#define USART_TX_DMA_CHANNEL                DMA1_Channel4
+#define USART_TX_DMA_IRQn                   DMA1_Channel4_IRQn
+#define USART_TX_DMA_IRQHandler             DMA1_Channel4_IRQHandler
+#define USART_TX_DMA_CLK_ENABLE()           do{ __HAL_RCC_DMA1_CLK_ENABLE(); }while(0)    /* DMA1 时钟使能 */
+
+/* 接收DMA 定义(USART1_RX 固定对应 DMA1 通道5) */
+#define USART_RX_DMA_CHANNEL                DMA1_Channel5
+#define USART_RX_DMA_IRQn                   DMA1_Channel5_IRQn
+#define USART_RX_DMA_IRQHandler             DMA1_Channel5_IRQHandler
+#define USART_RX_DMA_CLK_ENABLE()           do{ __HAL_RCC_DMA1_CLK_ENABLE(); }while(0)    /* DMA1 时钟使能 */
+
 /******************************************************************************************/
 
 #define USART_REC_LEN               200         /* 定义最大接收字节数 200 */
 #define USART_EN_RX                 1           /* 使能（1）/禁止（0）串口1接收 */
 
+/* 使能（1）/禁止（0）DMA发送
+ * 使能后printf的数据先写入FreeRTOS流缓冲区, 由DMA在后台发出, 任务不再等待每个字符发送完成.
+ * 调度器启动前, 中断里, 关中断时(比如configASSERT), 以及空闲任务和定时器服务任务中的printf仍然使用查询方式直接发送.
+ * 发送缓冲区在任务中第一次printf时才创建, 调度器启动前不调用FreeRTOS的API.
+ */
+#define USART_EN_TX_DMA             SYS_SUPPORT_OS
+#define USART_TX_BUF_SIZE           256         /* DMA发送缓冲区大小(从FreeRTOS堆中申请) */
+#define USART_TX_LINE_SIZE          64          /* printf行缓冲大小, 遇到换行或攒满时才写入发送缓冲区.
+                                                   没有换行的内容要等下一次换行, usart_write(), usart_tx_flush()或直接发送时才发出 */
+
+/* 使能（1）/禁止（0）DMA循环接收(需要USART_EN_RX为1)
+ * 使能后DMA在后台循环接收, 在DMA缓冲区半满, 全满和串口总线空闲时才进中断, 把数据移到FreeRTOS流缓冲区,
+ * 并唤醒等待数据的任务. 任务用usart_read()/usart_read_line()/usart_read_frame()读取.
+ * DMA接收在任务中第一次使用串口(收或发)时才启动, 在这之前收到的数据被丢弃.
+ */
+#define USART_EN_RX_DMA             SYS_SUPPORT_OS
+#define USART_RX_DMA_BUF_SIZE       64          /* DMA循环接收缓冲区大小, 中断响应要在收到一半的时间内完成 */
+#define USART_RX_BUF_SIZE           256         /* 接收流缓冲区大小(从FreeRTOS堆中申请) */
+
 extern uint8_t  g_usart_rx_buf[USART_REC_LEN];  /* 接收缓冲,最大USART_REC_LEN个字节.末字节为换行符 */
 extern uint16_t g_usart_rx_sta;                 /* 接收状态标记 */
 extern UART_HandleTypeDef uartx_handler;        /* HAL UART句柄 */
@@ -60,6 +91,20 @@ extern UART_HandleTypeDef uartx_handler;        /* HAL UART句柄 */
 extern uint8_t aRxBuffer[RXBUFFERSIZE];         /* HAL库USART接收Buffer */
 
 void usart_init(uint32_t bound);                /* 串口初始化函数 */
+void usart_write(const uint8_t *buf, uint16_t len);  /* 发送一段数据 */
+
+#if USART_EN_TX_DMA
+uint8_t usart_tx_busy(void);                    /* 查询DMA发送是否还有数据未发完 */
+void usart_tx_flush(void);                      /* 等待缓冲区中的数据全部发送完成 */
+#endif
+
+#if USART_EN_RX && USART_EN_RX_DMA
+extern uint32_t g_usart_rx_lost;                /* 接收流缓冲区满而丢掉的字节数 */
+
+uint16_t usart_read(uint8_t *buf, uint16_t len, uint32_t timeout);         /* 读取收到的数据 */
+uint16_t usart_read_line(char *buf, uint16_t size, uint32_t timeout);      /* 读取一行 */
+uint16_t usart_read_frame(uint8_t *buf, uint16_t size, uint32_t timeout);  /* 读取一帧(以总线空闲分隔) */
+#endif
 #endif
 
 
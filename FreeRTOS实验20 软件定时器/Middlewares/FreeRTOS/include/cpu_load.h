@@ -0,0 +1,149 @@
+/*
+ * FreeRTOS Kernel V10.4.6
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Windowed CPU load service.
+ *
+ * vTaskGetRunTimeStats() divides each task's run time by the time since boot,
+ * so after a while a task that suddenly starts to spin hardly moves its figure.
+ * This service instead closes a window every configCPU_LOAD_WINDOW_MS.  At the
+ * end of each window it reads every task's run time counter and reports how
+ * much of that window each task used.  It also reports the idle task's share,
+ * the total CPU load (everything except idle), and the highest value of each
+ * figure since the last call to vCpuLoadResetPeaks().
+ *
+ * The tasks are read with uxTaskIteratorNext(), a few at a time, from a
+ * software timer.  The results are kept in a fixed table of
+ * configCPU_LOAD_MAX_TASKS entries, so nothing is allocated after
+ * xCpuLoadStart().
+ *
+ * If configCPU_LOAD_ISR_TIME is 1, the interrupt handlers that call
+ * traceISR_ENTER() and traceISR_EXIT() are timed with the DWT cycle counter.
+ * Their total is reported as a separate ISR bucket.  The run time counters do
+ * not stop during interrupts, so this time is also included in the figure of
+ * whichever task was interrupted.  Interrupts without the hooks, such as
+ * SysTick, are not in the ISR bucket.
+ *
+ * Loads are in units of 0.01%, so 10000 is 100%.  To use the service:
+ * - set configUSE_CPU_LOAD, configGENERATE_RUN_TIME_STATS,
+ *   configUSE_TRACE_FACILITY and configUSE_TIMERS to 1 in FreeRTOSConfig.h;
+ * - call xCpuLoadStart() once.
+ */
+
+#ifndef CPU_LOAD_H
+#define CPU_LOAD_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include cpu_load.h"
+#endif
+
+#include "task.h"
+
+/* Length of a measurement window.  The ISR bucket is measured in CPU cycles,
+ * so the window must be shorter than the 32 bit cycle counter period (59s at
+ * 72MHz). */
+#ifndef configCPU_LOAD_WINDOW_MS
+    #define configCPU_LOAD_WINDOW_MS    1000
+#endif
+
+/* The number of tasks the service can follow.  Tasks beyond this are left
+ * out of the per task figures, but still count towards the CPU load. */
+#ifndef configCPU_LOAD_MAX_TASKS
+    #define configCPU_LOAD_MAX_TASKS    16
+#endif
+
+/* Set to 1 to have vApplicationCpuLoadHook() called at the end of every
+ * window, for example to log a load spike as soon as it happens. */
+#ifndef configUSE_CPU_LOAD_HOOK
+    #define configUSE_CPU_LOAD_HOOK    0
+#endif
+
+/* Load of one task. */
+typedef struct CpuLoadTask
+{
+    TaskHandle_t xHandle;                   /* Only valid while the task still exists. */
+    UBaseType_t uxTaskNumber;               /* The task's xTaskNumber, as in TaskStatus_t. */
+    uint16_t usLoad;                        /* Share of the last window, in 0.01% units. */
+    uint16_t usPeakLoad;                    /* Highest usLoad since the last reset. */
+    char cName[ configMAX_TASK_NAME_LEN ];  /* Copied when the task was first seen. */
+} CpuLoadTask_t;
+
+/* Load of the whole system. */
+typedef struct CpuLoad
+{
+    uint32_t ulWindows;                     /* Windows completed so far. */
+    uint16_t usCpuLoad;                     /* Share of the last window not used by the idle task. */
+    uint16_t usPeakCpuLoad;                 /* Highest usCpuLoad since the last reset. */
+    uint16_t usIdle;                        /* The idle task's share of the last window. */
+    uint16_t usIsrLoad;                     /* Share of the last window spent in timed interrupt handlers. */
+    uint16_t usPeakIsrLoad;                 /* Highest usIsrLoad since the last reset. */
+    uint16_t usUntrackedTasks;              /* Tasks left out of the per task figures because the table was full. */
+} CpuLoad_t;
+
+/*
+ * Creates the software timer that closes the windows and starts the first
+ * window.  Call once, before or after the scheduler has been started.  Returns
+ * pdFAIL if the timer could not be created.
+ */
+BaseType_t xCpuLoadStart( void );
+
+/*
+ * Closes the current window and starts the next one.  Called by the service's
+ * timer, but can also be called directly by an application that prefers to
+ * choose the windows itself.
+ */
+void vCpuLoadSample( void );
+
+/*
+ * Copies the figures of the last completed window to pxLoad.
+ */
+void vCpuLoadGet( CpuLoad_t * pxLoad );
+
+/*
+ * Copies the figures of up to uxArraySize tasks, in the order in which the
+ * tasks were created, to pxTasks.  Returns the number of entries written.
+ */
+UBaseType_t uxCpuLoadGetTasks( CpuLoadTask_t * pxTasks,
+                               UBaseType_t uxArraySize );
+
+/*
+ * Clears the peak figures of the system and of every task.
+ */
+void vCpuLoadResetPeaks( void );
+
+#if ( configUSE_CPU_LOAD_HOOK == 1 )
+
+/*
+ * Provided by the application.  Called from the timer service task, or from
+ * whichever task calls vCpuLoadSample(), at the end of every window.  Must not
+ * block.
+ */
+    void vApplicationCpuLoadHook( const CpuLoad_t * pxLoad );
+#endif
+
+#endif /* CPU_LOAD_H */
@@ -76,6 +76,9 @@ QueueHandle_t semaphore_handler;
 /*在系统进入低功耗模式前执行的事务*/
 void PRE_SLEEP_PROCESSING(void)
 {
+#if USART_EN_TX_DMA
+    if (usart_tx_busy() == 0)       /*串口还在DMA发送时不能关PA口时钟(PA9是TX脚), DMA发送完成中断会唤醒CPU*/
+#endif
     __HAL_RCC_GPIOA_CLK_DISABLE();  /*关闭外设时钟*/
     __HAL_RCC_GPIOB_CLK_DISABLE();
     __HAL_RCC_GPIOC_CLK_DISABLE();
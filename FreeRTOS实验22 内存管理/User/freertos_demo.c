@@ -32,6 +32,9 @@
 #include "queue.h"
 #include "semphr.h"
 #include "event_groups.h"
+#if configUSE_HEAP_TRACKER
+#include "heap_track.h"
+#endif
 
 /******************************************************************************************************/
 /*FreeRTOS配置*/
@@ -50,7 +53,7 @@ TaskHandle_t start_task_handler;
  */
  
 #define TASK1_PRIO         2
-#define TASK1_STACK_SIZE   128  //128 * 4 Byte
+#define TASK1_STACK_SIZE   320  //320 * 4 Byte, 打印堆跟踪和碎片统计的局部变量要用掉几百字节的栈
 TaskHandle_t task1_handler;
 
 
@@ -72,6 +75,76 @@ TaskHandle_t task2_handler;
 TaskHandle_t task3_handler;
 
 
+#if configUSE_HEAP_TRACKER
+//分配记录的输出回调：每次输出一行CSV, 直接通过串口发出
+BaseType_t heap_track_write( const void * pvData, size_t xLength, void * pvContext )
+{
+    usart_write((const uint8_t *)pvData, (uint16_t)xLength);
+    return pdPASS;
+}
+
+//打印各任务的内存用量, 以及分配超过10秒仍未释放的内存块(可能泄漏)
+void print_heap_track(void)
+{
+    HeapTrackTask_t tasks[8];
+    HeapTrackStats_t stats;
+    UBaseType_t num;
+
+    vHeapTrackGetStats(&stats);
+    printf("已分配内存块:%u 共%u字节, 未记录:%u\r\n", stats.uxLiveBlocks, stats.xLiveBytes, stats.ulUntrackedBlocks);
+
+    num = uxHeapTrackGetTasks(tasks, 8);
+    printf("任务名\t\t当前\t峰值\t分配次数\r\n");
+    for (UBaseType_t i = 0; i < num; i++)
+    {
+        printf("%s%s\t\t%u\t%u\t%u\r\n",
+                tasks[i].cName,
+                (tasks[i].xHandle == NULL) ? "(已删除)" : "",
+                tasks[i].xCurrentBytes,
+                tasks[i].xPeakBytes,
+                tasks[i].ulAllocations);
+    }
+
+    //caller是调用pvPortMalloc的函数中的返回地址, 可在.map文件中查到所在函数
+    xHeapTrackDump(pdMS_TO_TICKS(10000), heap_track_write, NULL);
+}
+#endif
+
+#if configUSE_HEAP_FRAG_STATS
+//打印空闲块和申请大小的分布、碎片率, 以及最近几次申请失败时的堆状态
+void print_heap_frag(void)
+{
+    HeapFragStats_t frag;
+    size_t num;
+
+    vPortGetHeapFragStats(&frag);
+    printf("碎片率:%u.%02u%% 最高:%u.%02u%% 最大申请:%u字节\r\n",
+            frag.usFragmentation / 100, frag.usFragmentation % 100,
+            frag.usWorstFragmentation / 100, frag.usWorstFragmentation % 100,
+            frag.xLargestRequest);
+
+    printf("大小级\t空闲块\t申请\t失败\r\n");
+    for (uint8_t i = 0; i < configHEAP_FRAG_SIZE_CLASSES; i++)
+    {
+        printf("%s%u\t%u\t%u\t%u\r\n",
+                (i < configHEAP_FRAG_SIZE_CLASSES - 1) ? "<" : ">=",            //最后一级包含所有更大的块
+                (i < configHEAP_FRAG_SIZE_CLASSES - 1) ? (32u << i) : (16u << i),
+                frag.xFreeBlocksBySize[i], frag.xRequestsBySize[i], frag.xFailuresBySize[i]);
+    }
+
+    num = (frag.xNumberOfFailures < configHEAP_FAILURE_LOG_LENGTH) ? frag.xNumberOfFailures : configHEAP_FAILURE_LOG_LENGTH;
+    for (size_t i = 0; i < num; i++)
+    {
+        printf("申请失败: %u字节, 剩余%u字节, 最大空闲块%u字节, 空闲块%u个, 时间%u\r\n",
+                frag.xFailures[i].xRequestedSize,
+                frag.xFailures[i].xAvailableHeapSpaceInBytes,
+                frag.xFailures[i].xSizeOfLargestFreeBlockInBytes,
+                frag.xFailures[i].xNumberOfFreeBlocks,
+                frag.xFailures[i].xTimeInTicks);
+    }
+}
+#endif
+
 /*任务1:
 用于按键扫描，当KEY0按下则申请内存，当KEY1按下则释放内存，并打印剩余内存信息*/
 void task1( void * pvParameters )
@@ -83,6 +156,7 @@ void task1( void * pvParameters )
         key_num = key_scan(0);
         if(key_num == KEY0_PRES)
         {
+            //连续按两次KEY0, 第一次申请的内存就再也无法释放(泄漏), 可按WKUP查看
             array = (uint32_t *)pvPortMalloc(20);/*申请内存*/
             if(array != NULL)
             printf("内存申请成功\r\n");
@@ -95,6 +169,17 @@ void task1( void * pvParameters )
                 printf("释放内存\r\n");
             }
         }
+#if configUSE_HEAP_TRACKER || configUSE_HEAP_FRAG_STATS
+        else if(key_num == WKUP_PRES)
+        {
+#if configUSE_HEAP_TRACKER
+            print_heap_track();
+#endif
+#if configUSE_HEAP_FRAG_STATS
+            print_heap_frag();
+#endif
+        }
+#endif
 
         printf("空闲内存大小:%d\r\n", xPortGetFreeHeapSize());
         vTaskDelay(100);  
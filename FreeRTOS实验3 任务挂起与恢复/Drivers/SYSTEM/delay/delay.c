@@ -2,8 +2,8 @@
  ****************************************************************************************************
  * @file        delay.c
  * @author      正点原子团队(ALIENTEK)
- * @version     V1.0
- * @date        2020-04-17
+ * @version     V1.1
+ * @date        2026-10-19
  * @brief       使用SysTick的普通计数模式对延迟进行管理(支持ucosii)
  *              提供delay_init初始化函数， delay_us和delay_ms等延时函数
  * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
@@ -19,6 +19,9 @@
  * 修改说明
  * V1.0 20200417
  * 第一次发布
+ * V1.1 20261019
+ * 1, 使用OS时 delay_us 改用DWT周期计数器忙等, 不再依赖SysTick的重装值
+ * 2, 使用OS时 delay_ms 的整节拍部分用 vTaskDelay 让出CPU
  *
  ****************************************************************************************************
  */
@@ -35,6 +38,8 @@ static uint16_t  g_fac_us = 0;      /* us延时倍乘数 */
 #include "FreeRTOS.h"
 #include "task.h"
 
+static uint32_t  g_fac_cyc = 0;     /* 每us的CPU周期数, DWT延时使用 */
+
 extern void xPortSysTickHandler(void);
 
 /**
@@ -68,6 +73,10 @@ void delay_init(uint16_t sysclk)
 
     g_fac_us = sysclk / 8;                                      /* 不论是否使用OS,g_fac_us都需要使用,作为1us的基础时基 */
 #if SYS_SUPPORT_OS                                              /* 如果需要支持OS. */
+    g_fac_cyc = sysclk;
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;             /* 使能DWT */
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;                        /* 开启CPU周期计数器 */
+
     reload = sysclk / 8;                                        /* 每秒钟的计数次数 单位为M */
     reload *= 1000000 / configTICK_RATE_HZ;                     /* 根据delay_ostickspersec设定溢出时间
                                                                  * reload为24位寄存器,最大值:16777216,在9M下,约合1.86s左右
@@ -81,56 +90,67 @@ void delay_init(uint16_t sysclk)
 #if SYS_SUPPORT_OS  /* 如果需要支持OS, 用以下代码 */
 
 /**
- * @brief       延时nus
- * @param       nus: 要延时的us数.
- * @note        nus取值范围: 0 ~ 477218588(最大值即2^32 / g_fac_us @g_fac_us = 9)
+ * @brief       用DWT周期计数器忙等
+ * @note        DWT->CYCCNT 按CPU时钟计数, 不受 tickless 模式重装 SysTick 的影响, 关中断时也能使用
+ * @param       told: 开始计时时的 DWT->CYCCNT
+ * @param       nus: 从 told 开始要等待的us数
  * @retval      无
  */
-void delay_us(uint32_t nus)
+static void delay_cycles(uint32_t told, uint32_t nus)
 {
-    uint32_t ticks;
-    uint32_t told, tnow, tcnt = 0;
-    uint32_t reload;
-    
-    reload = SysTick->LOAD;     /* LOAD的值 */
-    ticks = nus * g_fac_us;     /* 需要的节拍数 */
-    told = SysTick->VAL;        /* 刚进入时的计数器值 */
+    uint32_t n;
+    uint32_t cycles;
 
-    while (1)
+    while (nus)
     {
-        tnow = SysTick->VAL;
+        n = (nus > 1000000) ? 1000000 : nus;    /* 每次最多等1s, 防止周期数溢出32位 */
+        cycles = n * g_fac_cyc;
 
-        if (tnow != told)
-        {
-            if (tnow < told)
-            {
-                tcnt += told - tnow;    /* 这里注意一下SYSTICK是一个递减的计数器就可以了. */
-            }
-            else
-            {
-                tcnt += reload - tnow + told;
-            }
-
-            told = tnow;
-
-            if (tcnt >= ticks) break;   /* 时间超过/等于要延迟的时间,则退出. */
-        }
+        while ((DWT->CYCCNT - told) < cycles);  /* 无符号减法, 计数器回绕也能得到正确的差值 */
+
+        told += cycles;
+        nus -= n;
     }
 }
 
+/**
+ * @brief       延时nus
+ * @note        忙等, 不让出CPU, 用于驱动里的精确时序. 较长的延时请用 delay_ms
+ * @param       nus: 要延时的us数.
+ * @retval      无
+ */
+void delay_us(uint32_t nus)
+{
+    delay_cycles(DWT->CYCCNT, nus);
+}
+
 /**
  * @brief       延时nms
+ * @note        调度器运行时, 整节拍部分用 vTaskDelay 让出CPU, 只有不足一个节拍的部分忙等;
+ *              在中断里, 临界区里, 关中断时, 调度器启动之前或挂起时全部忙等.
  * @param       nms: 要延时的ms数 (0< nms <= 65535)
  * @retval      无
  */
 void delay_ms(uint16_t nms)
 {
-    uint32_t i;
+    uint32_t ticks;
+    uint32_t phase;
 
-    for (i=0; i<nms; i++)
+    if (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING &&
+        __get_IPSR() == 0 && __get_BASEPRI() == 0 && __get_PRIMASK() == 0)
     {
-        delay_us(1000);
+        ticks = (uint32_t)nms * configTICK_RATE_HZ / 1000;  /* 整节拍数 */
+
+        if (ticks)
+        {
+            phase = (SysTick->LOAD - SysTick->VAL) / g_fac_us;  /* 当前节拍已经过去的us数 */
+            vTaskDelay(ticks);  /* 在第 ticks 个节拍中断时醒来, 比要求的少了 phase 和不足一个节拍的尾数 */
+            delay_us(phase + (uint32_t)nms * 1000 - ticks * (1000000 / configTICK_RATE_HZ));
+            return;
+        }
     }
+
+    delay_us((uint32_t)nms * 1000);
 }
 
 #else  /* 不使用OS时, 用以下代码 */
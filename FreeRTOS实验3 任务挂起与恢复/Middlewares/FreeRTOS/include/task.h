@@ -162,8 +162,33 @@ typedef struct xTASK_STATUS
     configRUN_TIME_COUNTER_TYPE ulRunTimeCounter; /* The total run time allocated to the task so far, as defined by the run time stats clock.  See https://www.FreeRTOS.org/rtos-run-time-stats.html.  Only valid when configGENERATE_RUN_TIME_STATS is defined as 1 in FreeRTOSConfig.h. */
     StackType_t * pxStackBase;                    /* Points to the lowest address of the task's stack area. */
     configSTACK_DEPTH_TYPE usStackHighWaterMark;  /* The minimum amount of stack space that has remained for the task since the task was created.  The closer this value is to zero the closer the task has come to overflowing its stack. */
+    #if ( configUSE_TASK_LATENCY_STATS == 1 )
+        TaskLatencyStats_t xLatencyStats;         /* Wakeup latency and period statistics since the task was created or vTaskResetLatencyStats() was called.  Only present when configUSE_TASK_LATENCY_STATS is defined as 1 in FreeRTOSConfig.h. */
+    #endif
+    #if ( configUSE_STACK_PROFILER == 1 )
+        configSTACK_DEPTH_TYPE usStackDepth;            /* The stack size, in words, the task was created with.  Only present when configUSE_STACK_PROFILER is defined as 1 in FreeRTOSConfig.h. */
+        configSTACK_DEPTH_TYPE usStackMinFree;          /* The fewest stack words the stack profiler has found unused.  Lags usStackHighWaterMark as the idle task only scans a little at a time. */
+        configSTACK_DEPTH_TYPE usRecommendedStackDepth; /* A stack size, in words, that covers the deepest use found plus headroom, or 0 if the task's stack has not been scanned yet. */
+    #endif
 } TaskStatus_t;
 
+/* Used with uxTaskIteratorNext() to walk the tasks in the system a few at a
+ * time.  Initialise with vTaskIteratorInit() before first use. */
+typedef struct xTASK_ITERATOR
+{
+    UBaseType_t uxLastTaskNumber; /* The task number of the last task returned.  Tasks are returned in the order in which they were created. */
+} TaskIterator_t;
+
+/* Output formats of the streaming stats functions such as xTaskListStream(). */
+#define tskSTATS_FORMAT_CSV       ( ( BaseType_t ) 0 )
+#define tskSTATS_FORMAT_BINARY    ( ( BaseType_t ) 1 )
+
+/* Called by the streaming stats functions with each record they produce.  Return
+ * pdFAIL to stop the output early. */
+typedef BaseType_t ( * TaskStatsWriteFunction_t )( const void * pvData,
+                                                   size_t xLength,
+                                                   void * pvContext );
+
 /* Possible return values for eTaskConfirmSleepModeStatus(). */
 typedef enum
 {
@@ -1037,6 +1062,33 @@ void vTaskGetInfo( TaskHandle_t xTask,
                    BaseType_t xGetFreeStackSpace,
                    eTaskState eState ) PRIVILEGED_FUNCTION;
 
+/**
+ * task. h
+ * @code{c}
+ * void vTaskResetLatencyStats( TaskHandle_t xTask );
+ * @endcode
+ *
+ * configUSE_TASK_LATENCY_STATS must be defined as 1 for this function to be
+ * available.  See the configuration section for more information.
+ *
+ * Clears the wakeup latency statistics of a task, for example to start a new
+ * measurement after the system has finished initialising.  The statistics are
+ * read back using the xLatencyStats member of the TaskStatus_t structure filled
+ * in by vTaskGetInfo() or uxTaskGetSystemState().
+ *
+ * The latency of a wakeup is the time from the task being moved out of the
+ * Blocked or Suspended state to the task starting to run.  For a task that
+ * blocks using vTaskDelayUntil() or xTaskDelayUntil(), ulMaxPeriod minus
+ * ulMinPeriod is the scheduling jitter of the task.
+ *
+ * @param xTask Handle of the task whose statistics are cleared.  If xTask is
+ * NULL then the statistics of the calling task are cleared.
+ *
+ * \defgroup vTaskResetLatencyStats vTaskResetLatencyStats
+ * \ingroup TaskCtrl
+ */
+void vTaskResetLatencyStats( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
 /**
  * task. h
  * @code{c}
@@ -1643,6 +1695,32 @@ configSTACK_DEPTH_TYPE uxTaskGetStackHighWaterMark2( TaskHandle_t xTask ) PRIVIL
 
 #endif
 
+#if ( configUSE_STACK_PROFILER == 1 )
+
+/**
+ * task.h
+ * @code{c}
+ * void vApplicationStackMarginHook( TaskHandle_t xTask, char *pcTaskName, configSTACK_DEPTH_TYPE uxFreeWords );
+ * @endcode
+ *
+ * Called from the idle task, at most once per task, when the stack profiler
+ * finds fewer than configSTACK_PROFILER_MARGIN_WORDS stack words the task has
+ * never used.  This gives a warning before the stack actually overflows.  The
+ * hook runs in the context of the idle task so must not block.  That rules out
+ * printf() when it waits for a UART mutex or buffer; record xTask and
+ * uxFreeWords instead and report them from an ordinary task, or use an output
+ * that never waits.
+ *
+ * @param xTask the task that is close to the end of its stack.
+ * @param pcTaskName A copy of the name of the task.
+ * @param uxFreeWords The number of stack words the task has never used.
+ */
+    void vApplicationStackMarginHook( TaskHandle_t xTask,
+                                      char * pcTaskName,
+                                      configSTACK_DEPTH_TYPE uxFreeWords );
+
+#endif
+
 #if  ( configUSE_TICK_HOOK > 0 )
 
 /**
@@ -1910,6 +1988,162 @@ void vTaskList( char * pcWriteBuffer ) PRIVILEGED_FUNCTION; /*lint !e971 Unquali
  */
 void vTaskGetRunTimeStats( char * pcWriteBuffer ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
 
+/**
+ * task. h
+ * @code{c}
+ * void vTaskIteratorInit( TaskIterator_t *pxIterator );
+ * UBaseType_t uxTaskIteratorNext( TaskIterator_t *pxIterator, TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, BaseType_t xGetFreeStackSpace );
+ * @endcode
+ *
+ * configUSE_TRACE_FACILITY must be defined as 1 for these functions to be
+ * available.  See the configuration section for more information.
+ *
+ * An alternative to uxTaskGetSystemState() that does not need an array large
+ * enough for every task in the system.  Each call to uxTaskIteratorNext() fills
+ * pxTaskStatusArray with the next uxArraySize tasks, in the order in which the
+ * tasks were created, and the scheduler is only suspended for the duration of
+ * that one call.  The time the system is unresponsive is therefore bounded by
+ * uxArraySize rather than by the number of tasks.
+ *
+ * Tasks created while the walk is in progress are returned once the walk
+ * reaches them, tasks deleted while the walk is in progress are skipped, and
+ * no task is returned twice.  As with uxTaskGetSystemState(), the xHandle and
+ * pcTaskName members are only valid while the task still exists.
+ *
+ * @param pxIterator The walk position, initialised by vTaskIteratorInit().
+ *
+ * @param pxTaskStatusArray An array of uxArraySize TaskStatus_t structures.
+ *
+ * @param uxArraySize The maximum number of tasks returned by one call.  Must
+ * be at least 1.
+ *
+ * @param xGetFreeStackSpace Set to pdFALSE to skip the relatively slow stack
+ * high water mark calculation, in which case usStackHighWaterMark is 0.
+ *
+ * @return The number of TaskStatus_t structures that were populated.  0 is
+ * returned once every task has been returned.
+ *
+ * Example usage:
+ * @code{c}
+ *  void vAFunction( void )
+ *  {
+ *  TaskIterator_t xIterator;
+ *  TaskStatus_t xStatus[ 4 ];
+ *  UBaseType_t x, uxCount;
+ *
+ *      vTaskIteratorInit( &xIterator );
+ *
+ *      while( ( uxCount = uxTaskIteratorNext( &xIterator, xStatus, 4, pdTRUE ) ) > 0 )
+ *      {
+ *          for( x = 0; x < uxCount; x++ )
+ *          {
+ *              // Use xStatus[ x ] here.
+ *          }
+ *      }
+ *  }
+ * @endcode
+ *
+ * \defgroup uxTaskIteratorNext uxTaskIteratorNext
+ * \ingroup TaskUtils
+ */
+void vTaskIteratorInit( TaskIterator_t * pxIterator ) PRIVILEGED_FUNCTION;
+UBaseType_t uxTaskIteratorNext( TaskIterator_t * pxIterator,
+                                TaskStatus_t * const pxTaskStatusArray,
+                                const UBaseType_t uxArraySize,
+                                BaseType_t xGetFreeStackSpace ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskListStream( TaskStatsWriteFunction_t pxWrite, void *pvContext, BaseType_t xFormat );
+ * size_t xTaskListToBuffer( char *pcBuffer, size_t xBufferLength, BaseType_t xFormat );
+ * @endcode
+ *
+ * configUSE_TRACE_FACILITY and configUSE_STATS_FORMATTING_FUNCTIONS must both be
+ * defined as 1 for these functions to be available.
+ *
+ * Replacements for vTaskList() that do not allocate memory and cannot overrun
+ * the output buffer.  The tasks are read configTASK_STATS_CHUNK_SIZE at a time
+ * using uxTaskIteratorNext(), so the scheduler is never suspended for longer
+ * than it takes to read that many tasks.  The records are only formatted and
+ * written after the scheduler has been resumed.
+ *
+ * xTaskListStream() passes each record to pxWrite, which may block, for
+ * example while sending the record to a UART.  xTaskListToBuffer() stores as
+ * many whole records as fit in pcBuffer, followed by a null terminator.
+ *
+ * The memory that is not allocated comes from the calling task's stack
+ * instead: configTASK_STATS_CHUNK_SIZE TaskStatus_t structures, as many task
+ * names and one formatted record.  On a Cortex-M3 with the default settings
+ * that is about 330 bytes, or about 670 bytes when configUSE_TASK_LATENCY_STATS
+ * is 1 because every TaskStatus_t then holds a latency histogram.  snprintf()
+ * and pxWrite need more on top, so a calling task with a 128 word stack is not
+ * enough - allow at least 256 words.  The same applies to
+ * xTaskGetRunTimeStatsStream() and xTaskGetRunTimeStatsToBuffer().
+ *
+ * tskSTATS_FORMAT_CSV produces a header line followed by one line per task:
+ * name,state,priority,base_priority,stack_free,number.  State is one of the
+ * characters used by vTaskList().
+ *
+ * tskSTATS_FORMAT_BINARY produces one little endian record per task:
+ * byte 0 record length including the name, byte 1 eTaskState, byte 2 current
+ * priority, byte 3 base priority, bytes 4-5 task number, bytes 6-7 stack high
+ * water mark in words, then the task name without a terminator.
+ *
+ * @param pxWrite Called with each record.  Return pdFAIL to stop early.
+ *
+ * @param pvContext Passed unchanged to pxWrite.
+ *
+ * @param xFormat tskSTATS_FORMAT_CSV or tskSTATS_FORMAT_BINARY.
+ *
+ * @return xTaskListStream() returns pdPASS, or pdFAIL if pxWrite stopped the
+ * output.  Like snprintf(), xTaskListToBuffer() returns the length of the
+ * complete output, not counting the terminator; if that is not less than
+ * xBufferLength then the output was truncated.
+ *
+ * \defgroup xTaskListStream xTaskListStream
+ * \ingroup TaskUtils
+ */
+BaseType_t xTaskListStream( TaskStatsWriteFunction_t pxWrite,
+                            void * pvContext,
+                            BaseType_t xFormat ) PRIVILEGED_FUNCTION;
+size_t xTaskListToBuffer( char * pcBuffer,
+                          size_t xBufferLength,
+                          BaseType_t xFormat ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskGetRunTimeStatsStream( TaskStatsWriteFunction_t pxWrite, void *pvContext, BaseType_t xFormat );
+ * size_t xTaskGetRunTimeStatsToBuffer( char *pcBuffer, size_t xBufferLength, BaseType_t xFormat );
+ * @endcode
+ *
+ * configGENERATE_RUN_TIME_STATS, configUSE_TRACE_FACILITY and
+ * configUSE_STATS_FORMATTING_FUNCTIONS must all be defined as 1 for these
+ * functions to be available.
+ *
+ * Replacements for vTaskGetRunTimeStats() that work in the same way as
+ * xTaskListStream() and xTaskListToBuffer().  The percentages are relative to
+ * the run time counter value read when the output started.
+ *
+ * tskSTATS_FORMAT_CSV produces a header line followed by one line per task:
+ * name,run_time,percent.
+ *
+ * tskSTATS_FORMAT_BINARY produces one little endian record per task:
+ * byte 0 record length including the name, byte 1 percentage, bytes 2-3 task
+ * number, bytes 4-7 run time counter, then the task name without a
+ * terminator.
+ *
+ * \defgroup xTaskGetRunTimeStatsStream xTaskGetRunTimeStatsStream
+ * \ingroup TaskUtils
+ */
+BaseType_t xTaskGetRunTimeStatsStream( TaskStatsWriteFunction_t pxWrite,
+                                       void * pvContext,
+                                       BaseType_t xFormat ) PRIVILEGED_FUNCTION;
+size_t xTaskGetRunTimeStatsToBuffer( char * pcBuffer,
+                                     size_t xBufferLength,
+                                     BaseType_t xFormat ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
 /**
  * task. h
  * @code{c}
@@ -90,6 +90,27 @@ static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert ) PRIVILEG
  */
 static void prvHeapInit( void ) PRIVILEGED_FUNCTION;
 
+
+#if ( configUSE_HEAP_FRAG_STATS == 1 )
+
+/*
+ * Walks the list of free blocks to find the largest block and the number of
+ * blocks, and optionally count the blocks in each size class.  Must be called
+ * with the scheduler suspended.
+ */
+    static void prvWalkFreeList( size_t * pxLargest,
+                                 size_t * pxBlocks,
+                                 size_t * pxFreeBlocksBySize ) PRIVILEGED_FUNCTION;
+
+/*
+ * Updates the request histograms, and logs the state of the heap if the
+ * request failed.  Called by pvPortMalloc() with the scheduler suspended.
+ */
+    static void prvRecordRequest( size_t xRequestedSize,
+                                  const void * pvReturn ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*-----------------------------------------------------------*/
 
 /* The size of the structure placed at the beginning of each allocated memory
@@ -112,6 +133,19 @@ PRIVILEGED_DATA static size_t xNumberOfSuccessfulFrees = 0;
  * space. */
 PRIVILEGED_DATA static size_t xBlockAllocatedBit = 0;
 
+#if ( configUSE_HEAP_FRAG_STATS == 1 )
+
+/* The data returned by vPortGetHeapFragStats().  xNumberOfFailures also
+ * counts the failures that have been overwritten in the circular log. */
+    PRIVILEGED_DATA static size_t xRequestsBySize[ configHEAP_FRAG_SIZE_CLASSES ] = { 0 };
+    PRIVILEGED_DATA static size_t xFailuresBySize[ configHEAP_FRAG_SIZE_CLASSES ] = { 0 };
+    PRIVILEGED_DATA static size_t xLargestRequest = 0;
+    PRIVILEGED_DATA static uint16_t usWorstFragmentation = 0;
+    PRIVILEGED_DATA static size_t xNumberOfFailures = 0;
+    PRIVILEGED_DATA static HeapFailure_t xFailureLog[ configHEAP_FAILURE_LOG_LENGTH ];
+
+#endif
+
 /*-----------------------------------------------------------*/
 
 void * pvPortMalloc( size_t xWantedSize )
@@ -119,6 +153,10 @@ void * pvPortMalloc( size_t xWantedSize )
     BlockLink_t * pxBlock, * pxPreviousBlock, * pxNewBlockLink;
     void * pvReturn = NULL;
 
+    #if ( configUSE_HEAP_FRAG_STATS == 1 )
+        const size_t xRequestedSize = xWantedSize;
+    #endif
+
     vTaskSuspendAll();
     {
         /* If this is the first call to malloc then the heap will require
@@ -251,6 +289,12 @@ void * pvPortMalloc( size_t xWantedSize )
             mtCOVERAGE_TEST_MARKER();
         }
 
+        #if ( configUSE_HEAP_FRAG_STATS == 1 )
+            {
+                prvRecordRequest( xRequestedSize, pvReturn );
+            }
+        #endif
+
         traceMALLOC( pvReturn, xWantedSize );
     }
     ( void ) xTaskResumeAll();
@@ -502,3 +546,190 @@ void vPortGetHeapStats( HeapStats_t * pxHeapStats )
     }
     taskEXIT_CRITICAL();
 }
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_HEAP_FRAG_STATS == 1 )
+
+    static size_t prvSizeClass( size_t xSize )
+    {
+        size_t xClass = 0;
+
+        /* Class 0 is below 32 bytes, and each class after that is twice as
+         * wide as the one before. */
+        xSize >>= 5;
+
+        while( ( xSize != 0 ) && ( xClass < ( size_t ) ( configHEAP_FRAG_SIZE_CLASSES - 1 ) ) )
+        {
+            xSize >>= 1;
+            xClass++;
+        }
+
+        return xClass;
+    }
+/*-----------------------------------------------------------*/
+
+    static uint16_t prvFragmentation( size_t xLargest )
+    {
+        uint16_t usFragmentation = 0;
+
+        if( xFreeBytesRemaining > xLargest )
+        {
+            usFragmentation = ( uint16_t ) ( ( ( uint64_t ) ( xFreeBytesRemaining - xLargest ) * 10000U ) / xFreeBytesRemaining );
+        }
+
+        return usFragmentation;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvWalkFreeList( size_t * pxLargest,
+                                 size_t * pxBlocks,
+                                 size_t * pxFreeBlocksBySize ) /* PRIVILEGED_FUNCTION */
+    {
+        BlockLink_t * pxBlock;
+        size_t xBlocks = 0, xMaxSize = 0;
+
+        pxBlock = xStart.pxNextFreeBlock;
+
+        /* pxBlock will be NULL if the heap has not been initialised. */
+        if( pxBlock != NULL )
+        {
+            while( pxBlock != pxEnd )
+            {
+                xBlocks++;
+
+                if( pxBlock->xBlockSize > xMaxSize )
+                {
+                    xMaxSize = pxBlock->xBlockSize;
+                }
+
+                if( pxFreeBlocksBySize != NULL )
+                {
+                    pxFreeBlocksBySize[ prvSizeClass( pxBlock->xBlockSize ) ]++;
+                }
+
+                pxBlock = pxBlock->pxNextFreeBlock;
+            }
+        }
+
+        *pxLargest = xMaxSize;
+        *pxBlocks = xBlocks;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvRecordRequest( size_t xRequestedSize,
+                                  const void * pvReturn ) /* PRIVILEGED_FUNCTION */
+    {
+        HeapFailure_t * pxFailure;
+        size_t xClass;
+        uint16_t usFragmentation;
+
+        /* pvPortMalloc( 0 ) always returns NULL, which is not a failure. */
+        if( xRequestedSize == 0 )
+        {
+            return;
+        }
+
+        xClass = prvSizeClass( xRequestedSize );
+        xRequestsBySize[ xClass ]++;
+
+        if( xRequestedSize > xLargestRequest )
+        {
+            xLargestRequest = xRequestedSize;
+        }
+
+        if( pvReturn == NULL )
+        {
+            xFailuresBySize[ xClass ]++;
+
+            /* Overwrite the oldest entry once the log is full. */
+            pxFailure = &( xFailureLog[ xNumberOfFailures % ( size_t ) configHEAP_FAILURE_LOG_LENGTH ] );
+            xNumberOfFailures++;
+
+            prvWalkFreeList( &( pxFailure->xSizeOfLargestFreeBlockInBytes ), &( pxFailure->xNumberOfFreeBlocks ), NULL );
+            pxFailure->xRequestedSize = xRequestedSize;
+            pxFailure->xAvailableHeapSpaceInBytes = xFreeBytesRemaining;
+            pxFailure->xTimeInTicks = xTaskGetTickCount();
+
+            usFragmentation = prvFragmentation( pxFailure->xSizeOfLargestFreeBlockInBytes );
+
+            if( usFragmentation > usWorstFragmentation )
+            {
+                usWorstFragmentation = usFragmentation;
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortGetHeapFragStats( HeapFragStats_t * pxHeapFragStats )
+    {
+        size_t x, xLargest, xBlocks, xFirst, xLogged;
+
+        configASSERT( pxHeapFragStats );
+
+        for( x = 0; x < ( size_t ) configHEAP_FRAG_SIZE_CLASSES; x++ )
+        {
+            pxHeapFragStats->xFreeBlocksBySize[ x ] = 0;
+        }
+
+        vTaskSuspendAll();
+        {
+            prvWalkFreeList( &xLargest, &xBlocks, pxHeapFragStats->xFreeBlocksBySize );
+
+            pxHeapFragStats->usFragmentation = prvFragmentation( xLargest );
+
+            if( pxHeapFragStats->usFragmentation > usWorstFragmentation )
+            {
+                usWorstFragmentation = pxHeapFragStats->usFragmentation;
+            }
+
+            for( x = 0; x < ( size_t ) configHEAP_FRAG_SIZE_CLASSES; x++ )
+            {
+                pxHeapFragStats->xRequestsBySize[ x ] = xRequestsBySize[ x ];
+                pxHeapFragStats->xFailuresBySize[ x ] = xFailuresBySize[ x ];
+            }
+
+            pxHeapFragStats->xLargestRequest = xLargestRequest;
+            pxHeapFragStats->usWorstFragmentation = usWorstFragmentation;
+            pxHeapFragStats->xNumberOfFailures = xNumberOfFailures;
+
+            /* Copy the log oldest first. */
+            if( xNumberOfFailures > ( size_t ) configHEAP_FAILURE_LOG_LENGTH )
+            {
+                xFirst = xNumberOfFailures % ( size_t ) configHEAP_FAILURE_LOG_LENGTH;
+                xLogged = ( size_t ) configHEAP_FAILURE_LOG_LENGTH;
+            }
+            else
+            {
+                xFirst = 0;
+                xLogged = xNumberOfFailures;
+            }
+
+            for( x = 0; x < xLogged; x++ )
+            {
+                pxHeapFragStats->xFailures[ x ] = xFailureLog[ ( xFirst + x ) % ( size_t ) configHEAP_FAILURE_LOG_LENGTH ];
+            }
+        }
+        ( void ) xTaskResumeAll();
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortResetHeapFragStats( void )
+    {
+        size_t x;
+
+        vTaskSuspendAll();
+        {
+            for( x = 0; x < ( size_t ) configHEAP_FRAG_SIZE_CLASSES; x++ )
+            {
+                xRequestsBySize[ x ] = 0;
+                xFailuresBySize[ x ] = 0;
+            }
+
+            xLargestRequest = 0;
+            usWorstFragmentation = 0;
+            xNumberOfFailures = 0;
+        }
+        ( void ) xTaskResumeAll();
+    }
+
+#endif /* configUSE_HEAP_FRAG_STATS */
@@ -814,6 +814,185 @@ typedef void * MessageBufferHandle_t;
 #define xMessageBufferReceiveCompletedFromISR( xMessageBuffer, pxHigherPriorityTaskWoken ) \
     xStreamBufferReceiveCompletedFromISR( ( StreamBufferHandle_t ) xMessageBuffer, pxHigherPriorityTaskWoken )
 
+/**
+ * message_buffer.h
+ *
+ * @code{c}
+ * size_t xMessageBufferSendReserve( MessageBufferHandle_t xMessageBuffer,
+ *                                   size_t xDataLengthBytes,
+ *                                   StreamBufferSpan_t * const pxSpan,
+ *                                   TickType_t xTicksToWait );
+ * @endcode
+ *
+ * The zero copy equivalent of xMessageBufferSend().  Reserves space for a
+ * message of up to xDataLengthBytes bytes in the message buffer's own storage
+ * area and describes it in pxSpan (as two spans if the space wraps around the
+ * end of the storage area).  The message is written there in place and then
+ * published with xMessageBufferSendCommit(), which also stores its length.
+ * Either space for the whole message is reserved or nothing is reserved.
+ *
+ * The single writer restriction described for xMessageBufferSend() applies
+ * until the message has been committed.
+ *
+ * @return The number of bytes reserved - either xDataLengthBytes or 0.
+ *
+ * \defgroup xMessageBufferSendReserve xMessageBufferSendReserve
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferSendReserve( xMessageBuffer, xDataLengthBytes, pxSpan, xTicksToWait ) \
+    xStreamBufferSendReserve( ( StreamBufferHandle_t ) xMessageBuffer, xDataLengthBytes, pxSpan, xTicksToWait )
+
+#define xMessageBufferSendReserveFromISR( xMessageBuffer, xDataLengthBytes, pxSpan ) \
+    xStreamBufferSendReserveFromISR( ( StreamBufferHandle_t ) xMessageBuffer, xDataLengthBytes, pxSpan )
+
+/**
+ * message_buffer.h
+ *
+ * @code{c}
+ * size_t xMessageBufferSendCommit( MessageBufferHandle_t xMessageBuffer,
+ *                                  size_t xDataLengthBytes );
+ * @endcode
+ *
+ * Publishes a message previously written in place into the region returned by
+ * xMessageBufferSendReserve().  xDataLengthBytes is the length of the message
+ * and must not exceed the number of bytes reserved.  Committing 0 bytes
+ * abandons the reservation.
+ *
+ * @return The length of the message committed.
+ *
+ * \defgroup xMessageBufferSendCommit xMessageBufferSendCommit
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferSendCommit( xMessageBuffer, xDataLengthBytes ) \
+    xStreamBufferSendCommit( ( StreamBufferHandle_t ) xMessageBuffer, xDataLengthBytes )
+
+#define xMessageBufferSendCommitFromISR( xMessageBuffer, xDataLengthBytes, pxHigherPriorityTaskWoken ) \
+    xStreamBufferSendCommitFromISR( ( StreamBufferHandle_t ) xMessageBuffer, xDataLengthBytes, pxHigherPriorityTaskWoken )
+
+/**
+ * message_buffer.h
+ *
+ * @code{c}
+ * size_t xMessageBufferReceivePeek( MessageBufferHandle_t xMessageBuffer,
+ *                                   StreamBufferSpan_t * const pxSpan,
+ *                                   TickType_t xTicksToWait );
+ * @endcode
+ *
+ * The zero copy equivalent of xMessageBufferReceive().  Describes the next
+ * message in place in pxSpan, without copying it out of the message buffer.
+ * The message stays in the message buffer until xMessageBufferReceiveConsume()
+ * is called.
+ *
+ * @return The length of the next message, or 0 if no message arrived within
+ * xTicksToWait ticks.
+ *
+ * \defgroup xMessageBufferReceivePeek xMessageBufferReceivePeek
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferReceivePeek( xMessageBuffer, pxSpan, xTicksToWait ) \
+    xStreamBufferReceivePeek( ( StreamBufferHandle_t ) xMessageBuffer, pxSpan, xTicksToWait )
+
+#define xMessageBufferReceivePeekFromISR( xMessageBuffer, pxSpan ) \
+    xStreamBufferReceivePeekFromISR( ( StreamBufferHandle_t ) xMessageBuffer, pxSpan )
+
+/**
+ * message_buffer.h
+ *
+ * @code{c}
+ * size_t xMessageBufferReceiveConsume( MessageBufferHandle_t xMessageBuffer );
+ * @endcode
+ *
+ * Removes the message previously described by xMessageBufferReceivePeek()
+ * from the message buffer.
+ *
+ * @return The length of the message removed, or 0 if the message buffer was
+ * empty.
+ *
+ * \defgroup xMessageBufferReceiveConsume xMessageBufferReceiveConsume
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferReceiveConsume( xMessageBuffer ) \
+    xStreamBufferReceiveConsume( ( StreamBufferHandle_t ) xMessageBuffer, 0 )
+
+#define xMessageBufferReceiveConsumeFromISR( xMessageBuffer, pxHigherPriorityTaskWoken ) \
+    xStreamBufferReceiveConsumeFromISR( ( StreamBufferHandle_t ) xMessageBuffer, 0, pxHigherPriorityTaskWoken )
+
+#if ( configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS == 1 )
+
+/**
+ * message_buffer.h
+ *
+ * @code{c}
+ * MessageBufferHandle_t xMessageBufferCreateMultiProducer( size_t xBufferSizeBytes );
+ *
+ * MessageBufferHandle_t xMessageBufferCreateMultiProducerStatic( size_t xBufferSizeBytes,
+ *                                                                uint8_t *pucMessageBufferStorageArea,
+ *                                                                StaticMessageBuffer_t *pxStaticMessageBuffer );
+ * @endcode
+ *
+ * Create a message buffer that, unlike a message buffer created with
+ * xMessageBufferCreate(), can be written by any number of tasks and
+ * interrupts without the writes being placed in a critical section or
+ * protected by a mutex.  There must still only be one reader.
+ *
+ * Writers use xMessageBufferSend(), xMessageBufferSendFromISR(), or the zero
+ * copy xMessageBufferMultiProducerReserve() and
+ * xMessageBufferMultiProducerCommit().  Writers never block - the
+ * xTicksToWait parameter of xMessageBufferSend() is ignored, and a write that
+ * does not fit returns 0.  The reader uses the normal receive functions.
+ *
+ * Internally each writer claims its space by moving an index with LDREX/STREX,
+ * and a commit moves the reader's index past the completed messages one
+ * message per LDREX/STREX step, so writers never mask interrupts.  The reader
+ * zeroes each message as it removes it.  Messages are received in the order
+ * in which their space was claimed.
+ *
+ * The zero copy xMessageBufferSendReserve() and xMessageBufferSendCommit()
+ * functions cannot be used with a multi producer message buffer.
+ *
+ * configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS must be set to 1 in
+ * FreeRTOSConfig.h for these macros to be available.
+ *
+ * Example use:
+ * @code{c}
+ * MessageBufferHandle_t xLogBuffer;
+ *
+ * void vAnInterruptHandler( void )
+ * {
+ * StreamBufferSpan_t xSpan;
+ * BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+ *
+ *  if( xMessageBufferMultiProducerReserve( xLogBuffer, 8, &xSpan ) != 0 )
+ *  {
+ *      // Write the 8 byte message into xSpan.pucFirst (xSpan.xFirstLength
+ *      // bytes) and xSpan.pucSecond (xSpan.xSecondLength bytes) here.
+ *
+ *      xMessageBufferMultiProducerCommitFromISR( xLogBuffer, &xSpan, &xHigherPriorityTaskWoken );
+ *  }
+ *
+ *  portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+ * }
+ * @endcode
+ * \defgroup xMessageBufferCreateMultiProducer xMessageBufferCreateMultiProducer
+ * \ingroup MessageBufferManagement
+ */
+    #define xMessageBufferCreateMultiProducer( xBufferSizeBytes ) \
+    ( MessageBufferHandle_t ) xStreamBufferGenericCreate( xBufferSizeBytes, ( size_t ) 0, sbTYPE_MULTI_PRODUCER_MESSAGE_BUFFER )
+
+    #define xMessageBufferCreateMultiProducerStatic( xBufferSizeBytes, pucMessageBufferStorageArea, pxStaticMessageBuffer ) \
+    ( MessageBufferHandle_t ) xStreamBufferGenericCreateStatic( xBufferSizeBytes, 0, sbTYPE_MULTI_PRODUCER_MESSAGE_BUFFER, pucMessageBufferStorageArea, pxStaticMessageBuffer )
+
+    #define xMessageBufferMultiProducerReserve( xMessageBuffer, xDataLengthBytes, pxSpan ) \
+    xStreamBufferMultiProducerReserve( ( StreamBufferHandle_t ) xMessageBuffer, xDataLengthBytes, pxSpan )
+
+    #define xMessageBufferMultiProducerCommit( xMessageBuffer, pxSpan ) \
+    xStreamBufferMultiProducerCommit( ( StreamBufferHandle_t ) xMessageBuffer, pxSpan )
+
+    #define xMessageBufferMultiProducerCommitFromISR( xMessageBuffer, pxSpan, pxHigherPriorityTaskWoken ) \
+    xStreamBufferMultiProducerCommitFromISR( ( StreamBufferHandle_t ) xMessageBuffer, pxSpan, pxHigherPriorityTaskWoken )
+
+#endif /* configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS */
+
 /* *INDENT-OFF* */
 #if defined( __cplusplus )
     } /* extern "C" */
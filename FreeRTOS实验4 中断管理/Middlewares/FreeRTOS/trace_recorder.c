@@ -0,0 +1,531 @@
+/*
+ * FreeRTOS Kernel V10.4.6
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Binary kernel event trace recorder - see trace_recorder.h. */
+
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "trace_ring.h"
+
+#if ( configUSE_TRACE_RECORDER == 1 )
+
+#if ( ( configTRACE_RECORDER_BUFFER_RECORDS & ( configTRACE_RECORDER_BUFFER_RECORDS - 1 ) ) != 0 )
+    #error configTRACE_RECORDER_BUFFER_RECORDS must be a power of 2.
+#endif
+
+#define trcRECORD_MASK          ( ( uint32_t ) configTRACE_RECORDER_BUFFER_RECORDS - 1U )
+#define trcRECORDS_PER_FRAME    32U
+#define trcFORMAT_VERSION       1U
+#define trcRESYNC_PERIOD_MS     2000U   /* Stream mode resends the header and symbols this often. */
+#define trcMAX_EXCLUDED         4U      /* Objects vTraceExcludeObject() can hide. */
+
+/* The DWT cycle counter provides the timestamps. */
+#define trcTIMESTAMP()          ( DWT->CYCCNT )
+
+/* 16 bit object identifier.  RAM objects are word aligned, so dropping the two
+ * low bits keeps identifiers unique across 256KB of RAM. */
+#define trcOBJECT_ID( pv )      ( ( uint16_t ) ( ( ( uint32_t ) ( pv ) ) >> 2 ) )
+
+typedef struct TraceRecord
+{
+    uint32_t ulTimestamp; /* DWT cycle count, or the value of a trcEVT_PARAM record. */
+    uint8_t ucEvent;      /* trcEVT_xxx, written last to commit the record. */
+    uint8_t ucArg;
+    uint16_t usObject;
+} TraceRecord_t;
+
+typedef struct TraceSymbol
+{
+    uint16_t usObject;
+    uint8_t ucKind;       /* trcOBJ_xxx, written last to commit the entry. */
+    uint8_t ucArg;
+    char cName[ configMAX_TASK_NAME_LEN ];
+} TraceSymbol_t;
+
+/* Everything the recorder owns lives in one structure so a debugger can dump
+ * it in one go after a crash. */
+typedef struct TraceRecorder
+{
+    TraceRing_t xRing;             /* Records reserved, and in stream mode records sent and records lost. */
+    volatile uint32_t ulSymbols;   /* Symbol table entries reserved so far. */
+    volatile uint32_t ulExcluded;  /* Entries used in usExcluded. */
+    volatile uint16_t usExcluded[ trcMAX_EXCLUDED ];
+    volatile uint8_t ucRunning;
+    volatile TraceRecord_t xRecords[ configTRACE_RECORDER_BUFFER_RECORDS ];
+    volatile TraceSymbol_t xSymbols[ configTRACE_RECORDER_MAX_SYMBOLS ];
+} TraceRecorder_t;
+
+static TraceRecorder_t xTraceRecorder;
+
+/* Frame assembly buffer, used by the stream task and by vTraceSnapshotDump(). */
+static uint8_t ucTraceFrame[ ringFRAME_OVERHEAD + ( trcRECORDS_PER_FRAME * sizeof( TraceRecord_t ) ) ];
+
+#if ( configTRACE_RECORDER_MODE == trcMODE_STREAM )
+    static TaskHandle_t xTraceStreamTask = NULL;
+#endif
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Claim ulSlots consecutive records and timestamp the first one.  Returns the
+ * index of the first slot, or -1 if the ring is full in stream mode.
+ */
+static int32_t prvTraceReserve( uint32_t ulSlots,
+                                uint32_t * pulTimestamp )
+{
+    return lTraceRingReserve( &( xTraceRecorder.xRing ), ( uint32_t ) configTRACE_RECORDER_BUFFER_RECORDS, ulSlots,
+                              ( configTRACE_RECORDER_MODE == trcMODE_STREAM ) ? pdTRUE : pdFALSE, pulTimestamp );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Recording stops while the recorder is disabled, and events on excluded
+ * objects are skipped.
+ */
+static BaseType_t prvTraceFiltered( const void * pvObject )
+{
+    uint16_t usObject;
+    uint32_t x;
+
+    if( xTraceRecorder.ucRunning == 0U )
+    {
+        return pdTRUE;
+    }
+
+    if( xTraceRecorder.ulExcluded != 0U )
+    {
+        usObject = trcOBJECT_ID( pvObject );
+
+        for( x = 0U; x < xTraceRecorder.ulExcluded; x++ )
+        {
+            if( xTraceRecorder.usExcluded[ x ] == usObject )
+            {
+                return pdTRUE;
+            }
+        }
+    }
+
+    return pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+void vTraceExcludeObject( const void * pvObject )
+{
+    taskENTER_CRITICAL();
+    {
+        if( ( pvObject != NULL ) && ( xTraceRecorder.ulExcluded < trcMAX_EXCLUDED ) )
+        {
+            xTraceRecorder.usExcluded[ xTraceRecorder.ulExcluded ] = trcOBJECT_ID( pvObject );
+            xTraceRecorder.ulExcluded++;
+        }
+    }
+    taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecord( uint32_t ulEvent,
+                   uint32_t ulArg,
+                   const void * pvObject )
+{
+    volatile TraceRecord_t * pxRecord;
+    uint32_t ulTimestamp;
+    int32_t lSlot;
+
+    if( prvTraceFiltered( pvObject ) != pdFALSE )
+    {
+        return;
+    }
+
+    lSlot = prvTraceReserve( 1U, &ulTimestamp );
+
+    if( lSlot >= 0 )
+    {
+        pxRecord = &( xTraceRecorder.xRecords[ lSlot ] );
+        pxRecord->ulTimestamp = ulTimestamp;
+        pxRecord->usObject = trcOBJECT_ID( pvObject );
+        pxRecord->ucArg = ( uint8_t ) ulArg;
+        pxRecord->ucEvent = ( uint8_t ) ulEvent;
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecordParam( uint32_t ulEvent,
+                        uint32_t ulArg,
+                        const void * pvObject,
+                        uint32_t ulParam )
+{
+    volatile TraceRecord_t * pxRecord;
+    volatile TraceRecord_t * pxParam;
+    uint32_t ulTimestamp;
+    int32_t lSlot;
+
+    if( prvTraceFiltered( pvObject ) != pdFALSE )
+    {
+        return;
+    }
+
+    lSlot = prvTraceReserve( 2U, &ulTimestamp );
+
+    if( lSlot >= 0 )
+    {
+        pxRecord = &( xTraceRecorder.xRecords[ lSlot ] );
+        pxParam = &( xTraceRecorder.xRecords[ ( ( uint32_t ) lSlot + 1U ) & trcRECORD_MASK ] );
+
+        /* The parameter record is complete before the event record commits, so
+         * a reader that sees the event always sees its parameter too. */
+        pxParam->ulTimestamp = ulParam;
+        pxParam->usObject = 0U;
+        pxParam->ucArg = 0U;
+        pxParam->ucEvent = trcEVT_PARAM;
+
+        pxRecord->ulTimestamp = ulTimestamp;
+        pxRecord->usObject = trcOBJECT_ID( pvObject );
+        pxRecord->ucArg = ( uint8_t ) ulArg;
+        pxRecord->ucEvent = ( uint8_t ) ulEvent;
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vTraceObjectName( const void * pvObject,
+                       uint32_t ulKind,
+                       uint32_t ulArg,
+                       const char * pcName )
+{
+    volatile TraceSymbol_t * pxSymbol;
+    uint32_t ulIndex;
+    uint32_t x;
+
+    if( ( xTraceRecorder.ucRunning == 0U ) || ( pcName == NULL ) ||
+        ( xTraceRecorder.ulSymbols >= ( uint32_t ) configTRACE_RECORDER_MAX_SYMBOLS ) )
+    {
+        return;
+    }
+
+    ulIndex = ulTraceRingAtomicAdd( &( xTraceRecorder.ulSymbols ), 1U );
+
+    if( ulIndex >= ( uint32_t ) configTRACE_RECORDER_MAX_SYMBOLS )
+    {
+        /* The table is full.  The object still appears in the trace, only
+         * without a name. */
+        xTraceRecorder.ulSymbols = configTRACE_RECORDER_MAX_SYMBOLS;
+        return;
+    }
+
+    pxSymbol = &( xTraceRecorder.xSymbols[ ulIndex ] );
+    pxSymbol->usObject = trcOBJECT_ID( pvObject );
+    pxSymbol->ucArg = ( uint8_t ) ulArg;
+
+    for( x = 0U; x < ( uint32_t ) configMAX_TASK_NAME_LEN; x++ )
+    {
+        pxSymbol->cName[ x ] = pcName[ x ];
+
+        if( pcName[ x ] == '\0' )
+        {
+            break;
+        }
+    }
+
+    pxSymbol->ucKind = ( uint8_t ) ulKind;
+}
+/*-----------------------------------------------------------*/
+
+void vTraceISREnter( void )
+{
+    vTraceRecord( trcEVT_ISR_ENTER, __get_IPSR(), NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vTraceISRExit( void )
+{
+    vTraceRecord( trcEVT_ISR_EXIT, __get_IPSR(), NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vTraceUserEvent( uint8_t ucCode,
+                      uint32_t ulValue )
+{
+    vTraceRecordParam( trcEVT_USER, ucCode, NULL, ulValue );
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulTraceGetDropped( void )
+{
+    return xTraceRecorder.xRing.ulDropped;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Wrap the usLength payload bytes already at ucTraceFrame[ 7 ] in a frame and
+ * write it out.
+ */
+static void prvTraceSendFrame( uint8_t ucType,
+                               uint16_t usLength )
+{
+    configTRACE_RECORDER_WRITE( ucTraceFrame, usTraceRingFrame( ucTraceFrame, "TR", ucType, usLength ) );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Header payload: version, record size, mode, reserved, CPU clock in Hz, tick
+ * rate in Hz, dropped record count and ring size in records.
+ */
+static void prvTraceSendHeader( void )
+{
+    uint8_t * pucPayload = &( ucTraceFrame[ 7 ] );
+
+    pucPayload[ 0 ] = trcFORMAT_VERSION;
+    pucPayload[ 1 ] = ( uint8_t ) sizeof( TraceRecord_t );
+    pucPayload[ 2 ] = ( uint8_t ) configTRACE_RECORDER_MODE;
+    pucPayload[ 3 ] = 0U;
+    vTraceRingPut32( &( pucPayload[ 4 ] ), ( uint32_t ) configCPU_CLOCK_HZ );
+    vTraceRingPut32( &( pucPayload[ 8 ] ), ( uint32_t ) configTICK_RATE_HZ );
+    vTraceRingPut32( &( pucPayload[ 12 ] ), xTraceRecorder.xRing.ulDropped );
+    vTraceRingPut32( &( pucPayload[ 16 ] ), ( uint32_t ) configTRACE_RECORDER_BUFFER_RECORDS );
+
+    prvTraceSendFrame( trcFRAME_HEADER, 20U );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Symbol payload: object identifier, kind, argument (task priority) and the
+ * name without its terminator.  Sends the committed entries from uxFirst on
+ * and returns the index of the first entry not sent.
+ */
+static UBaseType_t prvTraceSendSymbols( UBaseType_t uxFirst )
+{
+    volatile TraceSymbol_t * pxSymbol;
+    uint8_t * pucPayload = &( ucTraceFrame[ 7 ] );
+    UBaseType_t x;
+    uint16_t usLength;
+
+    for( x = uxFirst; x < ( UBaseType_t ) configTRACE_RECORDER_MAX_SYMBOLS; x++ )
+    {
+        pxSymbol = &( xTraceRecorder.xSymbols[ x ] );
+
+        if( pxSymbol->ucKind == 0U )
+        {
+            break;
+        }
+
+        pucPayload[ 0 ] = ( uint8_t ) pxSymbol->usObject;
+        pucPayload[ 1 ] = ( uint8_t ) ( pxSymbol->usObject >> 8 );
+        pucPayload[ 2 ] = pxSymbol->ucKind;
+        pucPayload[ 3 ] = pxSymbol->ucArg;
+
+        for( usLength = 0U; usLength < ( uint16_t ) configMAX_TASK_NAME_LEN; usLength++ )
+        {
+            if( pxSymbol->cName[ usLength ] == '\0' )
+            {
+                break;
+            }
+
+            pucPayload[ 4U + usLength ] = ( uint8_t ) pxSymbol->cName[ usLength ];
+        }
+
+        prvTraceSendFrame( trcFRAME_SYMBOL, ( uint16_t ) ( usLength + 4U ) );
+    }
+
+    return x;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Snapshot dump: the header, every symbol, then the ring from the oldest
+ * record to the newest.  Recording is stopped first so the ring holds still.
+ * Can be called from a fault handler as long as configTRACE_RECORDER_WRITE()
+ * works with interrupts disabled.
+ */
+void vTraceSnapshotDump( void )
+{
+    uint32_t ulHead;
+    uint32_t ulIndex;
+    uint16_t usCount = 0U;
+
+    vTraceStop();
+
+    prvTraceSendHeader();
+    ( void ) prvTraceSendSymbols( 0U );
+
+    ulHead = xTraceRecorder.xRing.ulHead;
+    ulIndex = ( ulHead > ( uint32_t ) configTRACE_RECORDER_BUFFER_RECORDS ) ? ( ulHead - ( uint32_t ) configTRACE_RECORDER_BUFFER_RECORDS ) : 0U;
+
+    #if ( configTRACE_RECORDER_MODE == trcMODE_STREAM )
+        {
+            ulIndex = xTraceRecorder.xRing.ulTail;
+        }
+    #endif
+
+    for( ; ulIndex != ulHead; ulIndex++ )
+    {
+        if( xTraceRecorder.xRecords[ ulIndex & trcRECORD_MASK ].ucEvent == trcEVT_NONE )
+        {
+            continue;
+        }
+
+        memcpy( &( ucTraceFrame[ 7U + ( usCount * sizeof( TraceRecord_t ) ) ] ),
+                ( const void * ) &( xTraceRecorder.xRecords[ ulIndex & trcRECORD_MASK ] ), sizeof( TraceRecord_t ) );
+
+        if( ++usCount == trcRECORDS_PER_FRAME )
+        {
+            prvTraceSendFrame( trcFRAME_EVENTS, ( uint16_t ) ( usCount * sizeof( TraceRecord_t ) ) );
+            usCount = 0U;
+        }
+    }
+
+    if( usCount != 0U )
+    {
+        prvTraceSendFrame( trcFRAME_EVENTS, ( uint16_t ) ( usCount * sizeof( TraceRecord_t ) ) );
+    }
+}
+/*-----------------------------------------------------------*/
+
+#if ( configTRACE_RECORDER_MODE == trcMODE_STREAM )
+
+/*
+ * Send the committed records at the tail of the ring in frames, freeing the
+ * slots as they are copied.  Stops at the first slot whose writer has reserved
+ * it but not finished yet.
+ */
+    static void prvTraceDrain( void )
+    {
+        volatile TraceRecord_t * pxRecord;
+        uint16_t usCount;
+
+        do
+        {
+            usCount = 0U;
+
+            while( ( usCount < trcRECORDS_PER_FRAME ) && ( xTraceRecorder.xRing.ulTail != xTraceRecorder.xRing.ulHead ) )
+            {
+                pxRecord = &( xTraceRecorder.xRecords[ xTraceRecorder.xRing.ulTail & trcRECORD_MASK ] );
+
+                if( pxRecord->ucEvent == trcEVT_NONE )
+                {
+                    break;
+                }
+
+                memcpy( &( ucTraceFrame[ 7U + ( usCount * sizeof( TraceRecord_t ) ) ] ), ( const void * ) pxRecord, sizeof( TraceRecord_t ) );
+                pxRecord->ucEvent = trcEVT_NONE;
+                xTraceRecorder.xRing.ulTail++;
+                usCount++;
+            }
+
+            if( usCount != 0U )
+            {
+                prvTraceSendFrame( trcFRAME_EVENTS, ( uint16_t ) ( usCount * sizeof( TraceRecord_t ) ) );
+            }
+        } while( usCount == trcRECORDS_PER_FRAME );
+    }
+/*-----------------------------------------------------------*/
+
+/*
+ * Report records dropped since the last report as a trcEVT_DROPPED event
+ * sent straight out, since the ring may still be full.
+ */
+    static void prvTraceReportDropped( uint32_t * pulReported )
+    {
+        uint32_t ulDropped = xTraceRecorder.xRing.ulDropped;
+        uint8_t * pucPayload = &( ucTraceFrame[ 7 ] );
+
+        if( ulDropped != *pulReported )
+        {
+            vTraceRingPut32( &( pucPayload[ 0 ] ), trcTIMESTAMP() );
+            pucPayload[ 4 ] = trcEVT_DROPPED;
+            pucPayload[ 5 ] = 0U;
+            pucPayload[ 6 ] = 0U;
+            pucPayload[ 7 ] = 0U;
+            vTraceRingPut32( &( pucPayload[ 8 ] ), ulDropped - *pulReported );
+            pucPayload[ 12 ] = trcEVT_PARAM;
+            pucPayload[ 13 ] = 0U;
+            pucPayload[ 14 ] = 0U;
+            pucPayload[ 15 ] = 0U;
+            prvTraceSendFrame( trcFRAME_EVENTS, 2U * sizeof( TraceRecord_t ) );
+            *pulReported = ulDropped;
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvTraceStreamTask( void * pvParameters )
+    {
+        TickType_t xLastResync;
+        UBaseType_t uxSymbolsSent = 0U;
+        uint32_t ulReported = 0U;
+
+        ( void ) pvParameters;
+
+        prvTraceSendHeader();
+        xLastResync = xTaskGetTickCount();
+
+        for( ; ; )
+        {
+            /* A host that attaches late needs the header and every name, so
+             * they are repeated now and then. */
+            if( ( xTaskGetTickCount() - xLastResync ) >= pdMS_TO_TICKS( trcRESYNC_PERIOD_MS ) )
+            {
+                prvTraceSendHeader();
+                uxSymbolsSent = 0U;
+                xLastResync = xTaskGetTickCount();
+            }
+
+            uxSymbolsSent = prvTraceSendSymbols( uxSymbolsSent );
+            prvTraceDrain();
+            prvTraceReportDropped( &ulReported );
+
+            vTaskDelay( pdMS_TO_TICKS( configTRACE_STREAM_PERIOD_MS ) );
+        }
+    }
+
+#endif /* configTRACE_RECORDER_MODE == trcMODE_STREAM */
+/*-----------------------------------------------------------*/
+
+void vTraceEnable( void )
+{
+    portENABLE_CYCLE_COUNTER();
+
+    xTraceRecorder.ucRunning = 1U;
+
+    #if ( configTRACE_RECORDER_MODE == trcMODE_STREAM )
+        {
+            if( xTraceStreamTask == NULL )
+            {
+                ( void ) xTaskCreate( prvTraceStreamTask, "Trace", configTRACE_STREAM_TASK_STACK_DEPTH, NULL,
+                                      configTRACE_STREAM_TASK_PRIORITY, &xTraceStreamTask );
+            }
+        }
+    #endif
+}
+/*-----------------------------------------------------------*/
+
+void vTraceStop( void )
+{
+    xTraceRecorder.ucRunning = 0U;
+}
+
+#endif /* configUSE_TRACE_RECORDER == 1 */
@@ -49,6 +49,10 @@ TaskHandle_t start_task_handler;
 #define TASK1_STACK_SIZE   128  //128 * 4 Byte
 TaskHandle_t task1_handler;
 
+#if configUSE_CRITICAL_PROFILER
+static char g_critical_report[512];    /* 关中断时间统计结果 */
+#endif
+
 
 //task1
 void task1( void * pvParameters )
@@ -64,6 +68,10 @@ void task1( void * pvParameters )
             delay_ms(5000); //5s
             printf("开中断 ing");
             portENABLE_INTERRUPTS(); //开中断
+#if configUSE_CRITICAL_PROFILER
+            vPortCriticalProfilerReport(g_critical_report, sizeof(g_critical_report)); //关中断最久的位置排在最前, 地址对照map文件
+            printf("%s", g_critical_report);
+#endif
 
         }
         
@@ -72,6 +72,10 @@
 #define LCD_DATA_GPIO_CLK_ENABLE()      do{ __HAL_RCC_GPIOB_CLK_ENABLE(); }while(0)   /* 所在IO口时钟使能 */
 
 /* LCD 端口控制函数定义 */
+#ifdef LCD_EMU
+/* 主机仿真编译(见 Tools/lcd_emu), 引脚操作交给控制器仿真器 */
+#include "lcd_emu.h"
+#else
 /* 利用操作寄存器的方式控制IO引脚提高屏幕的刷新率 */
 #define LCD_BL(x)       LCD_BL_GPIO_PORT->BSRR = LCD_BL_GPIO_PIN << (16 * (!x))     /* 设置BL引脚 */
 
@@ -84,6 +88,13 @@
 #define LCD_DATA_OUT(x) LCD_DATA_GPIO_PORT->ODR = x                                 /* 写B0~B15引脚 */
 #define LCD_DATA_IN     LCD_DATA_GPIO_PORT->IDR                                     /* 读B0~B15引脚 */
 
+/* 切换数据线方向, 直接写 CRL/CRH 寄存器, 比 HAL_GPIO_Init 快得多
+ * 输入: CNF=10,MODE=00, 并置 ODR 为全1, 即上拉输入; 输出: CNF=00,MODE=11, 即50MHz推挽输出
+ */
+#define LCD_DATA_MODE_IN()  do{ LCD_DATA_GPIO_PORT->CRL = 0X88888888; LCD_DATA_GPIO_PORT->CRH = 0X88888888; LCD_DATA_GPIO_PORT->ODR = 0XFFFF; }while(0)
+#define LCD_DATA_MODE_OUT() do{ LCD_DATA_GPIO_PORT->CRL = 0X33333333; LCD_DATA_GPIO_PORT->CRH = 0X33333333; }while(0)
+#endif
+
 /******************************************************************************************/
 
 /* LCD重要参数集 */
@@ -165,6 +176,13 @@ extern uint32_t  g_back_color;      /* 背景颜色.默认为白色 */
 #define SSD_VT          (SSD_VER_RESOLUTION + SSD_VER_BACK_PORCH + SSD_VER_FRONT_PORCH)
 #define SSD_VPS         (SSD_VER_BACK_PORCH)
    
+/******************************************************************************************/
+/* 字库相关配置 */
+
+#define LCD_FONT_ROW_MAJOR      1       /* 1, 使用逐行字库 lcdfont_row.h(由 Tools/fontconv 生成), 显示时不用逐位拆字; 0, 使用逐列字库 lcdfont.h */
+#define LCD_GLYPH_CACHE_NUM     0       /* 缓存的字符个数, 0 表示不使用缓存. 非叠加方式显示的字符按颜色展开成RGB565缓存, 再次显示时直接写屏 */
+#define LCD_GLYPH_CACHE_SIZE    16      /* 允许缓存的最大字体, 每个缓存占 size * size 字节 */
+
 /******************************************************************************************/
 /* 函数声明 */
 
@@ -183,6 +201,16 @@ extern uint32_t  g_back_color;      /* 背景颜色.默认为白色 */
         LCD_CS(1);\
     }
 
+/* 连续写GRAM, 调用前需 lcd_write_ram_prepare 并已设置 RS=1, CS=0,
+ * 写完后由调用者恢复 CS=1. 用于开窗后的批量写入
+ */
+#define lcd_wr_pixel(data)\
+    do{\
+        LCD_DATA_OUT(data);\
+        LCD_WR(0);\
+        LCD_WR(1);\
+    }while(0)
+
 void lcd_wr_xdata(uint16_t data);                   /* LCD写数据, 该函数同 lcd_wr_data 函数的功能一模一样 */
 void lcd_wr_regno(volatile uint16_t regno);         /* LCD写寄存器编号/地址 */
 void lcd_write_reg(uint16_t regno, uint16_t data);  /* LCD写寄存器的值 */
@@ -198,6 +226,7 @@ void lcd_ssd_backlight_set(uint8_t pwm);    /* SSD1963 背光控制 */
 void lcd_write_ram_prepare(void);                           /* 准备些GRAM */ 
 void lcd_set_cursor(uint16_t x, uint16_t y);                /* 设置光标 */ 
 uint32_t lcd_read_point(uint16_t x, uint16_t y);            /* 读点(32位颜色,兼容LTDC)  */
+void lcd_read_area(uint16_t sx, uint16_t sy, uint16_t ex, uint16_t ey, uint16_t *color);   /* 读取矩形区域 */
 void lcd_draw_point(uint16_t x, uint16_t y, uint32_t color);/* 画点(32位颜色,兼容LTDC) */
 
 void lcd_clear(uint16_t color);                                                             /* LCD清屏 */
@@ -207,10 +236,12 @@ void lcd_draw_hline(uint16_t x, uint16_t y, uint16_t len, uint16_t color);
 void lcd_set_window(uint16_t sx, uint16_t sy, uint16_t width, uint16_t height);             /* 设置窗口 */
 void lcd_fill(uint16_t sx, uint16_t sy, uint16_t ex, uint16_t ey, uint32_t color);          /* 纯色填充矩形(32位颜色,兼容LTDC) */
 void lcd_color_fill(uint16_t sx, uint16_t sy, uint16_t ex, uint16_t ey, uint16_t *color);   /* 彩色填充矩形 */
+void lcd_color_blit(uint16_t sx, uint16_t sy, uint16_t width, uint16_t height, const uint16_t *color, uint16_t stride);  /* 彩色填充矩形(源数据带行间隔) */
 void lcd_draw_line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color);     /* 画直线 */
 void lcd_draw_rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color);/* 画矩形 */
 
 
+uint8_t lcd_get_glyph(char chr, uint8_t size, uint16_t *rows);                                                        /* 获取字符的行位图 */
 void lcd_show_char(uint16_t x, uint16_t y, char chr, uint8_t size, uint8_t mode, uint16_t color);                       /* 显示一个字符 */
 void lcd_show_num(uint16_t x, uint16_t y, uint32_t num, uint8_t len, uint8_t size, uint16_t color);                     /* 显示数字 */
 void lcd_show_xnum(uint16_t x, uint16_t y, uint32_t num, uint8_t len, uint8_t size, uint8_t mode, uint16_t color);      /* 扩展显示数字 */
@@ -30,7 +30,11 @@
 
 #include "stdlib.h"
 #include "./BSP/LCD/lcd.h"
+#if LCD_FONT_ROW_MAJOR
+#include "./BSP/LCD/lcdfont_row.h"
+#else
 #include "./BSP/LCD/lcdfont.h"
+#endif
 #include "./SYSTEM/usart/usart.h"
 
 
@@ -107,36 +111,38 @@ static void lcd_opt_delay(uint32_t i)
 }
 
 /**
- * @brief       LCD读数据
+ * @brief       LCD总线读一次数据
+ *   @note      调用前数据线须已切换为输入(LCD_DATA_MODE_IN), 且 RS=1, CS=0.
  * @param       无
  * @retval      读取到的数据
  */
-static uint16_t lcd_rd_data(void)
+static uint16_t lcd_rd_bus(void)
 {
     volatile uint16_t ram;  /* 防止被优化 */
-    
-    GPIO_InitTypeDef gpio_init_struct;
-    /* LCD_DATA 引脚模式设置, 上拉输入, 准备接收数据 */
-    gpio_init_struct.Pin = LCD_DATA_GPIO_PIN;
-    gpio_init_struct.Mode = GPIO_MODE_INPUT;
-    gpio_init_struct.Pull = GPIO_PULLUP;
-    gpio_init_struct.Speed = GPIO_SPEED_FREQ_HIGH;
-    HAL_GPIO_Init(LCD_DATA_GPIO_PORT, &gpio_init_struct); 
 
-    LCD_RS(1);              /* RS=1,表示操作数据 */
-    LCD_CS(0);
     LCD_RD(0);
     lcd_opt_delay(2);
     ram = LCD_DATA_IN;      /* 读取数据 */
     LCD_RD(1);
+
+    return ram;
+}
+
+/**
+ * @brief       LCD读数据
+ * @param       无
+ * @retval      读取到的数据
+ */
+static uint16_t lcd_rd_data(void)
+{
+    uint16_t ram;
+
+    LCD_DATA_MODE_IN();     /* LCD_DATA 引脚模式设置, 上拉输入, 准备接收数据 */
+    LCD_RS(1);              /* RS=1,表示操作数据 */
+    LCD_CS(0);
+    ram = lcd_rd_bus();
     LCD_CS(1);
-    
-    /* LCD_DATA 引脚模式设置, 推挽输出, 恢复输出状态 */
-    gpio_init_struct.Pin = LCD_DATA_GPIO_PIN;
-    gpio_init_struct.Mode = GPIO_MODE_OUTPUT_PP;
-    gpio_init_struct.Pull = GPIO_PULLUP;
-    gpio_init_struct.Speed = GPIO_SPEED_FREQ_HIGH;
-    HAL_GPIO_Init(LCD_DATA_GPIO_PORT, &gpio_init_struct);
+    LCD_DATA_MODE_OUT();    /* LCD_DATA 引脚模式设置, 推挽输出, 恢复输出状态 */
 
     return ram;
 }
@@ -173,22 +179,29 @@ uint32_t lcd_read_point(uint16_t x, uint16_t y)
         lcd_wr_regno(0X2E);     /* 9341/5310/1963/7789/7796/9806 等发送读GRAM指令 */
     }
 
-    r = lcd_rd_data();          /* 假读(dummy read) */
+    LCD_DATA_MODE_IN();         /* 数据线切换为输入, 整个读过程只切换一次 */
+    LCD_RS(1);
+    LCD_CS(0);
+    r = lcd_rd_bus();           /* 假读(dummy read) */
 
-    if (lcddev.id == 0x1963)
+    if (lcddev.id != 0x1963 && lcddev.id != 0x7796)
+    {
+        r = lcd_rd_bus();       /* 实际坐标颜色 */
+        b = lcd_rd_bus();       /* ILI9341/NT35310/NT35510/ST7789/ILI9806 要分2次读出 */
+    }
+    else if (lcddev.id == 0x7796)
     {
-        return r;               /* 1963直接读就可以 */
+        r = lcd_rd_bus();       /* 7796 一次读取一个像素值 */
     }
 
-    r = lcd_rd_data();          /* 实际坐标颜色 */
+    LCD_CS(1);
+    LCD_DATA_MODE_OUT();
 
-    if (lcddev.id == 0x7796)    /* 7796 一次读取一个像素值 */
+    if (lcddev.id == 0x1963 || lcddev.id == 0x7796)
     {
-        return r;
+        return r;               /* 1963直接读就可以, 7796 一次读取一个像素值 */
     }
 
-    /* ILI9341/NT35310/NT35510/ST7789/ILI9806 要分2次读出 */
-    b = lcd_rd_data();
     g = r & 0XFF;       /* 对于 9341/5310/5510/7789/9806, 第一次读取的是RG的值,R在前,G在后,各占8位 */
     g <<= 8;
     return (((r >> 11) << 11) | ((g >> 10) << 5) | (b >> 11));  /* 9341/5310/5510/7789/9806 需要公式转换一下 */
@@ -626,6 +639,88 @@ void lcd_set_window(uint16_t sx, uint16_t sy, uint16_t width, uint16_t height)
     }
 }
 
+/**
+ * @brief       恢复全屏窗口
+ *   @note      lcd_set_cursor 对 9341/5310/5510/7789 等IC只设置起始坐标, 结束坐标沿用
+ *              当前窗口, 所以开过小窗口之后必须恢复, 否则 lcd_clear 等按全屏写入的函数会在小窗
+ *              口内回绕.
+ * @param       无
+ * @retval      无
+ */
+static void lcd_reset_window(void)
+{
+    lcd_set_window(0, 0, lcddev.width, lcddev.height);
+}
+
+/**
+ * @brief       读取矩形区域的颜色值
+ *   @note      开一次窗口, 发一次读GRAM指令, 数据线只切换一次方向, 然后连续读出整个区域.
+ *              9341/5310/5510/7789/9806 读出的是 R,G,B 各8位的字节流, 每次读取取出两个字节,
+ *              即每3次读取得到2个点; 7796 每次读取一个点; 1963 没有假读, 每次读取一个点.
+ * @param       (sx,sy),(ex,ey): 矩形对角坐标, 区域大小为:(ex - sx + 1) * (ey - sy + 1)
+ * @param       color: 读出的颜色(RGB565), 按行存放, 至少 (ex - sx + 1) * (ey - sy + 1) 个点
+ * @retval      无
+ */
+void lcd_read_area(uint16_t sx, uint16_t sy, uint16_t ex, uint16_t ey, uint16_t *color)
+{
+    uint32_t num;
+    uint16_t w0, w1, w2;
+
+    if (ex < sx || ey < sy || ex >= lcddev.width || ey >= lcddev.height) return;
+
+    num = (uint32_t)(ex - sx + 1) * (ey - sy + 1);  /* 得到总点数 */
+    lcd_set_window(sx, sy, ex - sx + 1, ey - sy + 1);
+
+    if (lcddev.id == 0X5510)
+    {
+        lcd_wr_regno(0X2E00);   /* 5510 发送读GRAM指令 */
+    }
+    else
+    {
+        lcd_wr_regno(0X2E);     /* 9341/5310/1963/7789/7796/9806 等发送读GRAM指令 */
+    }
+
+    LCD_DATA_MODE_IN();         /* 数据线切换为输入 */
+    LCD_RS(1);
+    LCD_CS(0);
+
+    if (lcddev.id != 0x1963)
+    {
+        lcd_rd_bus();           /* 假读(dummy read) */
+    }
+
+    if (lcddev.id == 0x1963 || lcddev.id == 0x7796)
+    {
+        while (num--)
+        {
+            *color++ = lcd_rd_bus();
+        }
+    }
+    else
+    {
+        while (num >= 2)        /* 3次读取: R0G0, B0R1, G1B1 */
+        {
+            w0 = lcd_rd_bus();
+            w1 = lcd_rd_bus();
+            w2 = lcd_rd_bus();
+            *color++ = ((w0 >> 11) << 11) | (((w0 & 0XFF) >> 2) << 5) | (w1 >> 11);
+            *color++ = (((w1 & 0XFF) >> 3) << 11) | ((w2 >> 10) << 5) | ((w2 & 0XFF) >> 3);
+            num -= 2;
+        }
+
+        if (num)                /* 最后剩一个点: R,G 和 B */
+        {
+            w0 = lcd_rd_bus();
+            w1 = lcd_rd_bus();
+            *color = ((w0 >> 11) << 11) | (((w0 & 0XFF) >> 2) << 5) | (w1 >> 11);
+        }
+    }
+
+    LCD_CS(1);
+    LCD_DATA_MODE_OUT();        /* 恢复输出 */
+    lcd_reset_window();
+}
+
 /**
  * @brief       初始化LCD
  *   @note      该初始化函数可以初始化各种型号的LCD(详见本.c文件最前面的描述)
@@ -836,55 +931,173 @@ void lcd_clear(uint16_t color)
 
 /**
  * @brief       在指定区域内填充单个颜色
+ *   @note      整个区域只开一次窗口(单行时只设置光标), 保持CS为低连续写入. 由于颜色不变,
+ *              数据线只需设置一次, 之后每个点只需要一个WR脉冲. 写完后恢复全屏窗口.
  * @param       (sx,sy),(ex,ey):填充矩形对角坐标,区域大小为:(ex - sx + 1) * (ey - sy + 1)
  * @param       color: 要填充的颜色(32位颜色,方便兼容LTDC)
  * @retval      无
  */
 void lcd_fill(uint16_t sx, uint16_t sy, uint16_t ex, uint16_t ey, uint32_t color)
 {
-    uint16_t i, j;
-    uint16_t xlen = 0;
-    xlen = ex - sx + 1;
+    uint32_t num;
+
+    if (ex < sx || ey < sy) return;
+
+    num = (uint32_t)(ex - sx + 1) * (ey - sy + 1);  /* 得到总点数 */
 
-    for (i = sy; i <= ey; i++)
+    if (sy == ey)                   /* 单行在全屏窗口下设置光标即可, 省去开窗和恢复窗口 */
+    {
+        lcd_set_cursor(sx, sy);
+    }
+    else
     {
-        lcd_set_cursor(sx, i);      /* 设置光标位置 */
-        lcd_write_ram_prepare();    /* 开始写入GRAM */
+        lcd_set_window(sx, sy, ex - sx + 1, ey - sy + 1);
+    }
 
-        for (j = 0; j < xlen; j++)
-        {
-            lcd_wr_data(color);     /* 写入数据 */
-        }
+    lcd_write_ram_prepare();        /* 开始写入GRAM */
+    LCD_RS(1);                      /* RS=1,表示写数据 */
+    LCD_CS(0);
+    LCD_DATA_OUT(color);            /* 同一颜色, 数据线只需设置一次 */
+
+    while (num >= 8)                /* 8点展开, 减少循环开销 */
+    {
+        LCD_WR(0); LCD_WR(1);
+        LCD_WR(0); LCD_WR(1);
+        LCD_WR(0); LCD_WR(1);
+        LCD_WR(0); LCD_WR(1);
+        LCD_WR(0); LCD_WR(1);
+        LCD_WR(0); LCD_WR(1);
+        LCD_WR(0); LCD_WR(1);
+        LCD_WR(0); LCD_WR(1);
+        num -= 8;
+    }
+
+    while (num--)
+    {
+        LCD_WR(0);
+        LCD_WR(1);
+    }
+
+    LCD_CS(1);
+
+    if (sy != ey)
+    {
+        lcd_reset_window();
     }
 }
 
 /**
  * @brief       在指定区域内填充指定颜色块
+ *   @note      整个区域只开一次窗口, 保持CS为低连续写入颜色数组, 写完后恢复全屏窗口.
  * @param       (sx,sy),(ex,ey):填充矩形对角坐标,区域大小为:(ex - sx + 1) * (ey - sy + 1)
  * @param       color: 要填充的颜色数组首地址
  * @retval      无
  */
 void lcd_color_fill(uint16_t sx, uint16_t sy, uint16_t ex, uint16_t ey, uint16_t *color)
 {
-    uint16_t height, width;
+    uint32_t num;
+
+    if (ex < sx || ey < sy) return;
+
+    num = (uint32_t)(ex - sx + 1) * (ey - sy + 1);  /* 得到总点数 */
+    lcd_set_window(sx, sy, ex - sx + 1, ey - sy + 1);
+    lcd_write_ram_prepare();        /* 开始写入GRAM */
+    LCD_RS(1);                      /* RS=1,表示写数据 */
+    LCD_CS(0);
+
+    while (num >= 8)                /* 8点展开, 减少循环开销 */
+    {
+        lcd_wr_pixel(color[0]);
+        lcd_wr_pixel(color[1]);
+        lcd_wr_pixel(color[2]);
+        lcd_wr_pixel(color[3]);
+        lcd_wr_pixel(color[4]);
+        lcd_wr_pixel(color[5]);
+        lcd_wr_pixel(color[6]);
+        lcd_wr_pixel(color[7]);
+        color += 8;
+        num -= 8;
+    }
+
+    while (num--)
+    {
+        lcd_wr_pixel(*color++);
+    }
+
+    LCD_CS(1);
+    lcd_reset_window();
+}
+
+/**
+ * @brief       将颜色数组中的一块区域写到屏幕
+ *   @note      与 lcd_color_fill 相同只开一次窗口, 但源数据每行之间可以有间隔, 用于
+ *              从较大的缓冲区(如 lcd_comp 画布)中取出一个子矩形写到屏幕.
+ * @param       sx,sy        : 屏幕上的起始坐标(左上角)
+ * @param       width,height : 区域宽度和高度, 必须大于0
+ * @param       color        : 源区域左上角的颜色首地址
+ * @param       stride       : 源数据每行的点数(>= width)
+ * @retval      无
+ */
+void lcd_color_blit(uint16_t sx, uint16_t sy, uint16_t width, uint16_t height, const uint16_t *color, uint16_t stride)
+{
     uint16_t i, j;
-    width = ex - sx + 1;            /* 得到填充的宽度 */
-    height = ey - sy + 1;           /* 高度 */
+
+    lcd_set_window(sx, sy, width, height);
+    lcd_write_ram_prepare();        /* 开始写入GRAM */
+    LCD_RS(1);                      /* RS=1,表示写数据 */
+    LCD_CS(0);
 
     for (i = 0; i < height; i++)
     {
-        lcd_set_cursor(sx, sy + i); /* 设置光标位置 */
-        lcd_write_ram_prepare();    /* 开始写入GRAM */
-
         for (j = 0; j < width; j++)
         {
-            lcd_wr_data(color[i * width + j]);  /* 写入数据 */
+            lcd_wr_pixel(color[j]);
         }
+
+        color += stride;
+    }
+
+    LCD_CS(1);
+    lcd_reset_window();
+}
+
+/**
+ * @brief       画一段水平或垂直线段(裁剪到屏幕内)
+ *   @note      lcd_draw_line/lcd_draw_circle 的输出单元. 较短的垂直线段开窗口不划算,
+ *              直接逐点写, 其余交给 lcd_fill.
+ * @param       (sx,sy),(ex,ey): 线段两端坐标, sx <= ex, sy <= ey, 可以超出屏幕
+ * @param       color: 线段的颜色
+ * @retval      无
+ */
+static void lcd_draw_span(int sx, int sy, int ex, int ey, uint16_t color)
+{
+    if (sx < 0) sx = 0;
+
+    if (sy < 0) sy = 0;
+
+    if (ex >= lcddev.width) ex = lcddev.width - 1;
+
+    if (ey >= lcddev.height) ey = lcddev.height - 1;
+
+    if (ex < sx || ey < sy) return; /* 完全在屏幕外 */
+
+    if (sx == ex && ey - sy < 3)    /* 3个点以内的垂直线段 */
+    {
+        for (; sy <= ey; sy++)
+        {
+            lcd_draw_point(sx, sy, color);
+        }
+    }
+    else
+    {
+        lcd_fill(sx, sy, ex, ey, color);
     }
 }
 
 /**
  * @brief       画线
+ *   @note      水平/垂直线直接填充. 斜线仍按原来的步进算法取点, 但把主方向上连续的点
+ *              合并成一段, 每段只写一次.
  * @param       x1,y1: 起点坐标
  * @param       x2,y2: 终点坐标
  * @param       color: 线的颜色
@@ -895,13 +1108,21 @@ void lcd_draw_line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t
     uint16_t t;
     int xerr = 0, yerr = 0, delta_x, delta_y, distance;
     int incx, incy, row, col;
+    int srow, scol;             /* 当前线段的起点 */
+    int prow, pcol;             /* 本次输出的点 */
+    uint8_t xmajor;
     delta_x = x2 - x1;          /* 计算坐标增量 */
     delta_y = y2 - y1;
     row = x1;
     col = y1;
 
+    if (delta_x == 0 || delta_y == 0)   /* 水平/垂直线 */
+    {
+        lcd_draw_span((x1 < x2) ? x1 : x2, (y1 < y2) ? y1 : y2, (x1 < x2) ? x2 : x1, (y1 < y2) ? y2 : y1, color);
+        return;
+    }
+
     if (delta_x > 0)incx = 1;   /* 设置单步方向 */
-    else if (delta_x == 0)incx = 0; /* 垂直线 */
     else
     {
         incx = -1;
@@ -909,7 +1130,6 @@ void lcd_draw_line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t
     }
 
     if (delta_y > 0)incy = 1;
-    else if (delta_y == 0)incy = 0; /* 水平线 */
     else
     {
         incy = -1;
@@ -919,9 +1139,14 @@ void lcd_draw_line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t
     if ( delta_x > delta_y)distance = delta_x;  /* 选取基本增量坐标轴 */
     else distance = delta_y;
 
+    xmajor = (delta_x >= delta_y);  /* X为主方向时合并水平线段, 否则合并垂直线段 */
+    srow = row;
+    scol = col;
+
     for (t = 0; t <= distance + 1; t++ )   /* 画线输出 */
     {
-        lcd_draw_point(row, col, color); /* 画点 */
+        prow = row;
+        pcol = col;
         xerr += delta_x ;
         yerr += delta_y ;
 
@@ -936,6 +1161,13 @@ void lcd_draw_line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t
             yerr -= distance;
             col += incy;
         }
+
+        if (t == distance + 1 || (xmajor ? (col != scol) : (row != srow)))    /* 当前线段结束 */
+        {
+            lcd_draw_span((srow < prow) ? srow : prow, (scol < pcol) ? scol : pcol, (srow < prow) ? prow : srow, (scol < pcol) ? pcol : scol, color);
+            srow = row;
+            scol = col;
+        }
     }
 }
 
@@ -968,8 +1200,30 @@ void lcd_draw_rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint
     lcd_draw_line(x2, y1, x2, y2, color);
 }
 
+/**
+ * @brief       画出圆上 b 相同, a 从 as 到 ae 的8段对称线段
+ * @param       x0,y0: 圆中心坐标
+ * @param       as,ae: a 的范围
+ * @param       b    : 当前的 b
+ * @param       color: 圆的颜色
+ * @retval      无
+ */
+static void lcd_draw_circle_spans(int x0, int y0, int as, int ae, int b, uint16_t color)
+{
+    lcd_draw_span(x0 + as, y0 - b, x0 + ae, y0 - b, color);     /* 5 */
+    lcd_draw_span(x0 - ae, y0 - b, x0 - as, y0 - b, color);     /* 2 */
+    lcd_draw_span(x0 + as, y0 + b, x0 + ae, y0 + b, color);     /* 6 */
+    lcd_draw_span(x0 - ae, y0 + b, x0 - as, y0 + b, color);     /* 1 */
+    lcd_draw_span(x0 + b, y0 - ae, x0 + b, y0 - as, color);     /* 0 */
+    lcd_draw_span(x0 + b, y0 + as, x0 + b, y0 + ae, color);     /* 4 */
+    lcd_draw_span(x0 - b, y0 - ae, x0 - b, y0 - as, color);     /* 7 */
+    lcd_draw_span(x0 - b, y0 + as, x0 - b, y0 + ae, color);
+}
+
 /**
  * @brief       画圆
+ *   @note      Bresenham算法中 b 不变的一串点在上下两个八分圆里是水平线段, 在左右两个
+ *              八分圆里是垂直线段, 每串点合并成8段输出, 不再逐点写.
  * @param       x,y  : 圆中心坐标
  * @param       r    : 半径
  * @param       color: 圆的颜色
@@ -979,20 +1233,14 @@ void lcd_draw_circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color)
 {
     int a, b;
     int di;
+    int as;                  /* 当前 b 值开始时的 a */
     a = 0;
     b = r;
+    as = 0;
     di = 3 - (r << 1);       /* 判断下个点位置的标志 */
 
     while (a <= b)
     {
-        lcd_draw_point(x0 + a, y0 - b, color);  /* 5 */
-        lcd_draw_point(x0 + b, y0 - a, color);  /* 0 */
-        lcd_draw_point(x0 + b, y0 + a, color);  /* 4 */
-        lcd_draw_point(x0 + a, y0 + b, color);  /* 6 */
-        lcd_draw_point(x0 - a, y0 + b, color);  /* 1 */
-        lcd_draw_point(x0 - b, y0 + a, color);
-        lcd_draw_point(x0 - a, y0 - b, color);  /* 2 */
-        lcd_draw_point(x0 - b, y0 - a, color);  /* 7 */
         a++;
 
         /* 使用Bresenham算法画圆 */
@@ -1003,9 +1251,16 @@ void lcd_draw_circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color)
         else
         {
             di += 10 + 4 * (a - b);
+            lcd_draw_circle_spans(x0, y0, as, a - 1, b, color);    /* b 将要改变, 输出这一串点 */
             b--;
+            as = a;
         }
     }
+
+    if (as < a)
+    {
+        lcd_draw_circle_spans(x0, y0, as, a - 1, b, color);
+    }
 }
 
 /**
@@ -1044,93 +1299,337 @@ void lcd_fill_circle(uint16_t x, uint16_t y, uint16_t r, uint16_t color)
     }
 }
 
+#if LCD_FONT_ROW_MAJOR == 0
+
 /**
- * @brief       在指定位置显示一个字符
- * @param       x,y  : 坐标
- * @param       chr  : 要显示的字符:" "--->"~"
+ * @brief       将字库点阵展开成按行排列的位图
+ *   @note      asc2_1206/1608/2412/3216 是逐列取模(高位在前), 每列占 size/8(向上取整) 个字节,
+ *              这里转换成 rows[行] 的第 n 位对应第 n 列, 方便按行连续写GRAM.
+ *              字符宽度最大为16(3216字体), 所以每行用 uint16_t 即可.
+ * @param       pfont: 字符点阵首地址
  * @param       size : 字体大小 12/16/24/32
- * @param       mode : 叠加方式(1); 非叠加方式(0);
- * @param       color : 字符的颜色;
+ * @param       rows : 展开后的行位图, 至少 size 个元素
  * @retval      无
  */
-void lcd_show_char(uint16_t x, uint16_t y, char chr, uint8_t size, uint8_t mode, uint16_t color)
+static void lcd_glyph_expand(const uint8_t *pfont, uint8_t size, uint16_t *rows)
+{
+    uint8_t col, row, t1, temp;
+    uint8_t cbytes = size / 8 + ((size % 8) ? 1 : 0);   /* 每列占用的字节数 */
+
+    for (row = 0; row < size; row++)
+    {
+        rows[row] = 0;
+    }
+
+    for (col = 0; col < size / 2; col++)
+    {
+        row = 0;
+
+        for (t1 = 0; t1 < cbytes; t1++)
+        {
+            temp = *pfont++;
+
+            for (; temp && row < size; row++)   /* 剩余位全为0时提前结束 */
+            {
+                if (temp & 0x80)
+                {
+                    rows[row] |= 1 << col;
+                }
+
+                temp <<= 1;
+            }
+
+            row = (t1 + 1) * 8;                 /* 下一个字节从第 8*(t1+1) 行开始 */
+        }
+    }
+}
+
+#endif
+
+/**
+ * @brief       获取字符的行位图
+ * @param       chr  : 字符:" "--->"~"
+ * @param       size : 字体大小 12/16/24/32
+ * @param       rows : 展开后的行位图, 至少 size 个元素, rows[行] 的第 n 位对应第 n 列
+ * @retval      0, 成功; 1, 字符不在字库中或字体大小不支持;
+ */
+uint8_t lcd_get_glyph(char chr, uint8_t size, uint16_t *rows)
 {
-    uint8_t temp, t1, t;
-    uint16_t y0 = y;
-    uint8_t csize = 0;
+    if ((uint8_t)chr < ' ' || (uint8_t)chr > '~')
+    {
+        return 1;       /* 字库只有" "--->"~", 换行符和0x7F以上的字符都会越界 */
+    }
+
+#if LCD_FONT_ROW_MAJOR
+    uint8_t i;
+
+    chr = chr - ' ';    /* 得到偏移后的值（ASCII字库是从空格开始取模，所以-' '就是对应字符的字库） */
+
+    switch (size)
+    {
+        case 12:
+            for (i = 0; i < 12; i++) rows[i] = asc2_1206_row[(uint8_t)chr][i];  /* 调用1206字体 */
+            break;
+
+        case 16:
+            for (i = 0; i < 16; i++) rows[i] = asc2_1608_row[(uint8_t)chr][i];  /* 调用1608字体 */
+            break;
+
+        case 24:
+            for (i = 0; i < 24; i++) rows[i] = asc2_2412_row[(uint8_t)chr][i];  /* 调用2412字体 */
+            break;
+
+        case 32:
+            for (i = 0; i < 32; i++) rows[i] = asc2_3216_row[(uint8_t)chr][i];  /* 调用3216字体 */
+            break;
+
+        default:
+            return 1;
+    }
+
+    return 0;
+#else
     uint8_t *pfont = 0;
 
-    csize = (size / 8 + ((size % 8) ? 1 : 0)) * (size / 2); /* 得到字体一个字符对应点阵集所占的字节数 */
     chr = chr - ' ';    /* 得到偏移后的值（ASCII字库是从空格开始取模，所以-' '就是对应字符的字库） */
 
     switch (size)
     {
         case 12:
-            pfont = (uint8_t *)asc2_1206[chr];  /* 调用1206字体 */
+            pfont = (uint8_t *)asc2_1206[(uint8_t)chr];  /* 调用1206字体 */
             break;
 
         case 16:
-            pfont = (uint8_t *)asc2_1608[chr];  /* 调用1608字体 */
+            pfont = (uint8_t *)asc2_1608[(uint8_t)chr];  /* 调用1608字体 */
             break;
 
         case 24:
-            pfont = (uint8_t *)asc2_2412[chr];  /* 调用2412字体 */
+            pfont = (uint8_t *)asc2_2412[(uint8_t)chr];  /* 调用2412字体 */
             break;
 
         case 32:
-            pfont = (uint8_t *)asc2_3216[chr];  /* 调用3216字体 */
+            pfont = (uint8_t *)asc2_3216[(uint8_t)chr];  /* 调用3216字体 */
             break;
 
         default:
-            return ;
+            return 1;
     }
 
-    for (t = 0; t < csize; t++)
+    lcd_glyph_expand(pfont, size, rows);
+    return 0;
+#endif
+}
+
+#if LCD_GLYPH_CACHE_NUM > 0
+
+/* 字符缓存: 按前景色/背景色展开好的RGB565点阵 */
+typedef struct
+{
+    uint16_t pixel[LCD_GLYPH_CACHE_SIZE * LCD_GLYPH_CACHE_SIZE / 2];
+    uint16_t color;     /* 前景色 */
+    uint16_t back;      /* 背景色 */
+    uint8_t size;       /* 字体大小, 0 表示空 */
+    char chr;
+    uint32_t used;      /* 最近使用时间, 用于淘汰最久未使用的缓存 */
+} _lcd_glyph_cache;
+
+static _lcd_glyph_cache g_lcd_glyph_cache[LCD_GLYPH_CACHE_NUM];
+static uint32_t g_lcd_glyph_cache_tick;
+
+/**
+ * @brief       获取字符的RGB565缓存, 未命中时展开到最久未使用的缓存中
+ * @param       chr  : 字符:" "--->"~"
+ * @param       size : 字体大小, 不大于 LCD_GLYPH_CACHE_SIZE
+ * @param       color: 字符的颜色, 背景色为 g_back_color
+ * @retval      缓存的点阵(size/2 * size 个点, 按行排列), NULL 表示字体大小不支持
+ */
+static uint16_t *lcd_glyph_cache_get(char chr, uint8_t size, uint16_t color)
+{
+    uint8_t i, row, col;
+    uint16_t rows[LCD_GLYPH_CACHE_SIZE];
+    uint16_t line;
+    uint16_t *pixel;
+    _lcd_glyph_cache *victim = &g_lcd_glyph_cache[0];
+
+    g_lcd_glyph_cache_tick++;
+
+    for (i = 0; i < LCD_GLYPH_CACHE_NUM; i++)
     {
-        temp = pfont[t];    /* 获取字符的点阵数据 */
+        _lcd_glyph_cache *c = &g_lcd_glyph_cache[i];
+
+        if (c->size == size && c->chr == chr && c->color == color && c->back == (uint16_t)g_back_color)
+        {
+            c->used = g_lcd_glyph_cache_tick;
+            return c->pixel;
+        }
 
-        for (t1 = 0; t1 < 8; t1++)   /* 一个字节8个点 */
+        if (c->used < victim->used)
         {
-            if (temp & 0x80)        /* 有效点,需要显示 */
+            victim = c;
+        }
+    }
+
+    if (lcd_get_glyph(chr, size, rows))
+    {
+        return NULL;
+    }
+
+    pixel = victim->pixel;
+
+    for (row = 0; row < size; row++)
+    {
+        line = rows[row];
+
+        for (col = 0; col < size / 2; col++)
+        {
+            *pixel++ = (line & 0x01) ? color : g_back_color;
+            line >>= 1;
+        }
+    }
+
+    victim->size = size;
+    victim->chr = chr;
+    victim->color = color;
+    victim->back = g_back_color;
+    victim->used = g_lcd_glyph_cache_tick;
+    return victim->pixel;
+}
+
+#endif
+
+/**
+ * @brief       在指定位置显示一个字符
+ *   @note      整个字符只开一次窗口, 然后保持CS为低, 逐行连续写入展开后的点阵, 不再逐点
+ *              设置坐标. 叠加方式下只写有效点: 每行的连续有效点合并成一段, 每段开一次窗口.
+ *              字符超出屏幕的部分会被裁掉. 写完后恢复全屏窗口.
+ * @param       x,y  : 坐标
+ * @param       chr  : 要显示的字符:" "--->"~"
+ * @param       size : 字体大小 12/16/24/32
+ * @param       mode : 叠加方式(1); 非叠加方式(0);
+ * @param       color : 字符的颜色;
+ * @retval      无
+ */
+void lcd_show_char(uint16_t x, uint16_t y, char chr, uint8_t size, uint8_t mode, uint16_t color)
+{
+    uint8_t row, col, start;
+    uint16_t width, height;
+    uint16_t line;
+    uint16_t rows[32];
+#if LCD_GLYPH_CACHE_NUM > 0
+    uint16_t *pixel;
+#endif
+
+    if (x >= lcddev.width || y >= lcddev.height) return;   /* 超区域了 */
+
+    width = size / 2;
+    height = size;
+
+    if (x + width > lcddev.width) width = lcddev.width - x;     /* 裁剪到屏幕内 */
+
+    if (y + height > lcddev.height) height = lcddev.height - y;
+
+#if LCD_GLYPH_CACHE_NUM > 0
+    if (mode == 0 && size <= LCD_GLYPH_CACHE_SIZE && width == size / 2 && height == size)   /* 未被裁剪的字符走缓存 */
+    {
+        pixel = lcd_glyph_cache_get(chr, size, color);
+
+        if (pixel)
+        {
+            lcd_color_blit(x, y, width, height, pixel, width);
+        }
+
+        return;
+    }
+#endif
+
+    if (lcd_get_glyph(chr, size, rows)) return;  /* 字符或字体大小不支持 */
+
+    if (mode == 0)      /* 非叠加方式, 整个字符一次写完 */
+    {
+        lcd_set_window(x, y, width, height);
+        lcd_write_ram_prepare();
+        LCD_RS(1);      /* RS=1,表示写数据 */
+        LCD_CS(0);
+
+        for (row = 0; row < height; row++)
+        {
+            line = rows[row];
+
+            for (col = 0; col < width; col++)
             {
-                lcd_draw_point(x, y, color);        /* 画点出来,要显示这个点 */
+                lcd_wr_pixel((line & 0x01) ? color : g_back_color);
+                line >>= 1;
             }
-            else if (mode == 0)     /* 无效点,不显示 */
+        }
+
+        LCD_CS(1);
+    }
+    else                /* 叠加方式, 只写有效点 */
+    {
+        for (row = 0; row < height; row++)
+        {
+            line = rows[row] & ((1 << width) - 1);
+            col = 0;
+
+            while (line)
             {
-                lcd_draw_point(x, y, g_back_color); /* 画背景色,相当于这个点不显示(注意背景色由全局变量控制) */
-            }
+                while ((line & 0x01) == 0)      /* 跳过无效点 */
+                {
+                    line >>= 1;
+                    col++;
+                }
 
-            temp <<= 1; /* 移位, 以便获取下一个位的状态 */
-            y++;
+                start = col;
 
-            if (y >= lcddev.height)return;  /* 超区域了 */
+                while (line & 0x01)             /* 统计连续有效点 */
+                {
+                    line >>= 1;
+                    col++;
+                }
 
-            if ((y - y0) == size)   /* 显示完一列了? */
-            {
-                y = y0; /* y坐标复位 */
-                x++;    /* x坐标递增 */
+                lcd_set_window(x + start, y + row, col - start, 1);
+                lcd_write_ram_prepare();
+                LCD_RS(1);
+                LCD_CS(0);
 
-                if (x >= lcddev.width)return;   /* x坐标超区域了 */
+                LCD_DATA_OUT(color);            /* 同一颜色, 数据线只需设置一次 */
 
-                break;
+                for (; start < col; start++)
+                {
+                    LCD_WR(0);
+                    LCD_WR(1);
+                }
+
+                LCD_CS(1);
             }
         }
     }
+
+    lcd_reset_window();
 }
 
 /**
- * @brief       平方函数, m^n
- * @param       m: 底数
- * @param       n: 指数
- * @retval      m的n次方
+ * @brief       把数字拆成十进制各位
+ *   @note      从最高位开始反复减去10的幂, 每位最多减9次, 不用除法和求幂.
+ * @param       num  : 数值(0 ~ 2^32)
+ * @param       digit: 输出, digit[k] 为 10^k 位上的数字, 共10位
+ * @retval      无
  */
-static uint32_t lcd_pow(uint8_t m, uint8_t n)
+static void lcd_num_digits(uint32_t num, uint8_t *digit)
 {
-    uint32_t result = 1;
+    static const uint32_t pow10[10] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+    int8_t k;
 
-    while (n--)result *= m;
+    for (k = 9; k >= 0; k--)
+    {
+        digit[k] = 0;
 
-    return result;
+        while (num >= pow10[k])
+        {
+            num -= pow10[k];
+            digit[k]++;
+        }
+    }
 }
 
 /**
@@ -1146,10 +1645,13 @@ void lcd_show_num(uint16_t x, uint16_t y, uint32_t num, uint8_t len, uint8_t siz
 {
     uint8_t t, temp;
     uint8_t enshow = 0;
+    uint8_t digit[10];
+
+    lcd_num_digits(num, digit);
 
     for (t = 0; t < len; t++)   /* 按总显示位数循环 */
     {
-        temp = (num / lcd_pow(10, len - t - 1)) % 10;   /* 获取对应位的数字 */
+        temp = (len - t - 1 < 10) ? digit[len - t - 1] : 0;     /* 获取对应位的数字 */
 
         if (enshow == 0 && t < (len - 1))   /* 没有使能显示,且还有位要显示 */
         {
@@ -1186,10 +1688,13 @@ void lcd_show_xnum(uint16_t x, uint16_t y, uint32_t num, uint8_t len, uint8_t si
 {
     uint8_t t, temp;
     uint8_t enshow = 0;
+    uint8_t digit[10];
+
+    lcd_num_digits(num, digit);
 
     for (t = 0; t < len; t++)   /* 按总显示位数循环 */
     {
-        temp = (num / lcd_pow(10, len - t - 1)) % 10;    /* 获取对应位的数字 */
+        temp = (len - t - 1 < 10) ? digit[len - t - 1] : 0;     /* 获取对应位的数字 */
 
         if (enshow == 0 && t < (len - 1))   /* 没有使能显示,且还有位要显示 */
         {
@@ -78,6 +78,14 @@
  */
 #define tskSTACK_FILL_BYTE                        ( 0xa5U )
 
+/* tskSTACK_FILL_BYTE in every byte of a stack word, for checking a word at a
+ * time. */
+#define tskSTACK_FILL_WORD                        ( ( StackType_t ) 0xa5a5a5a5UL )
+
+/* Bits of the ucStackProfile TCB member. */
+#define tskSTACK_PROFILE_MEASURED                 ( ( uint8_t ) 0x01 ) /* The stack profiler has finished at least one scan of the stack. */
+#define tskSTACK_PROFILE_WARNED                   ( ( uint8_t ) 0x02 ) /* vApplicationStackMarginHook() has been called for the task. */
+
 /* Bits used to record how a task's stack and TCB were allocated. */
 #define tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB    ( ( uint8_t ) 0 )
 #define tskSTATICALLY_ALLOCATED_STACK_ONLY        ( ( uint8_t ) 1 )
@@ -86,7 +94,7 @@
 /* If any of the following are set then task stacks are filled with a known
  * value so the high water mark can be determined.  If none of the following are
  * set then don't fill the stack so there is no unnecessary dependency on memset. */
-#if ( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
+#if ( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) || ( configUSE_STACK_PROFILER == 1 ) )
     #define tskSET_NEW_STACKS_TO_KNOWN_VALUE    1
 #else
     #define tskSET_NEW_STACKS_TO_KNOWN_VALUE    0
@@ -225,6 +233,27 @@
     tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
 /*-----------------------------------------------------------*/
 
+/*
+ * Record the time at which a task left the Blocked or Suspended state, and
+ * why, so its wakeup latency can be measured when it next runs.  Not part of
+ * prvAddTaskToReadyList() because that is also used to move tasks that are
+ * already ready between ready lists when their priority changes.
+ */
+#if ( configUSE_TASK_LATENCY_STATS == 1 )
+    #define tskWAKE_NONE     ( ( uint8_t ) 0 )
+    #define tskWAKE_TIMED    ( ( uint8_t ) 1 ) /* The delay or block time expired. */
+    #define tskWAKE_EVENT    ( ( uint8_t ) 2 ) /* Unblocked by an event, notification, resume or abort. */
+
+    #define prvRecordWakeTime( pxTCB, ucReason )                  \
+    {                                                             \
+        ( pxTCB )->ulWakeTime = configTASK_LATENCY_TIMESTAMP(); \
+        ( pxTCB )->ucWakeReason = ( ucReason );                   \
+    }
+#else
+    #define prvRecordWakeTime( pxTCB, ucReason )
+#endif
+/*-----------------------------------------------------------*/
+
 /*
  * Several functions take a TaskHandle_t parameter that can optionally be NULL,
  * where NULL is used to indicate that the handle of the currently executing
@@ -296,6 +325,20 @@ typedef struct tskTaskControlBlock       /* The old naming convention is used to
         configRUN_TIME_COUNTER_TYPE ulRunTimeCounter; /*< Stores the amount of time the task has spent in the Running state. */
     #endif
 
+    #if ( configUSE_TASK_LATENCY_STATS == 1 )
+        TaskLatencyStats_t xLatencyStats; /*< Wakeup latency and period statistics, reported by vTaskGetInfo(). */
+        uint32_t ulWakeTime;              /*< configTASK_LATENCY_TIMESTAMP() when the task last left the Blocked or Suspended state. */
+        uint32_t ulLastTimedRun;          /*< configTASK_LATENCY_TIMESTAMP() when the task last ran after a timed wakeup. */
+        uint8_t ucWakeReason;             /*< tskWAKE_xxx, set until the woken task runs. */
+        uint8_t ucLastTimedRunValid;      /*< pdTRUE if ulLastTimedRun can be used to measure the next period. */
+    #endif
+
+    #if ( configUSE_STACK_PROFILER == 1 )
+        configSTACK_DEPTH_TYPE uxStackDepth;   /*< The stack size in words, as passed when the task was created. */
+        configSTACK_DEPTH_TYPE uxStackMinFree; /*< The fewest unused stack words the stack profiler has found so far. */
+        uint8_t ucStackProfile;                /*< tskSTACK_PROFILE_xxx bits. */
+    #endif
+
     #if ( configUSE_NEWLIB_REENTRANT == 1 )
 
         /* Allocate a Newlib reent structure that is specific to this task.
@@ -405,6 +448,14 @@ PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspended = ( UBaseType_t
 
 #endif
 
+#if ( configUSE_STACK_PROFILER == 1 )
+
+    PRIVILEGED_DATA static TCB_t * pxStackProfileTCB = NULL;                               /*< The task whose stack the idle task is part way through scanning. */
+    PRIVILEGED_DATA static UBaseType_t uxStackProfileTaskNumber = ( UBaseType_t ) 0U;      /*< The task number of the last task whose scan completed. */
+    PRIVILEGED_DATA static configSTACK_DEPTH_TYPE uxStackProfileWords = 0;                 /*< The unused words found so far in the stack of pxStackProfileTCB. */
+
+#endif
+
 /*lint -restore */
 
 /*-----------------------------------------------------------*/
@@ -461,6 +512,27 @@ static portTASK_FUNCTION_PROTO( prvIdleTask, pvParameters ) PRIVILEGED_FUNCTION;
  */
 static void prvCheckTasksWaitingTermination( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * Used only by the idle task.  Checks up to configSTACK_PROFILER_WORDS_PER_STEP
+ * words of one task's stack, carrying on from where the previous call stopped,
+ * so the scheduler is never suspended for long.  Once the scan of a task's
+ * stack is complete its lowest amount of free stack is updated, and the next
+ * call starts on the next task.
+ */
+#if ( configUSE_STACK_PROFILER == 1 )
+
+    static void prvStackProfilerStep( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns whichever of pxBest and the tasks referenced from pxList has the
+ * lowest task number above uxAfterTaskNumber, or NULL if none does.
+ */
+    static TCB_t * prvStackProfilerNextInList( List_t * pxList,
+                                               TCB_t * pxBest,
+                                               const UBaseType_t uxAfterTaskNumber ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
  * The currently executing task is entering the Blocked state.  Add the task to
  * either the current or the overflow delayed task list.
@@ -484,6 +556,34 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
 
 #endif
 
+/*
+ * Used by uxTaskIteratorNext() to collect, from the tasks referenced from
+ * pxList, the ones with the lowest task numbers above uxAfterTaskNumber.
+ * pxTaskStatusArray is kept sorted by task number, and only its xHandle,
+ * xTaskNumber and eCurrentState members are written.
+ */
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+    static void prvIteratorScanList( TaskStatus_t * pxTaskStatusArray,
+                                     const UBaseType_t uxArraySize,
+                                     UBaseType_t * puxFound,
+                                     List_t * pxList,
+                                     eTaskState eState,
+                                     const UBaseType_t uxAfterTaskNumber ) PRIVILEGED_FUNCTION;
+
+/*
+ * Implements uxTaskIteratorNext().  If pcNames is not NULL the task names are
+ * also copied to pcNames, configMAX_TASK_NAME_LEN characters per task, before
+ * the scheduler is resumed, so they stay valid even if the task is deleted.
+ */
+    static UBaseType_t prvTaskIteratorNext( TaskIterator_t * pxIterator,
+                                            TaskStatus_t * const pxTaskStatusArray,
+                                            const UBaseType_t uxArraySize,
+                                            BaseType_t xGetFreeStackSpace,
+                                            char * pcNames ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
+#endif
+
 /*
  * Searches pxList for a task with name pcNameToQuery - returning a handle to
  * the task if it is found, or NULL if the task is not found.
@@ -536,6 +636,36 @@ static void prvResetNextTaskUnblockTime( void ) PRIVILEGED_FUNCTION;
     static char * prvWriteNameToBuffer( char * pcBuffer,
                                         const char * pcTaskName ) PRIVILEGED_FUNCTION;
 
+/*
+ * Implements the streaming stats functions.  Reads the tasks a chunk at a time
+ * and passes one record per task, in the requested format, to pxWrite.
+ */
+    static BaseType_t prvTaskStatsStream( TaskStatsWriteFunction_t pxWrite,
+                                          void * pvContext,
+                                          BaseType_t xFormat,
+                                          BaseType_t xRunTimeStats ) PRIVILEGED_FUNCTION;
+
+/*
+ * TaskStatsWriteFunction_t used by the *ToBuffer() stats functions to copy
+ * whole records into a caller supplied buffer.
+ */
+    static BaseType_t prvWriteStatsToBuffer( const void * pvData,
+                                             size_t xLength,
+                                             void * pvContext ) PRIVILEGED_FUNCTION;
+
+/*
+ * Implements the *ToBuffer() stats functions on top of prvTaskStatsStream().
+ */
+    static size_t prvTaskStatsToBuffer( char * pcBuffer,
+                                        size_t xBufferLength,
+                                        BaseType_t xFormat,
+                                        BaseType_t xRunTimeStats ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
+/*
+ * Returns the character vTaskList() uses to show eState.
+ */
+    static char prvTaskStateToChar( eTaskState eState ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
 #endif
 
 /*
@@ -557,6 +687,18 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
  */
 static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
 
+/*
+ * Update the latency statistics of a task that has just been switched in
+ * after being woken, and clear the statistics of a task.
+ */
+#if ( configUSE_TASK_LATENCY_STATS == 1 )
+
+    static void prvUpdateLatencyStats( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+    static void prvResetLatencyStats( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
  * freertos_tasks_c_additions_init() should only be called if the user definable
  * macro FREERTOS_TASKS_C_ADDITIONS_INIT() is defined, as that is the only macro
@@ -964,6 +1106,21 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
         }
     #endif /* configGENERATE_RUN_TIME_STATS */
 
+    #if ( configUSE_TASK_LATENCY_STATS == 1 )
+        {
+            pxNewTCB->ucWakeReason = tskWAKE_NONE;
+            prvResetLatencyStats( pxNewTCB );
+        }
+    #endif
+
+    #if ( configUSE_STACK_PROFILER == 1 )
+        {
+            pxNewTCB->uxStackDepth = ( configSTACK_DEPTH_TYPE ) ulStackDepth;
+            pxNewTCB->uxStackMinFree = ( configSTACK_DEPTH_TYPE ) ulStackDepth;
+            pxNewTCB->ucStackProfile = 0U;
+        }
+    #endif
+
     #if ( portUSING_MPU_WRAPPERS == 1 )
         {
             vPortStoreTaskMPUSettings( &( pxNewTCB->xMPUSettings ), xRegions, pxNewTCB->pxStack, ulStackDepth );
@@ -1881,6 +2038,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                 if( prvTaskIsTaskSuspended( pxTCB ) != pdFALSE )
                 {
                     traceTASK_RESUME( pxTCB );
+                    prvRecordWakeTime( pxTCB, tskWAKE_EVENT );
 
                     /* The ready list can be accessed even if the scheduler is
                      * suspended because this is inside a critical section. */
@@ -1950,6 +2108,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
             if( prvTaskIsTaskSuspended( pxTCB ) != pdFALSE )
             {
                 traceTASK_RESUME_FROM_ISR( pxTCB );
+                prvRecordWakeTime( pxTCB, tskWAKE_EVENT );
 
                 /* Check the ready lists can be accessed. */
                 if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
@@ -2603,6 +2762,147 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char
 #endif /* configUSE_TRACE_FACILITY */
 /*----------------------------------------------------------*/
 
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+    void vTaskIteratorInit( TaskIterator_t * pxIterator )
+    {
+        configASSERT( pxIterator );
+
+        /* Task numbers start at 1, so 0 is before every task. */
+        pxIterator->uxLastTaskNumber = ( UBaseType_t ) 0U;
+    }
+/*----------------------------------------------------------*/
+
+    UBaseType_t uxTaskIteratorNext( TaskIterator_t * pxIterator,
+                                    TaskStatus_t * const pxTaskStatusArray,
+                                    const UBaseType_t uxArraySize,
+                                    BaseType_t xGetFreeStackSpace )
+    {
+        return prvTaskIteratorNext( pxIterator, pxTaskStatusArray, uxArraySize, xGetFreeStackSpace, NULL );
+    }
+/*----------------------------------------------------------*/
+
+    static UBaseType_t prvTaskIteratorNext( TaskIterator_t * pxIterator,
+                                            TaskStatus_t * const pxTaskStatusArray,
+                                            const UBaseType_t uxArraySize,
+                                            BaseType_t xGetFreeStackSpace,
+                                            char * pcNames ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+    {
+        UBaseType_t uxFound = 0, uxQueue = configMAX_PRIORITIES, x;
+        const UBaseType_t uxAfterTaskNumber = pxIterator->uxLastTaskNumber;
+
+        configASSERT( pxTaskStatusArray );
+        configASSERT( uxArraySize > ( UBaseType_t ) 0U );
+
+        vTaskSuspendAll();
+        {
+            /* The lists can change whenever the scheduler is not suspended, so
+             * the position of the walk is a task number rather than a list
+             * item.  Each call selects the uxArraySize lowest numbered tasks
+             * that come after the last task returned.  Scanning the lists
+             * only reads a pointer per task, the costly part is
+             * vTaskGetInfo() which is only called for the selected tasks. */
+            do
+            {
+                uxQueue--;
+                prvIteratorScanList( pxTaskStatusArray, uxArraySize, &uxFound, &( pxReadyTasksLists[ uxQueue ] ), eReady, uxAfterTaskNumber );
+            } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+            prvIteratorScanList( pxTaskStatusArray, uxArraySize, &uxFound, ( List_t * ) pxDelayedTaskList, eBlocked, uxAfterTaskNumber );
+            prvIteratorScanList( pxTaskStatusArray, uxArraySize, &uxFound, ( List_t * ) pxOverflowDelayedTaskList, eBlocked, uxAfterTaskNumber );
+
+            #if ( INCLUDE_vTaskDelete == 1 )
+                {
+                    prvIteratorScanList( pxTaskStatusArray, uxArraySize, &uxFound, &xTasksWaitingTermination, eDeleted, uxAfterTaskNumber );
+                }
+            #endif
+
+            #if ( INCLUDE_vTaskSuspend == 1 )
+                {
+                    prvIteratorScanList( pxTaskStatusArray, uxArraySize, &uxFound, &xSuspendedTaskList, eSuspended, uxAfterTaskNumber );
+                }
+            #endif
+
+            for( x = 0; x < uxFound; x++ )
+            {
+                vTaskGetInfo( pxTaskStatusArray[ x ].xHandle, &( pxTaskStatusArray[ x ] ), xGetFreeStackSpace, pxTaskStatusArray[ x ].eCurrentState );
+
+                if( pcNames != NULL )
+                {
+                    ( void ) memcpy( ( void * ) &( pcNames[ x * configMAX_TASK_NAME_LEN ] ), ( const void * ) pxTaskStatusArray[ x ].pcTaskName, ( size_t ) configMAX_TASK_NAME_LEN );
+                    pxTaskStatusArray[ x ].pcTaskName = &( pcNames[ x * configMAX_TASK_NAME_LEN ] );
+                }
+            }
+        }
+        ( void ) xTaskResumeAll();
+
+        if( uxFound > ( UBaseType_t ) 0U )
+        {
+            pxIterator->uxLastTaskNumber = pxTaskStatusArray[ uxFound - 1U ].xTaskNumber;
+        }
+
+        return uxFound;
+    }
+/*----------------------------------------------------------*/
+
+    static void prvIteratorScanList( TaskStatus_t * pxTaskStatusArray,
+                                     const UBaseType_t uxArraySize,
+                                     UBaseType_t * puxFound,
+                                     List_t * pxList,
+                                     eTaskState eState,
+                                     const UBaseType_t uxAfterTaskNumber )
+    {
+        configLIST_VOLATILE TCB_t * pxNextTCB, * pxFirstTCB;
+        UBaseType_t x;
+
+        if( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
+        {
+            listGET_OWNER_OF_NEXT_ENTRY( pxFirstTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+            do
+            {
+                listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+                /* Is the task after the walk position, and either is there
+                 * space left or does it come before the highest numbered
+                 * task selected so far? */
+                if( ( pxNextTCB->uxTCBNumber > uxAfterTaskNumber ) &&
+                    ( ( *puxFound < uxArraySize ) || ( pxNextTCB->uxTCBNumber < pxTaskStatusArray[ uxArraySize - 1U ].xTaskNumber ) ) )
+                {
+                    /* When the array is full the highest numbered task is
+                     * overwritten. */
+                    if( *puxFound < uxArraySize )
+                    {
+                        ( *puxFound )++;
+                    }
+
+                    /* Insertion sort, moving only the members written here. */
+                    for( x = *puxFound - 1U; ( x > ( UBaseType_t ) 0U ) && ( pxTaskStatusArray[ x - 1U ].xTaskNumber > pxNextTCB->uxTCBNumber ); x-- )
+                    {
+                        pxTaskStatusArray[ x ].xHandle = pxTaskStatusArray[ x - 1U ].xHandle;
+                        pxTaskStatusArray[ x ].xTaskNumber = pxTaskStatusArray[ x - 1U ].xTaskNumber;
+                        pxTaskStatusArray[ x ].eCurrentState = pxTaskStatusArray[ x - 1U ].eCurrentState;
+                    }
+
+                    pxTaskStatusArray[ x ].xHandle = ( TaskHandle_t ) pxNextTCB;
+                    pxTaskStatusArray[ x ].xTaskNumber = pxNextTCB->uxTCBNumber;
+                    pxTaskStatusArray[ x ].eCurrentState = eState;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            } while( pxNextTCB != pxFirstTCB );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* configUSE_TRACE_FACILITY */
+/*----------------------------------------------------------*/
+
 #if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
 
     TaskHandle_t xTaskGetIdleTaskHandle( void )
@@ -2698,6 +2998,7 @@ BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp )
                 taskEXIT_CRITICAL();
 
                 /* Place the unblocked task into the appropriate ready list. */
+                prvRecordWakeTime( pxTCB, tskWAKE_EVENT );
                 prvAddTaskToReadyList( pxTCB );
 
                 /* A task being unblocked cannot cause an immediate context
@@ -2821,6 +3122,7 @@ BaseType_t xTaskIncrementTick( void )
 
                     /* Place the unblocked task into the appropriate ready
                      * list. */
+                    prvRecordWakeTime( pxTCB, tskWAKE_TIMED );
                     prvAddTaskToReadyList( pxTCB );
 
                     /* A task being unblocked cannot cause an immediate
@@ -3074,6 +3376,17 @@ void vTaskSwitchContext( void )
         taskSELECT_HIGHEST_PRIORITY_TASK(); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
         traceTASK_SWITCHED_IN();
 
+        /* Only a task woken since it last ran has a wakeup to measure.  A
+         * task that was preempted and is now resumed does not. */
+        #if ( configUSE_TASK_LATENCY_STATS == 1 )
+            {
+                if( pxCurrentTCB->ucWakeReason != tskWAKE_NONE )
+                {
+                    prvUpdateLatencyStats( pxCurrentTCB );
+                }
+            }
+        #endif
+
         /* After the new task is switched in, update the global errno. */
         #if ( configUSE_POSIX_ERRNO == 1 )
             {
@@ -3201,6 +3514,7 @@ BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList )
     pxUnblockedTCB = listGET_OWNER_OF_HEAD_ENTRY( pxEventList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
     configASSERT( pxUnblockedTCB );
     listREMOVE_ITEM( &( pxUnblockedTCB->xEventListItem ) );
+    prvRecordWakeTime( pxUnblockedTCB, tskWAKE_EVENT );
 
     if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
     {
@@ -3284,6 +3598,7 @@ void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
      * scheduler is suspended so interrupts will not be accessing the ready
      * lists. */
     listREMOVE_ITEM( &( pxUnblockedTCB->xStateListItem ) );
+    prvRecordWakeTime( pxUnblockedTCB, tskWAKE_EVENT );
     prvAddTaskToReadyList( pxUnblockedTCB );
 
     if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
@@ -3457,6 +3772,13 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
          * is responsible for freeing the deleted task's TCB and stack. */
         prvCheckTasksWaitingTermination();
 
+        #if ( configUSE_STACK_PROFILER == 1 )
+            {
+                /* Scan a little more of a task stack for its high water mark. */
+                prvStackProfilerStep();
+            }
+        #endif
+
         #if ( configUSE_PREEMPTION == 0 )
             {
                 /* If we are not using preemption we keep forcing a task switch to
@@ -3695,6 +4017,151 @@ static void prvInitialiseTaskLists( void )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_STACK_PROFILER == 1 )
+
+    static void prvStackProfilerStep( void )
+    {
+        const StackType_t * pxWord;
+        UBaseType_t uxBudget = ( UBaseType_t ) configSTACK_PROFILER_WORDS_PER_STEP, uxQueue = configMAX_PRIORITIES;
+        TaskHandle_t xWarnTask = NULL;
+        configSTACK_DEPTH_TYPE uxWarnFree = 0;
+        char cWarnName[ configMAX_TASK_NAME_LEN ]; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
+        /* The scheduler is suspended so no task can be deleted, or can start
+         * using more of its stack, part way through a step.  It is resumed
+         * between steps; prvDeleteTCB() clears pxStackProfileTCB if the task
+         * being scanned is deleted meanwhile. */
+        vTaskSuspendAll();
+        {
+            if( pxStackProfileTCB == NULL )
+            {
+                /* Move on to the task with the next task number, wrapping
+                 * round to the first task after the last. */
+                do
+                {
+                    uxQueue--;
+                    pxStackProfileTCB = prvStackProfilerNextInList( &( pxReadyTasksLists[ uxQueue ] ), pxStackProfileTCB, uxStackProfileTaskNumber );
+                } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+                pxStackProfileTCB = prvStackProfilerNextInList( ( List_t * ) pxDelayedTaskList, pxStackProfileTCB, uxStackProfileTaskNumber );
+                pxStackProfileTCB = prvStackProfilerNextInList( ( List_t * ) pxOverflowDelayedTaskList, pxStackProfileTCB, uxStackProfileTaskNumber );
+
+                #if ( INCLUDE_vTaskSuspend == 1 )
+                    {
+                        pxStackProfileTCB = prvStackProfilerNextInList( &xSuspendedTaskList, pxStackProfileTCB, uxStackProfileTaskNumber );
+                    }
+                #endif
+
+                if( pxStackProfileTCB == NULL )
+                {
+                    /* Every task has been scanned, start again next time. */
+                    uxStackProfileTaskNumber = ( UBaseType_t ) 0U;
+                }
+
+                uxStackProfileWords = 0;
+            }
+
+            if( pxStackProfileTCB != NULL )
+            {
+                /* Count the unused words from the far end of the stack, a word
+                 * at a time.  Stack use only ever grows, so the count never
+                 * needs to go past the fewest unused words found before. */
+                #if ( portSTACK_GROWTH < 0 )
+                    {
+                        pxWord = &( pxStackProfileTCB->pxStack[ uxStackProfileWords ] );
+                    }
+                #else
+                    {
+                        pxWord = pxStackProfileTCB->pxEndOfStack - uxStackProfileWords;
+                    }
+                #endif
+
+                while( ( uxBudget > ( UBaseType_t ) 0U ) && ( uxStackProfileWords < pxStackProfileTCB->uxStackMinFree ) && ( *pxWord == tskSTACK_FILL_WORD ) )
+                {
+                    pxWord -= portSTACK_GROWTH;
+                    uxStackProfileWords++;
+                    uxBudget--;
+                }
+
+                if( ( uxStackProfileWords >= pxStackProfileTCB->uxStackMinFree ) || ( *pxWord != tskSTACK_FILL_WORD ) )
+                {
+                    /* The scan of this stack is complete. */
+                    pxStackProfileTCB->uxStackMinFree = uxStackProfileWords;
+                    pxStackProfileTCB->ucStackProfile |= tskSTACK_PROFILE_MEASURED;
+
+                    if( ( uxStackProfileWords < ( configSTACK_DEPTH_TYPE ) configSTACK_PROFILER_MARGIN_WORDS ) &&
+                        ( ( pxStackProfileTCB->ucStackProfile & tskSTACK_PROFILE_WARNED ) == 0U ) )
+                    {
+                        pxStackProfileTCB->ucStackProfile |= tskSTACK_PROFILE_WARNED;
+                        xWarnTask = ( TaskHandle_t ) pxStackProfileTCB;
+                        uxWarnFree = uxStackProfileWords;
+                        ( void ) memcpy( ( void * ) cWarnName, ( const void * ) pxStackProfileTCB->pcTaskName, ( size_t ) configMAX_TASK_NAME_LEN );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    uxStackProfileTaskNumber = pxStackProfileTCB->uxTCBNumber;
+                    pxStackProfileTCB = NULL;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        ( void ) xTaskResumeAll();
+
+        /* Called with the scheduler running so the hook can use printf() and
+         * the like, but like the idle hook it must not block. */
+        if( xWarnTask != NULL )
+        {
+            vApplicationStackMarginHook( xWarnTask, cWarnName, uxWarnFree );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static TCB_t * prvStackProfilerNextInList( List_t * pxList,
+                                               TCB_t * pxBest,
+                                               const UBaseType_t uxAfterTaskNumber )
+    {
+        configLIST_VOLATILE TCB_t * pxNextTCB, * pxFirstTCB;
+
+        if( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
+        {
+            listGET_OWNER_OF_NEXT_ENTRY( pxFirstTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+            do
+            {
+                listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+                if( ( pxNextTCB->uxTCBNumber > uxAfterTaskNumber ) &&
+                    ( ( pxBest == NULL ) || ( pxNextTCB->uxTCBNumber < pxBest->uxTCBNumber ) ) )
+                {
+                    pxBest = ( TCB_t * ) pxNextTCB;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            } while( pxNextTCB != pxFirstTCB );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pxBest;
+    }
+
+#endif /* configUSE_STACK_PROFILER */
+/*-----------------------------------------------------------*/
+
 static void prvCheckTasksWaitingTermination( void )
 {
     /** THIS FUNCTION IS CALLED FROM THE RTOS IDLE TASK **/
@@ -3761,6 +4228,18 @@ static void prvCheckTasksWaitingTermination( void )
             }
         #endif
 
+        #if ( configUSE_TASK_LATENCY_STATS == 1 )
+            {
+                /* The statistics are updated by the context switch, so copy them
+                 * in one go. */
+                taskENTER_CRITICAL();
+                {
+                    pxTaskStatus->xLatencyStats = pxTCB->xLatencyStats;
+                }
+                taskEXIT_CRITICAL();
+            }
+        #endif
+
         /* Obtaining the task state is a little fiddly, so is only done if the
          * value of eState passed into this function is eInvalid - otherwise the
          * state is just set to whatever is passed in. */
@@ -3817,6 +4296,35 @@ static void prvCheckTasksWaitingTermination( void )
         {
             pxTaskStatus->usStackHighWaterMark = 0;
         }
+
+        #if ( configUSE_STACK_PROFILER == 1 )
+            {
+                configSTACK_DEPTH_TYPE uxUsed, uxHeadroom;
+
+                pxTaskStatus->usStackDepth = pxTCB->uxStackDepth;
+                pxTaskStatus->usStackMinFree = pxTCB->uxStackMinFree;
+
+                if( ( pxTCB->ucStackProfile & tskSTACK_PROFILE_MEASURED ) != 0U )
+                {
+                    /* Recommend the deepest use seen plus a quarter, and at
+                     * least configSTACK_PROFILER_MARGIN_WORDS, rounded up to a
+                     * multiple of 8 words. */
+                    uxUsed = ( configSTACK_DEPTH_TYPE ) ( pxTCB->uxStackDepth - pxTCB->uxStackMinFree );
+                    uxHeadroom = ( configSTACK_DEPTH_TYPE ) ( uxUsed / 4U );
+
+                    if( uxHeadroom < ( configSTACK_DEPTH_TYPE ) configSTACK_PROFILER_MARGIN_WORDS )
+                    {
+                        uxHeadroom = ( configSTACK_DEPTH_TYPE ) configSTACK_PROFILER_MARGIN_WORDS;
+                    }
+
+                    pxTaskStatus->usRecommendedStackDepth = ( configSTACK_DEPTH_TYPE ) ( ( uxUsed + uxHeadroom + 7U ) & ~( ( configSTACK_DEPTH_TYPE ) 7U ) );
+                }
+                else
+                {
+                    pxTaskStatus->usRecommendedStackDepth = 0;
+                }
+            }
+        #endif /* configUSE_STACK_PROFILER */
     }
 
 #endif /* configUSE_TRACE_FACILITY */
@@ -3949,6 +4457,17 @@ static void prvCheckTasksWaitingTermination( void )
 
     static void prvDeleteTCB( TCB_t * pxTCB )
     {
+        #if ( configUSE_STACK_PROFILER == 1 )
+            {
+                /* Do not let the stack profiler carry on scanning a stack that
+                 * is about to be freed. */
+                if( pxTCB == pxStackProfileTCB )
+                {
+                    pxStackProfileTCB = NULL;
+                }
+            }
+        #endif
+
         /* This call is required specifically for the TriCore port.  It must be
          * above the vPortFree() calls.  The call is also used by ports/demos that
          * want to allocate and clean RAM statically. */
@@ -4668,6 +5187,266 @@ static void prvResetNextTaskUnblockTime( void )
 #endif /* ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) ) */
 /*-----------------------------------------------------------*/
 
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+
+/* Large enough for a task name plus the numeric fields of any one record. */
+    #define tskSTATS_RECORD_LENGTH           ( configMAX_TASK_NAME_LEN + 64 )
+
+/* The number of bytes that come before the task name in a binary record. */
+    #define tskSTATS_BINARY_HEADER_LENGTH    ( 8U )
+
+/* Context of prvWriteStatsToBuffer(). */
+    typedef struct tskStatsBuffer
+    {
+        char * pcBuffer;      /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+        size_t xBufferLength;
+        size_t xUsed;         /* The number of bytes stored in pcBuffer so far. */
+        size_t xRequired;     /* The number of bytes the complete output needs. */
+        BaseType_t xFull;     /* Set once a record did not fit. */
+    } StatsBuffer_t;
+
+    static BaseType_t prvTaskStatsStream( TaskStatsWriteFunction_t pxWrite,
+                                          void * pvContext,
+                                          BaseType_t xFormat,
+                                          BaseType_t xRunTimeStats )
+    {
+        TaskIterator_t xIterator;
+        TaskStatus_t xTaskStatusArray[ configTASK_STATS_CHUNK_SIZE ];
+        char cNames[ configTASK_STATS_CHUNK_SIZE * configMAX_TASK_NAME_LEN ]; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+        char cRecord[ tskSTATS_RECORD_LENGTH ];                              /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+        uint8_t * const pucRecord = ( uint8_t * ) cRecord;
+        const char * pcHeader;                                               /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+        const TaskStatus_t * pxStatus;
+        configRUN_TIME_COUNTER_TYPE ulTotalTime = 0, ulStatsAsPercentage;
+        UBaseType_t uxCount, x;
+        size_t xLength;
+        BaseType_t xReturn = pdPASS;
+
+        /*
+         * PLEASE NOTE:
+         *
+         * Like vTaskList() and vTaskGetRunTimeStats(), this function is
+         * provided for convenience only and is not part of the scheduler.
+         * Unlike them it neither allocates memory nor needs to know the size
+         * of the output in advance.  The scheduler is only suspended while
+         * uxTaskIteratorNext() reads configTASK_STATS_CHUNK_SIZE tasks, and the
+         * records are formatted and written after it has been resumed.
+         */
+
+        configASSERT( pxWrite );
+
+        #if ( configGENERATE_RUN_TIME_STATS == 1 )
+            {
+                if( xRunTimeStats != pdFALSE )
+                {
+                    #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+                        portALT_GET_RUN_TIME_COUNTER_VALUE( ulTotalTime );
+                    #else
+                        ulTotalTime = portGET_RUN_TIME_COUNTER_VALUE();
+                    #endif
+
+                    /* For percentage calculations. */
+                    ulTotalTime /= 100UL;
+                }
+            }
+        #endif /* configGENERATE_RUN_TIME_STATS */
+
+        if( xFormat == tskSTATS_FORMAT_CSV )
+        {
+            pcHeader = ( xRunTimeStats != pdFALSE ) ? "name,run_time,percent\r\n" : "name,state,priority,base_priority,stack_free,number\r\n";
+            xReturn = pxWrite( pcHeader, strlen( pcHeader ), pvContext );
+        }
+
+        vTaskIteratorInit( &xIterator );
+
+        do
+        {
+            /* The stack high water mark is the slow part of reading a task, so
+             * it is skipped when it is not part of the output. */
+            uxCount = prvTaskIteratorNext( &xIterator, xTaskStatusArray, ( UBaseType_t ) configTASK_STATS_CHUNK_SIZE, ( xRunTimeStats == pdFALSE ) ? pdTRUE : pdFALSE, cNames );
+
+            for( x = 0; ( x < uxCount ) && ( xReturn != pdFAIL ); x++ )
+            {
+                pxStatus = &( xTaskStatusArray[ x ] );
+
+                /* Avoid divide by zero errors. */
+                ulStatsAsPercentage = ( ulTotalTime > 0UL ) ? ( pxStatus->ulRunTimeCounter / ulTotalTime ) : 0UL;
+
+                if( xFormat == tskSTATS_FORMAT_CSV )
+                {
+                    if( xRunTimeStats != pdFALSE )
+                    {
+                        xLength = ( size_t ) sprintf( cRecord, "%s,%lu,%lu\r\n", pxStatus->pcTaskName, ( unsigned long ) pxStatus->ulRunTimeCounter, ( unsigned long ) ulStatsAsPercentage ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
+                    }
+                    else
+                    {
+                        xLength = ( size_t ) sprintf( cRecord, "%s,%c,%u,%u,%u,%u\r\n", pxStatus->pcTaskName, prvTaskStateToChar( pxStatus->eCurrentState ), ( unsigned int ) pxStatus->uxCurrentPriority, ( unsigned int ) pxStatus->uxBasePriority, ( unsigned int ) pxStatus->usStackHighWaterMark, ( unsigned int ) pxStatus->xTaskNumber ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
+                    }
+                }
+                else
+                {
+                    if( xRunTimeStats != pdFALSE )
+                    {
+                        pucRecord[ 1 ] = ( uint8_t ) ulStatsAsPercentage;
+                        pucRecord[ 2 ] = ( uint8_t ) pxStatus->xTaskNumber;
+                        pucRecord[ 3 ] = ( uint8_t ) ( pxStatus->xTaskNumber >> 8 );
+                        pucRecord[ 4 ] = ( uint8_t ) pxStatus->ulRunTimeCounter;
+                        pucRecord[ 5 ] = ( uint8_t ) ( pxStatus->ulRunTimeCounter >> 8 );
+                        pucRecord[ 6 ] = ( uint8_t ) ( pxStatus->ulRunTimeCounter >> 16 );
+                        pucRecord[ 7 ] = ( uint8_t ) ( pxStatus->ulRunTimeCounter >> 24 );
+                    }
+                    else
+                    {
+                        pucRecord[ 1 ] = ( uint8_t ) pxStatus->eCurrentState;
+                        pucRecord[ 2 ] = ( uint8_t ) pxStatus->uxCurrentPriority;
+                        pucRecord[ 3 ] = ( uint8_t ) pxStatus->uxBasePriority;
+                        pucRecord[ 4 ] = ( uint8_t ) pxStatus->xTaskNumber;
+                        pucRecord[ 5 ] = ( uint8_t ) ( pxStatus->xTaskNumber >> 8 );
+                        pucRecord[ 6 ] = ( uint8_t ) pxStatus->usStackHighWaterMark;
+                        pucRecord[ 7 ] = ( uint8_t ) ( pxStatus->usStackHighWaterMark >> 8 );
+                    }
+
+                    xLength = strlen( pxStatus->pcTaskName );
+                    ( void ) memcpy( ( void * ) &( pucRecord[ tskSTATS_BINARY_HEADER_LENGTH ] ), ( const void * ) pxStatus->pcTaskName, xLength );
+                    xLength += tskSTATS_BINARY_HEADER_LENGTH;
+                    pucRecord[ 0 ] = ( uint8_t ) xLength;
+                }
+
+                xReturn = pxWrite( cRecord, xLength, pvContext );
+            }
+        } while( ( uxCount > ( UBaseType_t ) 0U ) && ( xReturn != pdFAIL ) );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvWriteStatsToBuffer( const void * pvData,
+                                             size_t xLength,
+                                             void * pvContext )
+    {
+        StatsBuffer_t * const pxBuffer = ( StatsBuffer_t * ) pvContext;
+
+        /* Store whole records only, and always leave space for the
+         * terminator.  After one record has not fit, later ones are not stored
+         * either, so records are never missing from the middle of the output. */
+        if( ( pxBuffer->xFull == pdFALSE ) && ( xLength < ( pxBuffer->xBufferLength - pxBuffer->xUsed ) ) )
+        {
+            ( void ) memcpy( ( void * ) &( pxBuffer->pcBuffer[ pxBuffer->xUsed ] ), pvData, xLength );
+            pxBuffer->xUsed += xLength;
+        }
+        else
+        {
+            pxBuffer->xFull = pdTRUE;
+        }
+
+        /* Keep going so the length of the complete output can be returned. */
+        pxBuffer->xRequired += xLength;
+
+        return pdPASS;
+    }
+/*-----------------------------------------------------------*/
+
+    static size_t prvTaskStatsToBuffer( char * pcBuffer,
+                                        size_t xBufferLength,
+                                        BaseType_t xFormat,
+                                        BaseType_t xRunTimeStats )
+    {
+        StatsBuffer_t xBuffer;
+
+        configASSERT( ( pcBuffer != NULL ) || ( xBufferLength == ( size_t ) 0U ) );
+
+        xBuffer.pcBuffer = pcBuffer;
+        xBuffer.xBufferLength = xBufferLength;
+        xBuffer.xUsed = 0;
+        xBuffer.xRequired = 0;
+        xBuffer.xFull = pdFALSE;
+
+        ( void ) prvTaskStatsStream( prvWriteStatsToBuffer, &xBuffer, xFormat, xRunTimeStats );
+
+        if( xBufferLength > ( size_t ) 0U )
+        {
+            pcBuffer[ xBuffer.xUsed ] = ( char ) 0x00;
+        }
+
+        return xBuffer.xRequired;
+    }
+/*-----------------------------------------------------------*/
+
+    static char prvTaskStateToChar( eTaskState eState )
+    {
+        char cStatus;
+
+        switch( eState )
+        {
+            case eRunning:
+                cStatus = tskRUNNING_CHAR;
+                break;
+
+            case eReady:
+                cStatus = tskREADY_CHAR;
+                break;
+
+            case eBlocked:
+                cStatus = tskBLOCKED_CHAR;
+                break;
+
+            case eSuspended:
+                cStatus = tskSUSPENDED_CHAR;
+                break;
+
+            case eDeleted:
+                cStatus = tskDELETED_CHAR;
+                break;
+
+            case eInvalid: /* Fall through. */
+            default:       /* Should not get here, but it is included
+                            * to prevent static checking errors. */
+                cStatus = ( char ) 0x00;
+                break;
+        }
+
+        return cStatus;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTaskListStream( TaskStatsWriteFunction_t pxWrite,
+                                void * pvContext,
+                                BaseType_t xFormat )
+    {
+        return prvTaskStatsStream( pxWrite, pvContext, xFormat, pdFALSE );
+    }
+/*-----------------------------------------------------------*/
+
+    size_t xTaskListToBuffer( char * pcBuffer,
+                              size_t xBufferLength,
+                              BaseType_t xFormat )
+    {
+        return prvTaskStatsToBuffer( pcBuffer, xBufferLength, xFormat, pdFALSE );
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configGENERATE_RUN_TIME_STATS == 1 )
+
+        BaseType_t xTaskGetRunTimeStatsStream( TaskStatsWriteFunction_t pxWrite,
+                                               void * pvContext,
+                                               BaseType_t xFormat )
+        {
+            return prvTaskStatsStream( pxWrite, pvContext, xFormat, pdTRUE );
+        }
+/*-----------------------------------------------------------*/
+
+        size_t xTaskGetRunTimeStatsToBuffer( char * pcBuffer,
+                                             size_t xBufferLength,
+                                             BaseType_t xFormat )
+        {
+            return prvTaskStatsToBuffer( pcBuffer, xBufferLength, xFormat, pdTRUE );
+        }
+
+    #endif /* configGENERATE_RUN_TIME_STATS */
+
+#endif /* ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) */
+/*-----------------------------------------------------------*/
+
 TickType_t uxTaskResetEventItemValue( void )
 {
     TickType_t uxReturn;
@@ -4934,6 +5713,8 @@ TickType_t uxTaskResetEventItemValue( void )
              * notification then unblock it now. */
             if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
             {
+                prvRecordWakeTime( pxTCB, tskWAKE_EVENT );
+
                 listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
                 prvAddTaskToReadyList( pxTCB );
 
@@ -5076,6 +5857,8 @@ TickType_t uxTaskResetEventItemValue( void )
              * notification then unblock it now. */
             if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
             {
+                prvRecordWakeTime( pxTCB, tskWAKE_EVENT );
+
                 /* The task should not have been on an event list. */
                 configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
 
@@ -5167,6 +5950,8 @@ TickType_t uxTaskResetEventItemValue( void )
              * notification then unblock it now. */
             if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
             {
+                prvRecordWakeTime( pxTCB, tskWAKE_EVENT );
+
                 /* The task should not have been on an event list. */
                 configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
 
@@ -5307,6 +6092,97 @@ TickType_t uxTaskResetEventItemValue( void )
 #endif /* if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( INCLUDE_xTaskGetIdleTaskHandle == 1 ) ) */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TASK_LATENCY_STATS == 1 )
+
+    static void prvUpdateLatencyStats( TCB_t * const pxTCB )
+    {
+        const uint32_t ulNow = configTASK_LATENCY_TIMESTAMP();
+        const uint32_t ulLatency = ulNow - pxTCB->ulWakeTime;
+        TaskLatencyStats_t * const pxStats = &( pxTCB->xLatencyStats );
+        uint32_t ulMicroseconds, ulPeriod, ulBucket = 0UL;
+
+        pxStats->ulWakeups++;
+        pxStats->ullTotalLatency += ulLatency;
+
+        if( ulLatency > pxStats->ulMaxLatency )
+        {
+            pxStats->ulMaxLatency = ulLatency;
+        }
+
+        if( ulLatency < pxStats->ulMinLatency )
+        {
+            pxStats->ulMinLatency = ulLatency;
+        }
+
+        /* Bucket 0 counts latencies under 1us, bucket n those from 2^(n-1)us
+         * up to 2^n us, and the last bucket everything longer. */
+        for( ulMicroseconds = ulLatency / ( uint32_t ) configTASK_LATENCY_COUNTS_PER_US;
+             ( ulMicroseconds != 0UL ) && ( ulBucket < ( tskLATENCY_HISTOGRAM_BUCKETS - 1UL ) );
+             ulMicroseconds >>= 1 )
+        {
+            ulBucket++;
+        }
+
+        pxStats->ulHistogram[ ulBucket ]++;
+
+        /* The time between two runs that both followed a timed wakeup is the
+         * period of a task that uses xTaskDelayUntil(), so its spread is the
+         * task's jitter.  Any other wakeup starts the measurement again. */
+        if( pxTCB->ucWakeReason == tskWAKE_TIMED )
+        {
+            if( pxTCB->ucLastTimedRunValid != ( uint8_t ) pdFALSE )
+            {
+                ulPeriod = ulNow - pxTCB->ulLastTimedRun;
+
+                if( ulPeriod > pxStats->ulMaxPeriod )
+                {
+                    pxStats->ulMaxPeriod = ulPeriod;
+                }
+
+                if( ulPeriod < pxStats->ulMinPeriod )
+                {
+                    pxStats->ulMinPeriod = ulPeriod;
+                }
+            }
+
+            pxTCB->ulLastTimedRun = ulNow;
+            pxTCB->ucLastTimedRunValid = ( uint8_t ) pdTRUE;
+        }
+        else
+        {
+            pxTCB->ucLastTimedRunValid = ( uint8_t ) pdFALSE;
+        }
+
+        pxTCB->ucWakeReason = tskWAKE_NONE;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvResetLatencyStats( TCB_t * const pxTCB )
+    {
+        ( void ) memset( ( void * ) &( pxTCB->xLatencyStats ), 0x00, sizeof( TaskLatencyStats_t ) );
+        pxTCB->xLatencyStats.ulMinLatency = 0xffffffffUL;
+        pxTCB->xLatencyStats.ulMinPeriod = 0xffffffffUL;
+        pxTCB->ucLastTimedRunValid = ( uint8_t ) pdFALSE;
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskResetLatencyStats( TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB;
+
+        taskENTER_CRITICAL();
+        {
+            /* If null is passed in here then the calling task's statistics are
+             * being reset. */
+            pxTCB = prvGetTCBFromHandle( xTask );
+            prvResetLatencyStats( pxTCB );
+        }
+        taskEXIT_CRITICAL();
+    }
+
+#endif /* configUSE_TASK_LATENCY_STATS */
+/*-----------------------------------------------------------*/
+
 static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
                                             const BaseType_t xCanBlockIndefinitely )
 {
@@ -41,6 +41,9 @@ extern uint32_t SystemCoreClock;
 #define configTOTAL_HEAP_SIZE                           ((size_t)(10 * 1024))   /* FreeRTOS堆中可用的RAM总量, 单位: Byte, 无默认需定义 */
 #define configAPPLICATION_ALLOCATED_HEAP                0                       /* 1: 用户手动分配FreeRTOS内存堆(ucHeap), 默认: 0 */
 #define configSTACK_ALLOCATION_FROM_SEPARATE_HEAP       0                       /* 1: 用户自行实现任务创建时使用的内存申请与释放函数, 默认: 0 */
+#define configUSE_HEAP_FRAG_STATS                       0                       /* 1: heap_4/heap_5统计空闲块和申请大小的分布、碎片率, 并记录申请失败时的堆状态, 默认: 0 */
+#define configHEAP_FRAG_SIZE_CLASSES                    8                       /* 分布统计的大小级数, 第0级小于32字节, 之后每级大小翻倍 */
+#define configHEAP_FAILURE_LOG_LENGTH                   4                       /* 记录最近几次申请失败 */
 
 /* 钩子函数相关定义 */
 #define configUSE_IDLE_HOOK                             0                       /* 1: 使能空闲任务钩子函数, 无默认需定义  */
@@ -59,6 +62,13 @@ extern uint32_t FreeRTOSRunTimeTicks;
 #endif
 #define configUSE_TRACE_FACILITY                        1                       /* 1: 使能可视化跟踪调试, 默认: 0 */
 #define configUSE_STATS_FORMATTING_FUNCTIONS            1                       /* 1: configUSE_TRACE_FACILITY为1时，会编译vTaskList()和vTaskGetRunTimeStats()函数, 默认: 0 */
+#define configTASK_STATS_CHUNK_SIZE                     4                       /* xTaskListStream()等流式统计函数每次挂起调度器时读取的任务数, 默认: 4 */
+#define configUSE_TASK_LATENCY_STATS                    0                       /* 1: 统计任务唤醒延迟和周期抖动, 结果在TaskStatus_t的xLatencyStats中, 默认: 0 */
+#define configTASK_LATENCY_TIMESTAMP()                  (DWT->CYCCNT)           /* 时间戳, 使用DWT周期计数器, 由delay_init使能 */
+#define configTASK_LATENCY_COUNTS_PER_US                (configCPU_CLOCK_HZ / 1000000)  /* 每us的时间戳计数值 */
+#define configUSE_STACK_PROFILER                        0                       /* 1: 空闲任务逐步扫描任务栈, 统计栈使用量并给出推荐栈大小(需要configUSE_TRACE_FACILITY为1), 默认: 0 */
+#define configSTACK_PROFILER_WORDS_PER_STEP             32                      /* 空闲任务每次循环最多检查的栈字数, 默认: 32 */
+#define configSTACK_PROFILER_MARGIN_WORDS               16                      /* 剩余栈小于此字数时调用vApplicationStackMarginHook(), 默认: 16 */
 
 /* 协程相关定义 */
 #define configUSE_CO_ROUTINES                           0                       /* 1: 启用协程, 默认: 0 */
@@ -101,6 +111,8 @@ extern uint32_t FreeRTOSRunTimeTicks;
 #define configKERNEL_INTERRUPT_PRIORITY                 ( configLIBRARY_LOWEST_INTERRUPT_PRIORITY << (8 - configPRIO_BITS) )
 #define configMAX_SYSCALL_INTERRUPT_PRIORITY            ( configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY << (8 - configPRIO_BITS) )
 #define configMAX_API_CALL_INTERRUPT_PRIORITY           configMAX_SYSCALL_INTERRUPT_PRIORITY
+#define configUSE_CRITICAL_PROFILER                     0                   /* 1: 统计每处临界区/关中断(BASEPRI)的最长时间和时间分布, 用于评估最坏中断延迟, 默认: 0 */
+#define configCRITICAL_PROFILER_SITES                   16                  /* 分开统计的调用位置个数 */
 
 /* FreeRTOS中断服务函数相关定义 */
 #define xPortPendSVHandler                              PendSV_Handler
@@ -110,6 +122,33 @@ extern uint32_t FreeRTOSRunTimeTicks;
 #define vAssertCalled(char, int) printf("Error: %s, %d\r\n", char, int)
 #define configASSERT( x ) if( ( x ) == 0 ) vAssertCalled( __FILE__, __LINE__ )
 
+/* 内核事件追踪记录器相关定义 */
+#define configUSE_TRACE_RECORDER                        0                       /* 1: 使能内核事件追踪记录器(需要configUSE_TRACE_FACILITY为1), 默认: 0 */
+#define configTRACE_RECORDER_MODE                       trcMODE_SNAPSHOT        /* trcMODE_SNAPSHOT: 循环覆盖, 停止后导出; trcMODE_STREAM: 由追踪任务通过串口连续发出 */
+#define configTRACE_RECORDER_BUFFER_RECORDS             256                     /* 事件环形缓冲区的记录数, 每条8字节, 必须是2的幂 */
+#define configTRACE_RECORDER_WRITE(data, len)           usart_write(data, len)  /* 追踪数据的输出函数 */
+#if configUSE_TRACE_RECORDER
+#include "trace_recorder.h"
+#endif
+
+/* CPU负载统计相关定义 */
+#define configUSE_CPU_LOAD                              0                       /* 1: 按时间窗口统计CPU负载和各任务占用率(需要configGENERATE_RUN_TIME_STATS为1), 默认: 0 */
+#define configCPU_LOAD_WINDOW_MS                        1000                    /* 统计窗口长度, 单位: ms */
+#define configCPU_LOAD_MAX_TASKS                        16                      /* 最多统计的任务个数 */
+#define configCPU_LOAD_ISR_TIME                         0                       /* 1: 同时统计调用traceISR_ENTER/EXIT的中断占用的时间, 默认: 0 */
+
+/* 内存分配跟踪相关定义 */
+#define configUSE_HEAP_TRACKER                          0                       /* 1: 记录每块已分配内存的所属任务/调用位置/分配时间, 统计各任务内存用量, 用于查找内存泄漏, 默认: 0 */
+#define configHEAP_TRACK_MAX_BLOCKS                     64                      /* 最多记录的已分配内存块数 */
+#define configHEAP_TRACK_MAX_TASKS                      16                      /* 最多统计的任务个数 */
+
+/* 延迟格式化日志相关定义 */
+#define configUSE_DEFERRED_LOG                          0                       /* 1: 使能延迟格式化日志, 日志调用只把格式串地址和参数写入环形缓冲区, 由低优先级任务格式化输出, 默认: 0 */
+#define configDEFERRED_LOG_MODE                         logMODE_TEXT            /* logMODE_TEXT: 日志任务在板上格式化后输出文本; logMODE_BINARY: 输出二进制记录, 由Tools/logdec根据.axf文件还原 */
+#define configDEFERRED_LOG_BUFFER_WORDS                 256                     /* 日志环形缓冲区的大小, 单位: Word, 每条日志占3个字加上参数个数, 必须是2的幂 */
+#define configDEFERRED_LOG_TASK_PRIORITY                2                       /* 日志任务的优先级, 日志在它运行时才输出. 本实验的task1和task2一直忙等, 日志任务与它们同优先级才能得到运行 */
+#define configDEFERRED_LOG_WRITE(data, len)             usart_write(data, len)  /* 日志的输出函数 */
+
 /* FreeRTOS MPU 特殊定义 */
 //#define configINCLUDE_APPLICATION_DEFINED_PRIVILEGED_FUNCTIONS 0
 //#define configTOTAL_MPU_REGIONS                                8
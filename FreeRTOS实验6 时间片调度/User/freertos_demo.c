@@ -28,6 +28,9 @@
 /*FreeRTOS*********************************************************************************************/
 #include "FreeRTOS.h"
 #include "task.h"
+#if configUSE_DEFERRED_LOG
+#include "deferred_log.h"
+#endif
 
 /******************************************************************************************************/
 /*FreeRTOS配置*/
@@ -66,10 +69,14 @@ void task1( void * pvParameters )
     uint32_t task1_num = 0;
     while(1)
     {
+#if configUSE_DEFERRED_LOG
+        logPRINTF1(logLEVEL_INFO, "task1运行次数: %d", ++task1_num);   /* 只记下格式串地址和参数, 几十个周期, 由日志任务格式化后输出, 不需要临界区 */
+#else
         taskENTER_CRITICAL();//进入临界区
         printf("task1运行次数: %d\r\n", ++task1_num);
         taskEXIT_CRITICAL();//退出临界区
-        delay_ms(10);
+#endif
+        delay_us(10 * 1000);                /* 忙等10ms, 不让出CPU, 这样才能看到同优先级任务按时间片轮流执行 */
         
     }
 }
@@ -81,10 +88,14 @@ void task2( void * pvParameters )
     uint32_t task2_num = 0;
     while(1)
     {
+#if configUSE_DEFERRED_LOG
+        logPRINTF1(logLEVEL_INFO, "task2运行次数: %d", ++task2_num);   /* 只记下格式串地址和参数, 几十个周期, 由日志任务格式化后输出, 不需要临界区 */
+#else
         taskENTER_CRITICAL();//进入临界区
         printf("task2运行次数: %d\r\n", ++task2_num);
         taskEXIT_CRITICAL();//退出临界区
-        delay_ms(10);
+#endif
+        delay_us(10 * 1000);                /* 忙等10ms, 不让出CPU, 这样才能看到同优先级任务按时间片轮流执行 */
     }
 }
 
@@ -127,6 +138,10 @@ void start_task( void * pvParameters )
  */
 void freertos_demo(void)
 {
+#if configUSE_DEFERRED_LOG
+    vLogEnable();           /* 创建日志任务. task1和task2一直忙等不阻塞, 所以本实验把日志任务设为同优先级, 按时间片轮流运行 */
+#endif
+
     xTaskCreate((TaskFunction_t         )   start_task,             //任务函数
                (char *                  )   "start_task",           //任务名
                (configSTACK_DEPTH_TYPE  )   START_TASK_STACK_SIZE,  //任务栈大小
@@ -0,0 +1,553 @@
+/**
+ ****************************************************************************************************
+ * @file        lcd_task.c
+ * @author      正点原子团队(ALIENTEK)
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       LCD 绘图任务(异步绘图命令队列) 驱动代码
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 STM32F103开发板
+ * 在线视频:www.yuanzige.com
+ * 技术论坛:www.openedv.com
+ * 公司网址:www.alientek.com
+ * 购买地址:openedv.taobao.com
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#include "./BSP/LCD/lcd.h"
+#include "./BSP/LCD/lcd_task.h"
+
+#if LCD_EN_TASK
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "string.h"
+
+
+/* 绘图命令 */
+#define LCD_OP_FENCE        0       /* 同步点, 通知等待的任务 */
+#define LCD_OP_CLEAR        1       /* 清屏 */
+#define LCD_OP_POINT        2       /* 画点 */
+#define LCD_OP_FILL         3       /* 纯色填充矩形 */
+#define LCD_OP_COLOR_FILL   4       /* 彩色填充矩形 */
+#define LCD_OP_LINE         5       /* 画直线 */
+#define LCD_OP_RECT         6       /* 画矩形 */
+#define LCD_OP_CIRCLE       7       /* 画圆 */
+#define LCD_OP_NUM          8       /* 显示数字 */
+#define LCD_OP_STRING       9       /* 显示字符串 */
+#define LCD_OP_COMP_FLUSH   10      /* 刷新画布 */
+
+typedef struct
+{
+    uint8_t op;                     /* 命令, LCD_OP_xxx */
+    uint8_t size;                   /* 字体大小 / 圆的半径 */
+    uint8_t len;                    /* 数字位数 */
+    uint16_t x1, y1, x2, y2;        /* 坐标, 字符串命令的 x2,y2 为区域宽度和高度 */
+    uint16_t color;
+    union
+    {
+        char str[LCD_TASK_STR_LEN]; /* LCD_OP_STRING */
+        uint32_t num;               /* LCD_OP_NUM */
+        uint16_t *img;              /* LCD_OP_COLOR_FILL */
+        _lcd_comp *comp;            /* LCD_OP_COMP_FLUSH */
+        struct
+        {
+            TaskHandle_t task;      /* 等待的任务 */
+            uint32_t seq;           /* 同步点序号 */
+        } fence;                    /* LCD_OP_FENCE */
+    } arg;
+} _lcd_cmd;
+
+static QueueHandle_t g_lcd_task_queue = NULL;
+static uint32_t g_lcd_task_fence_seq = 0;
+static _lcd_cmd g_lcd_task_batch[LCD_TASK_BATCH_LEN];   /* 只在绘图任务中使用, 放在静态区节省任务堆栈 */
+
+/**
+ * @brief       计算命令影响的屏幕区域
+ * @param       cmd    : 命令
+ * @param       sx,sy,ex,ey: 区域对角坐标
+ * @retval      无
+ */
+static void lcd_task_cmd_area(const _lcd_cmd *cmd, uint16_t *sx, uint16_t *sy, uint16_t *ex, uint16_t *ey)
+{
+    switch (cmd->op)
+    {
+        case LCD_OP_CLEAR:
+            *sx = 0;
+            *sy = 0;
+            *ex = lcddev.width - 1;
+            *ey = lcddev.height - 1;
+            break;
+
+        case LCD_OP_CIRCLE:
+            *sx = (cmd->x1 > cmd->size) ? cmd->x1 - cmd->size : 0;
+            *sy = (cmd->y1 > cmd->size) ? cmd->y1 - cmd->size : 0;
+            *ex = cmd->x1 + cmd->size;
+            *ey = cmd->y1 + cmd->size;
+            break;
+
+        case LCD_OP_NUM:
+            *sx = cmd->x1;
+            *sy = cmd->y1;
+            *ex = cmd->x1 + cmd->len * (cmd->size / 2) - 1;
+            *ey = cmd->y1 + cmd->size - 1;
+            break;
+
+        case LCD_OP_STRING:
+            *sx = cmd->x1;
+            *sy = cmd->y1;
+            *ex = cmd->x1 + cmd->x2 + cmd->size / 2 - 1;    /* lcd_show_string 最后一个字符可能超出区域宽度 */
+            *ey = cmd->y1 + cmd->y2 + cmd->size - 1;
+            break;
+
+        case LCD_OP_COMP_FLUSH:
+            *sx = cmd->arg.comp->x;
+            *sy = cmd->arg.comp->y;
+            *ex = cmd->arg.comp->x + cmd->arg.comp->width - 1;
+            *ey = cmd->arg.comp->y + cmd->arg.comp->height - 1;
+            break;
+
+        default:    /* 点/矩形/直线 */
+            *sx = (cmd->x1 < cmd->x2) ? cmd->x1 : cmd->x2;
+            *sy = (cmd->y1 < cmd->y2) ? cmd->y1 : cmd->y2;
+            *ex = (cmd->x1 < cmd->x2) ? cmd->x2 : cmd->x1;
+            *ey = (cmd->y1 < cmd->y2) ? cmd->y2 : cmd->y1;
+            break;
+    }
+}
+
+/**
+ * @brief       判断命令是否被后面的命令完全覆盖
+ * @param       cmd    : 要判断的命令
+ * @param       later  : 后面的命令
+ * @retval      0, 没有覆盖; 1, 覆盖, cmd 不需要执行;
+ */
+static uint8_t lcd_task_cmd_covered(const _lcd_cmd *cmd, const _lcd_cmd *later)
+{
+    uint16_t sx, sy, ex, ey;
+    uint16_t lsx, lsy, lex, ley;
+
+    if (memcmp(cmd, later, sizeof(_lcd_cmd)) == 0)  /* 相同命令写出的点完全相同 */
+    {
+        return 1;
+    }
+
+    if (cmd->op == LCD_OP_COMP_FLUSH)
+    {
+        return 0;   /* 画布刷新会清除脏标记, 不能因为被覆盖而跳过 */
+    }
+
+    if (later->op != LCD_OP_CLEAR && later->op != LCD_OP_FILL && later->op != LCD_OP_COLOR_FILL)
+    {
+        return 0;   /* 只有不透明的矩形命令才能覆盖其他命令 */
+    }
+
+    lcd_task_cmd_area(cmd, &sx, &sy, &ex, &ey);
+    lcd_task_cmd_area(later, &lsx, &lsy, &lex, &ley);
+
+    return (lsx <= sx && lsy <= sy && lex >= ex && ley >= ey);
+}
+
+/**
+ * @brief       执行一条命令
+ * @param       cmd    : 命令
+ * @retval      无
+ */
+static void lcd_task_cmd_exec(_lcd_cmd *cmd)
+{
+    switch (cmd->op)
+    {
+        case LCD_OP_FENCE:
+            xTaskNotifyIndexed(cmd->arg.fence.task, LCD_TASK_NOTIFY_INDEX, cmd->arg.fence.seq, eSetValueWithOverwrite);
+            break;
+
+        case LCD_OP_CLEAR:
+            lcd_clear(cmd->color);
+            break;
+
+        case LCD_OP_POINT:
+            lcd_draw_point(cmd->x1, cmd->y1, cmd->color);
+            break;
+
+        case LCD_OP_FILL:
+            lcd_fill(cmd->x1, cmd->y1, cmd->x2, cmd->y2, cmd->color);
+            break;
+
+        case LCD_OP_COLOR_FILL:
+            lcd_color_fill(cmd->x1, cmd->y1, cmd->x2, cmd->y2, cmd->arg.img);
+            break;
+
+        case LCD_OP_LINE:
+            lcd_draw_line(cmd->x1, cmd->y1, cmd->x2, cmd->y2, cmd->color);
+            break;
+
+        case LCD_OP_RECT:
+            lcd_draw_rectangle(cmd->x1, cmd->y1, cmd->x2, cmd->y2, cmd->color);
+            break;
+
+        case LCD_OP_CIRCLE:
+            lcd_draw_circle(cmd->x1, cmd->y1, cmd->size, cmd->color);
+            break;
+
+        case LCD_OP_NUM:
+            lcd_show_num(cmd->x1, cmd->y1, cmd->arg.num, cmd->len, cmd->size, cmd->color);
+            break;
+
+        case LCD_OP_STRING:
+            lcd_show_string(cmd->x1, cmd->y1, cmd->x2, cmd->y2, cmd->size, cmd->arg.str, cmd->color);
+            break;
+
+        case LCD_OP_COMP_FLUSH:
+            lcd_comp_flush(cmd->arg.comp);
+            break;
+
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief       绘图任务
+ *   @note      阻塞等待第一条命令, 再把队列中已有的命令一起取出(最多 LCD_TASK_BATCH_LEN 条),
+ *              去掉被同批后面命令覆盖的命令后依次执行.
+ * @param       pvParameters : 传入参数(未用到)
+ * @retval      无
+ */
+static void lcd_task(void *pvParameters)
+{
+    uint8_t num, i, j;
+    _lcd_cmd *batch = g_lcd_task_batch;
+
+    while (1)
+    {
+        xQueueReceive(g_lcd_task_queue, &batch[0], portMAX_DELAY);
+        num = 1;
+
+        while (num < LCD_TASK_BATCH_LEN && xQueueReceive(g_lcd_task_queue, &batch[num], 0) == pdPASS)
+        {
+            num++;
+        }
+
+        for (i = 0; i < num; i++)
+        {
+            if (batch[i].op != LCD_OP_FENCE)
+            {
+                for (j = i + 1; j < num && batch[j].op != LCD_OP_FENCE; j++)   /* 不跨过同步点 */
+                {
+                    if (lcd_task_cmd_covered(&batch[i], &batch[j]))
+                    {
+                        break;
+                    }
+                }
+
+                if (j < num && batch[j].op != LCD_OP_FENCE)
+                {
+                    continue;   /* 被后面的命令覆盖, 不需要执行 */
+                }
+            }
+
+            lcd_task_cmd_exec(&batch[i]);
+        }
+    }
+}
+
+/**
+ * @brief       把命令放入队列
+ * @param       cmd    : 命令
+ * @retval      0, 成功; 1, 绘图任务未创建;
+ */
+static uint8_t lcd_task_send(const _lcd_cmd *cmd)
+{
+    if (g_lcd_task_queue == NULL)
+    {
+        return 1;
+    }
+
+    xQueueSend(g_lcd_task_queue, cmd, portMAX_DELAY);   /* 队列满时等待绘图任务取走命令 */
+    return 0;
+}
+
+/**
+ * @brief       创建绘图任务
+ * @param       无
+ * @retval      0, 成功; 1, 内存不足;
+ */
+uint8_t lcd_task_init(void)
+{
+    if (g_lcd_task_queue != NULL)
+    {
+        return 0;
+    }
+
+    g_lcd_task_queue = xQueueCreate(LCD_TASK_QUEUE_LEN, sizeof(_lcd_cmd));
+
+    if (g_lcd_task_queue == NULL)
+    {
+        return 1;
+    }
+
+    if (xTaskCreate(lcd_task, "lcd_task", LCD_TASK_STACK_SIZE, NULL, LCD_TASK_PRIO, NULL) != pdPASS)
+    {
+        vQueueDelete(g_lcd_task_queue);
+        g_lcd_task_queue = NULL;
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief       等待之前提交的命令执行完成
+ *   @note      同步点带有序号, 超时后迟到的通知会因序号不符被下一次等待忽略.
+ * @param       wait   : 最长等待时间, 单位: 系统时钟节拍
+ * @retval      0, 命令已全部执行; 1, 超时或绘图任务未创建;
+ */
+uint8_t lcd_task_fence(TickType_t wait)
+{
+    _lcd_cmd cmd;
+    TimeOut_t timeout;
+    uint32_t value;
+
+    memset(&cmd, 0, sizeof(cmd));
+    cmd.op = LCD_OP_FENCE;
+    cmd.arg.fence.task = xTaskGetCurrentTaskHandle();
+
+    taskENTER_CRITICAL();
+    cmd.arg.fence.seq = ++g_lcd_task_fence_seq;
+    taskEXIT_CRITICAL();
+
+    vTaskSetTimeOutState(&timeout);
+
+    if (lcd_task_send(&cmd))
+    {
+        return 1;
+    }
+
+    do
+    {
+        if (xTaskNotifyWaitIndexed(LCD_TASK_NOTIFY_INDEX, 0, 0xFFFFFFFF, &value, wait) == pdFALSE)
+        {
+            return 1;
+        }
+
+        if (value == cmd.arg.fence.seq)
+        {
+            return 0;
+        }
+    } while (xTaskCheckForTimeOut(&timeout, &wait) == pdFALSE);
+
+    return 1;
+}
+
+/**
+ * @brief       清屏
+ * @param       color  : 要清屏的颜色
+ * @retval      0, 成功; 1, 绘图任务未创建;
+ */
+uint8_t lcd_task_clear(uint16_t color)
+{
+    _lcd_cmd cmd;
+
+    memset(&cmd, 0, sizeof(cmd));   /* 清零填充字节, 合并时按内存比较命令 */
+    cmd.op = LCD_OP_CLEAR;
+    cmd.color = color;
+    return lcd_task_send(&cmd);
+}
+
+/**
+ * @brief       画点
+ * @param       x,y    : 坐标
+ * @param       color  : 点的颜色
+ * @retval      0, 成功; 1, 绘图任务未创建;
+ */
+uint8_t lcd_task_draw_point(uint16_t x, uint16_t y, uint16_t color)
+{
+    _lcd_cmd cmd;
+
+    memset(&cmd, 0, sizeof(cmd));
+    cmd.op = LCD_OP_POINT;
+    cmd.x1 = cmd.x2 = x;
+    cmd.y1 = cmd.y2 = y;
+    cmd.color = color;
+    return lcd_task_send(&cmd);
+}
+
+/**
+ * @brief       在指定区域内填充单个颜色
+ * @param       (sx,sy),(ex,ey): 填充矩形对角坐标
+ * @param       color  : 要填充的颜色
+ * @retval      0, 成功; 1, 绘图任务未创建;
+ */
+uint8_t lcd_task_fill(uint16_t sx, uint16_t sy, uint16_t ex, uint16_t ey, uint16_t color)
+{
+    _lcd_cmd cmd;
+
+    memset(&cmd, 0, sizeof(cmd));
+    cmd.op = LCD_OP_FILL;
+    cmd.x1 = sx;
+    cmd.y1 = sy;
+    cmd.x2 = ex;
+    cmd.y2 = ey;
+    cmd.color = color;
+    return lcd_task_send(&cmd);
+}
+
+/**
+ * @brief       在指定区域内填充指定颜色块
+ *   @note      只保存颜色数组的指针, lcd_task_fence 返回之前不能修改该数组.
+ * @param       (sx,sy),(ex,ey): 填充矩形对角坐标
+ * @param       color  : 要填充的颜色数组首地址
+ * @retval      0, 成功; 1, 绘图任务未创建;
+ */
+uint8_t lcd_task_color_fill(uint16_t sx, uint16_t sy, uint16_t ex, uint16_t ey, uint16_t *color)
+{
+    _lcd_cmd cmd;
+
+    memset(&cmd, 0, sizeof(cmd));
+    cmd.op = LCD_OP_COLOR_FILL;
+    cmd.x1 = sx;
+    cmd.y1 = sy;
+    cmd.x2 = ex;
+    cmd.y2 = ey;
+    cmd.arg.img = color;
+    return lcd_task_send(&cmd);
+}
+
+/**
+ * @brief       画线
+ * @param       x1,y1  : 起点坐标
+ * @param       x2,y2  : 终点坐标
+ * @param       color  : 线的颜色
+ * @retval      0, 成功; 1, 绘图任务未创建;
+ */
+uint8_t lcd_task_draw_line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color)
+{
+    _lcd_cmd cmd;
+
+    memset(&cmd, 0, sizeof(cmd));
+    cmd.op = LCD_OP_LINE;
+    cmd.x1 = x1;
+    cmd.y1 = y1;
+    cmd.x2 = x2;
+    cmd.y2 = y2;
+    cmd.color = color;
+    return lcd_task_send(&cmd);
+}
+
+/**
+ * @brief       画矩形
+ * @param       x1,y1  : 起点坐标
+ * @param       x2,y2  : 终点坐标
+ * @param       color  : 矩形的颜色
+ * @retval      0, 成功; 1, 绘图任务未创建;
+ */
+uint8_t lcd_task_draw_rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color)
+{
+    _lcd_cmd cmd;
+
+    memset(&cmd, 0, sizeof(cmd));
+    cmd.op = LCD_OP_RECT;
+    cmd.x1 = x1;
+    cmd.y1 = y1;
+    cmd.x2 = x2;
+    cmd.y2 = y2;
+    cmd.color = color;
+    return lcd_task_send(&cmd);
+}
+
+/**
+ * @brief       画圆
+ * @param       x0,y0  : 圆中心坐标
+ * @param       r      : 半径
+ * @param       color  : 圆的颜色
+ * @retval      0, 成功; 1, 绘图任务未创建;
+ */
+uint8_t lcd_task_draw_circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color)
+{
+    _lcd_cmd cmd;
+
+    memset(&cmd, 0, sizeof(cmd));
+    cmd.op = LCD_OP_CIRCLE;
+    cmd.x1 = x0;
+    cmd.y1 = y0;
+    cmd.size = r;
+    cmd.color = color;
+    return lcd_task_send(&cmd);
+}
+
+/**
+ * @brief       显示len个数字
+ * @param       x,y    : 起始坐标
+ * @param       num    : 数值(0 ~ 2^32)
+ * @param       len    : 显示数字的位数
+ * @param       size   : 选择字体 12/16/24/32
+ * @param       color  : 数字的颜色
+ * @retval      0, 成功; 1, 绘图任务未创建;
+ */
+uint8_t lcd_task_show_num(uint16_t x, uint16_t y, uint32_t num, uint8_t len, uint8_t size, uint16_t color)
+{
+    _lcd_cmd cmd;
+
+    memset(&cmd, 0, sizeof(cmd));
+    cmd.op = LCD_OP_NUM;
+    cmd.x1 = x;
+    cmd.y1 = y;
+    cmd.len = len;
+    cmd.size = size;
+    cmd.color = color;
+    cmd.arg.num = num;
+    return lcd_task_send(&cmd);
+}
+
+/**
+ * @brief       显示字符串
+ *   @note      字符串被复制到命令中, 超过 LCD_TASK_STR_LEN - 1 个字符的部分不显示.
+ * @param       x,y         : 起始坐标
+ * @param       width,height: 区域大小
+ * @param       size        : 选择字体 12/16/24/32
+ * @param       p           : 字符串首地址
+ * @param       color       : 字符串的颜色
+ * @retval      0, 成功; 1, 绘图任务未创建;
+ */
+uint8_t lcd_task_show_string(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t size, char *p, uint16_t color)
+{
+    _lcd_cmd cmd;
+
+    memset(&cmd, 0, sizeof(cmd));
+    cmd.op = LCD_OP_STRING;
+    cmd.x1 = x;
+    cmd.y1 = y;
+    cmd.x2 = width;
+    cmd.y2 = height;
+    cmd.size = size;
+    cmd.color = color;
+    strncpy(cmd.arg.str, p, LCD_TASK_STR_LEN - 1);
+    return lcd_task_send(&cmd);
+}
+
+/**
+ * @brief       把画布的脏区域写到屏幕
+ *   @note      lcd_task_fence 返回之前不能再修改该画布.
+ * @param       comp   : 画布
+ * @retval      0, 成功; 1, 绘图任务未创建;
+ */
+uint8_t lcd_task_comp_flush(_lcd_comp *comp)
+{
+    _lcd_cmd cmd;
+
+    memset(&cmd, 0, sizeof(cmd));
+    cmd.op = LCD_OP_COMP_FLUSH;
+    cmd.arg.comp = comp;
+    return lcd_task_send(&cmd);
+}
+
+#endif
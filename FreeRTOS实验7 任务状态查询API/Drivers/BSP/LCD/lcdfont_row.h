@@ -0,0 +1,417 @@
+/**
+ ****************************************************************************************************
+ * @file        lcdfont_row.h
+ * @author      正点原子团队(ALIENTEK)
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       逐行ASCII字库, 由 Tools/fontconv 根据 lcdfont.h 生成, 不要手工修改
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
+ ****************************************************************************************************
+ * @attention
+ *
+ * 每个字符 size 行, 每行一个整数, 第 n 位对应第 n 列(1为有效点).
+ * 宽度不超过8的字体(12/16)每行占1字节, 其余每行占2字节.
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __LCDFONT_ROW_H
+#define __LCDFONT_ROW_H
+
+/* 6*12 ASCII字符集逐行点阵 */
+const unsigned char asc2_1206_row[95][12] = {
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*" ",0*/
+{0x00,0x00,0x04,0x04,0x04,0x04,0x04,0x04,0x00,0x04,0x00,0x00},/*"!",1*/
+{0x00,0x14,0x0A,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*""",2*/
+{0x00,0x00,0x14,0x14,0x3F,0x14,0x0A,0x3F,0x0A,0x0A,0x00,0x00},/*"#",3*/
+{0x00,0x04,0x1E,0x15,0x05,0x06,0x0C,0x14,0x15,0x0F,0x04,0x00},/*"$",4*/
+{0x00,0x00,0x12,0x15,0x0D,0x0A,0x14,0x2C,0x2A,0x12,0x00,0x00},/*"%",5*/
+{0x00,0x00,0x04,0x0A,0x0A,0x1E,0x15,0x15,0x09,0x36,0x00,0x00},/*"&",6*/
+{0x00,0x02,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"'",7*/
+{0x00,0x20,0x10,0x08,0x08,0x08,0x08,0x08,0x08,0x10,0x20,0x00},/*"(",8*/
+{0x00,0x02,0x04,0x08,0x08,0x08,0x08,0x08,0x08,0x04,0x02,0x00},/*")",9*/
+{0x00,0x00,0x00,0x04,0x15,0x0E,0x0E,0x15,0x04,0x00,0x00,0x00},/*"*",10*/
+{0x00,0x00,0x04,0x04,0x04,0x1F,0x04,0x04,0x04,0x00,0x00,0x00},/*"+",11*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x01},/*",",12*/
+{0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x00},/*"-",13*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00},/*".",14*/
+{0x00,0x10,0x08,0x08,0x08,0x04,0x04,0x02,0x02,0x02,0x01,0x00},/*"/",15*/
+{0x00,0x00,0x0E,0x11,0x11,0x11,0x11,0x11,0x11,0x0E,0x00,0x00},/*"0",16*/
+{0x00,0x00,0x04,0x06,0x04,0x04,0x04,0x04,0x04,0x0E,0x00,0x00},/*"1",17*/
+{0x00,0x00,0x0E,0x11,0x11,0x08,0x04,0x02,0x01,0x1F,0x00,0x00},/*"2",18*/
+{0x00,0x00,0x0E,0x11,0x10,0x0C,0x10,0x10,0x11,0x0E,0x00,0x00},/*"3",19*/
+{0x00,0x00,0x08,0x0C,0x0A,0x0A,0x09,0x1E,0x08,0x18,0x00,0x00},/*"4",20*/
+{0x00,0x00,0x1F,0x01,0x01,0x0F,0x10,0x10,0x11,0x0E,0x00,0x00},/*"5",21*/
+{0x00,0x00,0x0E,0x09,0x01,0x0F,0x11,0x11,0x11,0x0E,0x00,0x00},/*"6",22*/
+{0x00,0x00,0x1F,0x09,0x08,0x04,0x04,0x04,0x04,0x04,0x00,0x00},/*"7",23*/
+{0x00,0x00,0x0E,0x11,0x11,0x0E,0x11,0x11,0x11,0x0E,0x00,0x00},/*"8",24*/
+{0x00,0x00,0x0E,0x11,0x11,0x11,0x1E,0x10,0x12,0x0E,0x00,0x00},/*"9",25*/
+{0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x04,0x00,0x00},/*":",26*/
+{0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x04,0x00},/*";",27*/
+{0x00,0x20,0x10,0x08,0x04,0x02,0x04,0x08,0x10,0x20,0x00,0x00},/*"<",28*/
+{0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x1F,0x00,0x00,0x00,0x00},/*"=",29*/
+{0x00,0x02,0x04,0x08,0x10,0x20,0x10,0x08,0x04,0x02,0x00,0x00},/*">",30*/
+{0x00,0x00,0x0E,0x11,0x11,0x08,0x04,0x04,0x00,0x04,0x00,0x00},/*"?",31*/
+{0x00,0x00,0x0E,0x11,0x19,0x15,0x15,0x1D,0x01,0x1E,0x00,0x00},/*"@",32*/
+{0x00,0x00,0x04,0x04,0x0C,0x0A,0x0A,0x1E,0x12,0x33,0x00,0x00},/*"A",33*/
+{0x00,0x00,0x0F,0x12,0x12,0x0E,0x12,0x12,0x12,0x0F,0x00,0x00},/*"B",34*/
+{0x00,0x00,0x1E,0x11,0x01,0x01,0x01,0x01,0x11,0x0E,0x00,0x00},/*"C",35*/
+{0x00,0x00,0x0F,0x12,0x12,0x12,0x12,0x12,0x12,0x0F,0x00,0x00},/*"D",36*/
+{0x00,0x00,0x1F,0x12,0x0A,0x0E,0x0A,0x02,0x12,0x1F,0x00,0x00},/*"E",37*/
+{0x00,0x00,0x1F,0x12,0x0A,0x0E,0x0A,0x02,0x02,0x07,0x00,0x00},/*"F",38*/
+{0x00,0x00,0x1C,0x12,0x01,0x01,0x39,0x11,0x12,0x0C,0x00,0x00},/*"G",39*/
+{0x00,0x00,0x33,0x12,0x12,0x1E,0x12,0x12,0x12,0x33,0x00,0x00},/*"H",40*/
+{0x00,0x00,0x1F,0x04,0x04,0x04,0x04,0x04,0x04,0x1F,0x00,0x00},/*"I",41*/
+{0x00,0x00,0x3E,0x08,0x08,0x08,0x08,0x08,0x08,0x09,0x07,0x00},/*"J",42*/
+{0x00,0x00,0x37,0x12,0x0A,0x06,0x0A,0x0A,0x12,0x37,0x00,0x00},/*"K",43*/
+{0x00,0x00,0x07,0x02,0x02,0x02,0x02,0x02,0x22,0x3F,0x00,0x00},/*"L",44*/
+{0x00,0x00,0x1B,0x1B,0x1B,0x1B,0x15,0x15,0x15,0x15,0x00,0x00},/*"M",45*/
+{0x00,0x00,0x3B,0x12,0x16,0x16,0x1A,0x1A,0x12,0x17,0x00,0x00},/*"N",46*/
+{0x00,0x00,0x0E,0x11,0x11,0x11,0x11,0x11,0x11,0x0E,0x00,0x00},/*"O",47*/
+{0x00,0x00,0x0F,0x12,0x12,0x0E,0x02,0x02,0x02,0x07,0x00,0x00},/*"P",48*/
+{0x00,0x00,0x0E,0x11,0x11,0x11,0x11,0x17,0x19,0x0E,0x18,0x00},/*"Q",49*/
+{0x00,0x00,0x0F,0x12,0x12,0x0E,0x0A,0x12,0x12,0x37,0x00,0x00},/*"R",50*/
+{0x00,0x00,0x1E,0x11,0x01,0x06,0x08,0x10,0x11,0x0F,0x00,0x00},/*"S",51*/
+{0x00,0x00,0x1F,0x15,0x04,0x04,0x04,0x04,0x04,0x0E,0x00,0x00},/*"T",52*/
+{0x00,0x00,0x33,0x12,0x12,0x12,0x12,0x12,0x12,0x0C,0x00,0x00},/*"U",53*/
+{0x00,0x00,0x33,0x12,0x12,0x0A,0x0A,0x0C,0x04,0x04,0x00,0x00},/*"V",54*/
+{0x00,0x00,0x15,0x15,0x15,0x0E,0x0A,0x0A,0x0A,0x0A,0x00,0x00},/*"W",55*/
+{0x00,0x00,0x1B,0x0A,0x0A,0x04,0x04,0x0A,0x0A,0x1B,0x00,0x00},/*"X",56*/
+{0x00,0x00,0x1B,0x0A,0x0A,0x04,0x04,0x04,0x04,0x0E,0x00,0x00},/*"Y",57*/
+{0x00,0x00,0x1F,0x09,0x08,0x04,0x04,0x02,0x12,0x1F,0x00,0x00},/*"Z",58*/
+{0x00,0x1C,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x1C,0x00},/*"[",59*/
+{0x00,0x02,0x02,0x02,0x04,0x04,0x08,0x08,0x08,0x10,0x00,0x00},/*"\",60*/
+{0x00,0x0E,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x0E,0x00},/*"]",61*/
+{0x00,0x04,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"^",62*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F},/*"_",63*/
+{0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"`",64*/
+{0x00,0x00,0x00,0x00,0x00,0x0C,0x12,0x1C,0x12,0x3C,0x00,0x00},/*"a",65*/
+{0x00,0x00,0x03,0x02,0x02,0x0E,0x12,0x12,0x12,0x0E,0x00,0x00},/*"b",66*/
+{0x00,0x00,0x00,0x00,0x00,0x1C,0x12,0x02,0x02,0x1C,0x00,0x00},/*"c",67*/
+{0x00,0x00,0x18,0x10,0x10,0x1C,0x12,0x12,0x12,0x3C,0x00,0x00},/*"d",68*/
+{0x00,0x00,0x00,0x00,0x00,0x0C,0x12,0x1E,0x02,0x1C,0x00,0x00},/*"e",69*/
+{0x00,0x00,0x38,0x04,0x04,0x1E,0x04,0x04,0x04,0x1E,0x00,0x00},/*"f",70*/
+{0x00,0x00,0x00,0x00,0x00,0x3C,0x12,0x0C,0x02,0x1E,0x22,0x1C},/*"g",71*/
+{0x00,0x00,0x03,0x02,0x02,0x0E,0x12,0x12,0x12,0x37,0x00,0x00},/*"h",72*/
+{0x00,0x00,0x04,0x00,0x00,0x06,0x04,0x04,0x04,0x0E,0x00,0x00},/*"i",73*/
+{0x00,0x00,0x08,0x00,0x00,0x0C,0x08,0x08,0x08,0x08,0x08,0x07},/*"j",74*/
+{0x00,0x00,0x03,0x02,0x02,0x3A,0x0A,0x0E,0x12,0x37,0x00,0x00},/*"k",75*/
+{0x00,0x00,0x07,0x04,0x04,0x04,0x04,0x04,0x04,0x1F,0x00,0x00},/*"l",76*/
+{0x00,0x00,0x00,0x00,0x00,0x0F,0x15,0x15,0x15,0x15,0x00,0x00},/*"m",77*/
+{0x00,0x00,0x00,0x00,0x00,0x0F,0x12,0x12,0x12,0x37,0x00,0x00},/*"n",78*/
+{0x00,0x00,0x00,0x00,0x00,0x0C,0x12,0x12,0x12,0x0C,0x00,0x00},/*"o",79*/
+{0x00,0x00,0x00,0x00,0x00,0x0F,0x12,0x12,0x12,0x0E,0x02,0x07},/*"p",80*/
+{0x00,0x00,0x00,0x00,0x00,0x1C,0x12,0x12,0x12,0x1C,0x10,0x38},/*"q",81*/
+{0x00,0x00,0x00,0x00,0x00,0x1B,0x06,0x02,0x02,0x07,0x00,0x00},/*"r",82*/
+{0x00,0x00,0x00,0x00,0x00,0x1E,0x02,0x0C,0x10,0x1E,0x00,0x00},/*"s",83*/
+{0x00,0x00,0x00,0x04,0x04,0x0E,0x04,0x04,0x04,0x18,0x00,0x00},/*"t",84*/
+{0x00,0x00,0x00,0x00,0x00,0x1B,0x12,0x12,0x12,0x3C,0x00,0x00},/*"u",85*/
+{0x00,0x00,0x00,0x00,0x00,0x37,0x12,0x0A,0x0C,0x04,0x00,0x00},/*"v",86*/
+{0x00,0x00,0x00,0x00,0x00,0x15,0x15,0x0E,0x0A,0x0A,0x00,0x00},/*"w",87*/
+{0x00,0x00,0x00,0x00,0x00,0x1B,0x0A,0x04,0x0A,0x1B,0x00,0x00},/*"x",88*/
+{0x00,0x00,0x00,0x00,0x00,0x37,0x12,0x0A,0x0C,0x04,0x04,0x03},/*"y",89*/
+{0x00,0x00,0x00,0x00,0x00,0x1E,0x08,0x04,0x04,0x1E,0x00,0x00},/*"z",90*/
+{0x00,0x18,0x08,0x08,0x08,0x04,0x08,0x08,0x08,0x08,0x18,0x00},/*"{",91*/
+{0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08},/*"|",92*/
+{0x00,0x06,0x04,0x04,0x04,0x08,0x04,0x04,0x04,0x04,0x06,0x00},/*"}",93*/
+{0x02,0x25,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"~",94*/
+};
+
+/* 8*16 ASCII字符集逐行点阵 */
+const unsigned char asc2_1608_row[95][16] = {
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*" ",0*/
+{0x00,0x00,0x00,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x18,0x18,0x00,0x00},/*"!",1*/
+{0x00,0x48,0x6C,0x24,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*""",2*/
+{0x00,0x00,0x00,0x24,0x24,0x24,0x7F,0x12,0x12,0x12,0x7F,0x12,0x12,0x12,0x00,0x00},/*"#",3*/
+{0x00,0x00,0x08,0x1C,0x2A,0x2A,0x0A,0x0C,0x18,0x28,0x28,0x2A,0x2A,0x1C,0x08,0x08},/*"$",4*/
+{0x00,0x00,0x00,0x22,0x25,0x15,0x15,0x15,0x2A,0x58,0x54,0x54,0x54,0x22,0x00,0x00},/*"%",5*/
+{0x00,0x00,0x00,0x0C,0x12,0x12,0x12,0x0A,0x76,0x25,0x29,0x11,0x91,0x6E,0x00,0x00},/*"&",6*/
+{0x00,0x06,0x06,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"'",7*/
+{0x00,0x40,0x20,0x10,0x10,0x08,0x08,0x08,0x08,0x08,0x08,0x10,0x10,0x20,0x40,0x00},/*"(",8*/
+{0x00,0x02,0x04,0x08,0x08,0x10,0x10,0x10,0x10,0x10,0x10,0x08,0x08,0x04,0x02,0x00},/*")",9*/
+{0x00,0x00,0x00,0x00,0x08,0x08,0x6B,0x1C,0x1C,0x6B,0x08,0x08,0x00,0x00,0x00,0x00},/*"*",10*/
+{0x00,0x00,0x00,0x00,0x08,0x08,0x08,0x08,0x7F,0x08,0x08,0x08,0x08,0x00,0x00,0x00},/*"+",11*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x06,0x04,0x03},/*",",12*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"-",13*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x06,0x00,0x00},/*".",14*/
+{0x00,0x00,0x80,0x40,0x40,0x20,0x20,0x10,0x10,0x08,0x08,0x04,0x04,0x02,0x02,0x00},/*"/",15*/
+{0x00,0x00,0x00,0x18,0x24,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x24,0x18,0x00,0x00},/*"0",16*/
+{0x00,0x00,0x00,0x08,0x0E,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x3E,0x00,0x00},/*"1",17*/
+{0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x20,0x20,0x10,0x08,0x04,0x42,0x7E,0x00,0x00},/*"2",18*/
+{0x00,0x00,0x00,0x3C,0x42,0x42,0x20,0x18,0x20,0x40,0x40,0x42,0x22,0x1C,0x00,0x00},/*"3",19*/
+{0x00,0x00,0x00,0x20,0x30,0x28,0x24,0x24,0x22,0x22,0x7E,0x20,0x20,0x78,0x00,0x00},/*"4",20*/
+{0x00,0x00,0x00,0x7E,0x02,0x02,0x02,0x1A,0x26,0x40,0x40,0x42,0x22,0x1C,0x00,0x00},/*"5",21*/
+{0x00,0x00,0x00,0x38,0x24,0x02,0x02,0x1A,0x26,0x42,0x42,0x42,0x24,0x18,0x00,0x00},/*"6",22*/
+{0x00,0x00,0x00,0x7E,0x22,0x22,0x10,0x10,0x08,0x08,0x08,0x08,0x08,0x08,0x00,0x00},/*"7",23*/
+{0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x24,0x18,0x24,0x42,0x42,0x42,0x3C,0x00,0x00},/*"8",24*/
+{0x00,0x00,0x00,0x18,0x24,0x42,0x42,0x42,0x64,0x58,0x40,0x40,0x24,0x1C,0x00,0x00},/*"9",25*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x18,0x00,0x00,0x00,0x00,0x18,0x18,0x00,0x00},/*":",26*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x08,0x08,0x04},/*";",27*/
+{0x00,0x00,0x00,0x40,0x20,0x10,0x08,0x04,0x02,0x04,0x08,0x10,0x20,0x40,0x00,0x00},/*"<",28*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x00,0x00},/*"=",29*/
+{0x00,0x00,0x00,0x02,0x04,0x08,0x10,0x20,0x40,0x20,0x10,0x08,0x04,0x02,0x00,0x00},/*">",30*/
+{0x00,0x00,0x00,0x3C,0x42,0x42,0x46,0x40,0x20,0x10,0x10,0x00,0x18,0x18,0x00,0x00},/*"?",31*/
+{0x00,0x00,0x00,0x1C,0x22,0x5A,0x55,0x55,0x55,0x55,0x2D,0x42,0x22,0x1C,0x00,0x00},/*"@",32*/
+{0x00,0x00,0x00,0x08,0x08,0x18,0x14,0x14,0x24,0x3C,0x22,0x42,0x42,0xE7,0x00,0x00},/*"A",33*/
+{0x00,0x00,0x00,0x1F,0x22,0x22,0x22,0x1E,0x22,0x42,0x42,0x42,0x22,0x1F,0x00,0x00},/*"B",34*/
+{0x00,0x00,0x00,0x7C,0x42,0x42,0x01,0x01,0x01,0x01,0x01,0x42,0x22,0x1C,0x00,0x00},/*"C",35*/
+{0x00,0x00,0x00,0x1F,0x22,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x22,0x1F,0x00,0x00},/*"D",36*/
+{0x00,0x00,0x00,0x3F,0x42,0x12,0x12,0x1E,0x12,0x12,0x02,0x42,0x42,0x3F,0x00,0x00},/*"E",37*/
+{0x00,0x00,0x00,0x3F,0x42,0x12,0x12,0x1E,0x12,0x12,0x02,0x02,0x02,0x07,0x00,0x00},/*"F",38*/
+{0x00,0x00,0x00,0x3C,0x22,0x22,0x01,0x01,0x01,0x71,0x21,0x22,0x22,0x1C,0x00,0x00},/*"G",39*/
+{0x00,0x00,0x00,0xE7,0x42,0x42,0x42,0x42,0x7E,0x42,0x42,0x42,0x42,0xE7,0x00,0x00},/*"H",40*/
+{0x00,0x00,0x00,0x3E,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x3E,0x00,0x00},/*"I",41*/
+{0x00,0x00,0x00,0x7C,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x11,0x0F},/*"J",42*/
+{0x00,0x00,0x00,0x77,0x22,0x12,0x0A,0x0E,0x0A,0x12,0x12,0x22,0x22,0x77,0x00,0x00},/*"K",43*/
+{0x00,0x00,0x00,0x07,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x42,0x7F,0x00,0x00},/*"L",44*/
+{0x00,0x00,0x00,0x77,0x36,0x36,0x36,0x36,0x2A,0x2A,0x2A,0x2A,0x2A,0x6B,0x00,0x00},/*"M",45*/
+{0x00,0x00,0x00,0xE3,0x46,0x46,0x4A,0x4A,0x52,0x52,0x52,0x62,0x62,0x47,0x00,0x00},/*"N",46*/
+{0x00,0x00,0x00,0x1C,0x22,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x22,0x1C,0x00,0x00},/*"O",47*/
+{0x00,0x00,0x00,0x3F,0x42,0x42,0x42,0x42,0x3E,0x02,0x02,0x02,0x02,0x07,0x00,0x00},/*"P",48*/
+{0x00,0x00,0x00,0x1C,0x22,0x41,0x41,0x41,0x41,0x41,0x4D,0x53,0x32,0x1C,0x60,0x00},/*"Q",49*/
+{0x00,0x00,0x00,0x3F,0x42,0x42,0x42,0x3E,0x12,0x12,0x22,0x22,0x42,0xC7,0x00,0x00},/*"R",50*/
+{0x00,0x00,0x00,0x7C,0x42,0x42,0x02,0x04,0x18,0x20,0x40,0x42,0x42,0x3E,0x00,0x00},/*"S",51*/
+{0x00,0x00,0x00,0x7F,0x49,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x1C,0x00,0x00},/*"T",52*/
+{0x00,0x00,0x00,0xE7,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,0x00,0x00},/*"U",53*/
+{0x00,0x00,0x00,0xE7,0x42,0x42,0x22,0x24,0x24,0x14,0x14,0x18,0x08,0x08,0x00,0x00},/*"V",54*/
+{0x00,0x00,0x00,0x6B,0x49,0x49,0x49,0x49,0x55,0x55,0x36,0x22,0x22,0x22,0x00,0x00},/*"W",55*/
+{0x00,0x00,0x00,0xE7,0x42,0x24,0x24,0x18,0x18,0x18,0x24,0x24,0x42,0xE7,0x00,0x00},/*"X",56*/
+{0x00,0x00,0x00,0x77,0x22,0x22,0x14,0x14,0x08,0x08,0x08,0x08,0x08,0x1C,0x00,0x00},/*"Y",57*/
+{0x00,0x00,0x00,0x7E,0x21,0x20,0x10,0x10,0x08,0x04,0x04,0x42,0x42,0x3F,0x00,0x00},/*"Z",58*/
+{0x00,0x78,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x78,0x00},/*"[",59*/
+{0x00,0x00,0x02,0x02,0x04,0x04,0x08,0x08,0x08,0x10,0x10,0x20,0x20,0x20,0x40,0x40},/*"\",60*/
+{0x00,0x1E,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x1E,0x00},/*"]",61*/
+{0x00,0x38,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"^",62*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF},/*"_",63*/
+{0x00,0x06,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"`",64*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x78,0x44,0x42,0x42,0xFC,0x00,0x00},/*"a",65*/
+{0x00,0x00,0x00,0x03,0x02,0x02,0x02,0x1A,0x26,0x42,0x42,0x42,0x26,0x1A,0x00,0x00},/*"b",66*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x44,0x02,0x02,0x02,0x44,0x38,0x00,0x00},/*"c",67*/
+{0x00,0x00,0x00,0x60,0x40,0x40,0x40,0x78,0x44,0x42,0x42,0x42,0x64,0xD8,0x00,0x00},/*"d",68*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x7E,0x02,0x02,0x42,0x3C,0x00,0x00},/*"e",69*/
+{0x00,0x00,0x00,0xF0,0x88,0x08,0x08,0x7E,0x08,0x08,0x08,0x08,0x08,0x3E,0x00,0x00},/*"f",70*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x22,0x22,0x1C,0x02,0x3C,0x42,0x42,0x3C},/*"g",71*/
+{0x00,0x00,0x00,0x03,0x02,0x02,0x02,0x3A,0x46,0x42,0x42,0x42,0x42,0xE7,0x00,0x00},/*"h",72*/
+{0x00,0x00,0x00,0x0C,0x0C,0x00,0x00,0x0E,0x08,0x08,0x08,0x08,0x08,0x3E,0x00,0x00},/*"i",73*/
+{0x00,0x00,0x00,0x30,0x30,0x00,0x00,0x38,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x1E},/*"j",74*/
+{0x00,0x00,0x00,0x03,0x02,0x02,0x02,0x72,0x12,0x0A,0x16,0x12,0x22,0x77,0x00,0x00},/*"k",75*/
+{0x00,0x00,0x00,0x0E,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x3E,0x00,0x00},/*"l",76*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x92,0x92,0x92,0x92,0x92,0xB7,0x00,0x00},/*"m",77*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3B,0x46,0x42,0x42,0x42,0x42,0xE7,0x00,0x00},/*"n",78*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x3C,0x00,0x00},/*"o",79*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1B,0x26,0x42,0x42,0x42,0x22,0x1E,0x02,0x07},/*"p",80*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x44,0x42,0x42,0x42,0x44,0x78,0x40,0xE0},/*"q",81*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x4C,0x04,0x04,0x04,0x04,0x1F,0x00,0x00},/*"r",82*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x42,0x02,0x3C,0x40,0x42,0x3E,0x00,0x00},/*"s",83*/
+{0x00,0x00,0x00,0x00,0x00,0x08,0x08,0x3E,0x08,0x08,0x08,0x08,0x08,0x30,0x00,0x00},/*"t",84*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x42,0x42,0x42,0x42,0x62,0xDC,0x00,0x00},/*"u",85*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x42,0x24,0x24,0x14,0x08,0x08,0x00,0x00},/*"v",86*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x49,0x49,0x55,0x55,0x22,0x22,0x00,0x00},/*"w",87*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x76,0x24,0x18,0x18,0x18,0x24,0x6E,0x00,0x00},/*"x",88*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x42,0x24,0x24,0x14,0x18,0x08,0x08,0x07},/*"y",89*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x22,0x10,0x08,0x08,0x44,0x7E,0x00,0x00},/*"z",90*/
+{0x00,0xC0,0x20,0x20,0x20,0x20,0x20,0x10,0x20,0x20,0x20,0x20,0x20,0x20,0xC0,0x00},/*"{",91*/
+{0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10},/*"|",92*/
+{0x00,0x06,0x08,0x08,0x08,0x08,0x08,0x10,0x08,0x08,0x08,0x08,0x08,0x08,0x06,0x00},/*"}",93*/
+{0x0C,0x32,0xC2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"~",94*/
+};
+
+/* 12*24 ASCII字符集逐行点阵 */
+const unsigned short asc2_2412_row[95][24] = {
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000},/*" ",0*/
+{0x0000,0x0000,0x0000,0x0000,0x00E0,0x00E0,0x00E0,0x00E0,0x00E0,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0000,0x0000,0x0000,0x00E0,0x00E0,0x00E0,0x0000,0x0000,0x0000},/*"!",1*/
+{0x0000,0x0000,0x0660,0x0660,0x0330,0x0198,0x0088,0x0044,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000},/*""",2*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0208,0x0208,0x0208,0x0208,0x07FE,0x07FE,0x0208,0x0208,0x0104,0x0104,0x07FE,0x07FE,0x0104,0x0104,0x0104,0x0104,0x0000,0x0000,0x0000},/*"#",3*/
+{0x0000,0x0000,0x0000,0x0040,0x0040,0x01F0,0x0358,0x034C,0x034C,0x004C,0x0058,0x0070,0x00E0,0x01C0,0x01C0,0x0340,0x034C,0x034C,0x034C,0x0148,0x00F0,0x0040,0x0040,0x0000},/*"$",4*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x030E,0x010A,0x0111,0x0091,0x0091,0x00D1,0x0051,0x03FA,0x02AE,0x0460,0x0450,0x0450,0x0458,0x0448,0x0288,0x0384,0x0000,0x0000,0x0000},/*"%",5*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0038,0x0064,0x0064,0x0064,0x0064,0x03A4,0x011C,0x010C,0x011A,0x0092,0x00B3,0x00E3,0x0063,0x00C3,0x04A6,0x031C,0x0000,0x0000,0x0000},/*"&",6*/
+{0x0000,0x0000,0x000C,0x001C,0x0010,0x0010,0x0008,0x0006,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000},/*"'",7*/
+{0x0000,0x0000,0x0400,0x0200,0x0100,0x0180,0x0080,0x00C0,0x00C0,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x00C0,0x00C0,0x0080,0x0180,0x0100,0x0200,0x0400,0x0000},/*"(",8*/
+{0x0000,0x0000,0x0002,0x0004,0x0008,0x0018,0x0010,0x0030,0x0030,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0030,0x0030,0x0010,0x0018,0x0008,0x0004,0x0002,0x0000},/*")",9*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0040,0x0040,0x0040,0x0E4E,0x075C,0x01F0,0x01F0,0x075C,0x0E4E,0x0040,0x0040,0x0040,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000},/*"*",10*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0040,0x0040,0x0040,0x0040,0x0040,0x0FFE,0x0040,0x0040,0x0040,0x0040,0x0040,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000},/*"+",11*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x000C,0x001C,0x0010,0x0010,0x0008,0x0006},/*",",12*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x07FE,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000},/*"-",13*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x001C,0x001C,0x001C,0x0000,0x0000,0x0000},/*".",14*/
+{0x0000,0x0000,0x0400,0x0600,0x0200,0x0300,0x0100,0x0100,0x0080,0x0080,0x0040,0x0040,0x0060,0x0020,0x0020,0x0010,0x0010,0x0008,0x0008,0x000C,0x0004,0x0006,0x0002,0x0000},/*"/",15*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x00F0,0x0198,0x030C,0x030C,0x0606,0x0606,0x0606,0x0606,0x0606,0x0606,0x0606,0x0606,0x030C,0x030C,0x0198,0x00F0,0x0000,0x0000,0x0000},/*"0",16*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0040,0x0060,0x007C,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x03FC,0x0000,0x0000,0x0000},/*"1",17*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x00F8,0x0184,0x0302,0x0306,0x0306,0x0300,0x0180,0x0180,0x00C0,0x0020,0x0010,0x0208,0x0204,0x0202,0x03FE,0x03FE,0x0000,0x0000,0x0000},/*"2",18*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0078,0x00C4,0x0186,0x0186,0x0186,0x0180,0x00C0,0x0070,0x0180,0x0100,0x0300,0x0306,0x0306,0x0306,0x0184,0x00F8,0x0000,0x0000,0x0000},/*"3",19*/
+{0x0000,0x0000,0x0000,0x0000,0x0100,0x0180,0x01C0,0x01C0,0x01A0,0x0190,0x0190,0x0188,0x0184,0x0184,0x0182,0x07FE,0x0180,0x0180,0x0180,0x0180,0x07E0,0x0000,0x0000,0x0000},/*"4",20*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x03FC,0x03FC,0x0004,0x0004,0x0004,0x0004,0x00F4,0x018C,0x0304,0x0300,0x0300,0x0306,0x0306,0x0182,0x0184,0x00F8,0x0000,0x0000,0x0000},/*"5",21*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x01E0,0x0318,0x030C,0x000C,0x0004,0x0006,0x01E6,0x0316,0x060E,0x0606,0x0606,0x0606,0x0604,0x020C,0x0318,0x00F0,0x0000,0x0000,0x0000},/*"6",22*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x07F8,0x07FC,0x020C,0x0104,0x0104,0x0100,0x0080,0x0080,0x0040,0x0040,0x0040,0x0060,0x0060,0x0060,0x0060,0x0060,0x0000,0x0000,0x0000},/*"7",23*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x01F8,0x030C,0x0606,0x0606,0x0606,0x020E,0x033C,0x00F0,0x01CC,0x0304,0x0606,0x0606,0x0606,0x0606,0x030C,0x01F0,0x0000,0x0000,0x0000},/*"8",24*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x00F0,0x010C,0x030C,0x0206,0x0606,0x0606,0x0606,0x0706,0x068C,0x0678,0x0600,0x0300,0x0300,0x010C,0x018C,0x0078,0x0000,0x0000,0x0000},/*"9",25*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x00E0,0x00E0,0x00E0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x00E0,0x00E0,0x00E0,0x0000,0x0000,0x0000},/*":",26*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0060,0x0060,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0060,0x0060,0x0040,0x0020,0x0000},/*";",27*/
+{0x0000,0x0000,0x0000,0x0000,0x0400,0x0200,0x0100,0x0080,0x0040,0x0020,0x0010,0x0008,0x0004,0x0008,0x0010,0x0020,0x0040,0x0080,0x0100,0x0200,0x0400,0x0000,0x0000,0x0000},/*"<",28*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x07FE,0x0000,0x0000,0x0000,0x0000,0x07FE,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000},/*"=",29*/
+{0x0000,0x0000,0x0000,0x0000,0x0004,0x0008,0x0010,0x0020,0x0040,0x0080,0x0100,0x0200,0x0400,0x0200,0x0100,0x0080,0x0040,0x0020,0x0010,0x0008,0x0004,0x0000,0x0000,0x0000},/*">",30*/
+{0x0000,0x0000,0x0000,0x0000,0x01F0,0x030C,0x0602,0x0602,0x0606,0x0606,0x0300,0x0180,0x0060,0x0020,0x0020,0x0020,0x0000,0x0000,0x0070,0x0070,0x0070,0x0000,0x0000,0x0000},/*"?",31*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x01E0,0x0638,0x0408,0x0ACC,0x0B64,0x0926,0x0926,0x0916,0x0916,0x0996,0x0596,0x0366,0x080C,0x040C,0x0218,0x01E0,0x0000,0x0000,0x0000},/*"@",32*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0060,0x0060,0x0070,0x00D0,0x00D0,0x00C8,0x0188,0x0188,0x0188,0x01F8,0x0304,0x0304,0x0304,0x0604,0x0606,0x0F0F,0x0000,0x0000,0x0000},/*"A",33*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x00FF,0x0186,0x0306,0x0306,0x0306,0x0306,0x0186,0x00FE,0x0306,0x0206,0x0606,0x0606,0x0606,0x0606,0x0306,0x01FF,0x0000,0x0000,0x0000},/*"B",34*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x07E0,0x0618,0x040C,0x040C,0x0004,0x0006,0x0006,0x0006,0x0006,0x0006,0x0006,0x0406,0x040C,0x020C,0x0118,0x00F0,0x0000,0x0000,0x0000},/*"C",35*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x007F,0x0186,0x0306,0x0306,0x0606,0x0606,0x0606,0x0606,0x0606,0x0606,0x0606,0x0606,0x0306,0x0306,0x01C6,0x007F,0x0000,0x0000,0x0000},/*"D",36*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x03FF,0x0206,0x0406,0x0006,0x0006,0x0086,0x0086,0x00FE,0x0086,0x0086,0x0006,0x0006,0x0406,0x0406,0x0206,0x03FF,0x0000,0x0000,0x0000},/*"E",37*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x03FF,0x0306,0x0406,0x0406,0x0006,0x0086,0x0086,0x00FE,0x0086,0x0086,0x0006,0x0006,0x0006,0x0006,0x0006,0x000F,0x0000,0x0000,0x0000},/*"F",38*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x02F0,0x0318,0x020C,0x020C,0x0004,0x0006,0x0006,0x0006,0x0006,0x0FC6,0x0306,0x0306,0x030C,0x030C,0x0318,0x00F0,0x0000,0x0000,0x0000},/*"G",39*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0F0F,0x0606,0x0606,0x0606,0x0606,0x0606,0x0606,0x07FE,0x0606,0x0606,0x0606,0x0606,0x0606,0x0606,0x0606,0x0F0F,0x0000,0x0000,0x0000},/*"H",40*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x03FC,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x03FC,0x0000,0x0000,0x0000},/*"I",41*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0FF0,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0186,0x00C6,0x007C},/*"J",42*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x07CF,0x0106,0x0086,0x0046,0x0046,0x0026,0x0036,0x003E,0x006E,0x00E6,0x00C6,0x01C6,0x0186,0x0306,0x0706,0x0F8F,0x0000,0x0000,0x0000},/*"K",43*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x000F,0x0006,0x0006,0x0006,0x0006,0x0006,0x0006,0x0006,0x0006,0x0006,0x0006,0x0006,0x0406,0x0406,0x0206,0x03FF,0x0000,0x0000,0x0000},/*"L",44*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0F0F,0x070E,0x070E,0x070E,0x069A,0x069A,0x069A,0x069A,0x065A,0x0672,0x0672,0x0672,0x0672,0x0622,0x0622,0x0F27,0x0000,0x0000,0x0000},/*"M",45*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0E07,0x040E,0x040E,0x041A,0x041A,0x0432,0x0462,0x0462,0x04C2,0x04C2,0x0582,0x0702,0x0702,0x0602,0x0602,0x0407,0x0000,0x0000,0x0000},/*"N",46*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x00F0,0x0198,0x030C,0x020C,0x0606,0x0606,0x0606,0x0606,0x0606,0x0606,0x0606,0x0606,0x020C,0x030C,0x0198,0x00F0,0x0000,0x0000,0x0000},/*"O",47*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x01FF,0x0306,0x0606,0x0606,0x0606,0x0606,0x0606,0x0306,0x01FE,0x0006,0x0006,0x0006,0x0006,0x0006,0x0006,0x000F,0x0000,0x0000,0x0000},/*"P",48*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x00F0,0x0198,0x030C,0x020C,0x0606,0x0606,0x0606,0x0606,0x0606,0x0606,0x0606,0x0676,0x024C,0x038C,0x0188,0x01F0,0x0780,0x0300,0x0000},/*"Q",49*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x01FF,0x0306,0x0606,0x0606,0x0606,0x0606,0x0306,0x00FE,0x0066,0x00C6,0x00C6,0x0186,0x0186,0x0306,0x0306,0x0E0F,0x0000,0x0000,0x0000},/*"R",50*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x04F8,0x070C,0x0406,0x0406,0x0006,0x000E,0x003C,0x00F0,0x03C0,0x0300,0x0600,0x0602,0x0602,0x0606,0x030E,0x01F2,0x0000,0x0000,0x0000},/*"S",51*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x07FE,0x0462,0x0861,0x0861,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x00F0,0x0000,0x0000,0x0000},/*"T",52*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0E0F,0x0406,0x0406,0x0406,0x0406,0x0406,0x0406,0x0406,0x0406,0x0406,0x0406,0x0406,0x0406,0x0406,0x020C,0x01F8,0x0000,0x0000,0x0000},/*"U",53*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0F1F,0x060E,0x020C,0x020C,0x020C,0x010C,0x0118,0x0118,0x0118,0x0118,0x00B0,0x00B0,0x00B0,0x00F0,0x0060,0x0060,0x0000,0x0000,0x0000},/*"V",54*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0EEF,0x0466,0x0466,0x0266,0x0266,0x02E6,0x02EC,0x02EC,0x01DC,0x01DC,0x01DC,0x01DC,0x019C,0x0088,0x0088,0x0088,0x0000,0x0000,0x0000},/*"W",55*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x079E,0x030C,0x0118,0x0118,0x0098,0x00B0,0x0070,0x0060,0x0060,0x00E0,0x00D0,0x01D0,0x0198,0x0188,0x030C,0x079E,0x0000,0x0000,0x0000},/*"X",56*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0F1F,0x060E,0x020C,0x010C,0x0118,0x0118,0x00B0,0x00B0,0x0070,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x01F8,0x0000,0x0000,0x0000},/*"Y",57*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x07FC,0x0304,0x0382,0x0180,0x01C0,0x00C0,0x00C0,0x0060,0x0060,0x0030,0x0030,0x0018,0x0418,0x041C,0x020C,0x03FE,0x0000,0x0000,0x0000},/*"Z",58*/
+{0x0000,0x0000,0x07E0,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x07E0,0x0000},/*"[",59*/
+{0x0000,0x0000,0x0000,0x0000,0x0004,0x0008,0x0008,0x0008,0x0010,0x0010,0x0020,0x0020,0x0020,0x0040,0x0040,0x0080,0x0080,0x0080,0x0100,0x0100,0x0200,0x0200,0x0200,0x0400},/*"\",60*/
+{0x0000,0x0000,0x00FC,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x00FC,0x0000},/*"]",61*/
+{0x0000,0x0000,0x00E0,0x01B0,0x0208,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000},/*"^",62*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0FFF},/*"_",63*/
+{0x0000,0x0000,0x0018,0x0060,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000},/*"`",64*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x01F0,0x030C,0x030C,0x03E0,0x0338,0x030C,0x0306,0x0306,0x0306,0x0B8E,0x0F7C,0x0000,0x0000,0x0000},/*"a",65*/
+{0x0000,0x0000,0x0000,0x0000,0x0008,0x000E,0x000C,0x000C,0x000C,0x000C,0x01CC,0x033C,0x061C,0x060C,0x060C,0x060C,0x060C,0x060C,0x020C,0x031C,0x01F4,0x0000,0x0000,0x0000},/*"b",66*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x00F0,0x018C,0x018C,0x0186,0x0006,0x0006,0x0006,0x0206,0x020C,0x010C,0x00F0,0x0000,0x0000,0x0000},/*"c",67*/
+{0x0000,0x0000,0x0000,0x0000,0x0200,0x0380,0x0300,0x0300,0x0300,0x0300,0x0378,0x038C,0x030C,0x0306,0x0306,0x0306,0x0306,0x0306,0x0304,0x078C,0x0178,0x0000,0x0000,0x0000},/*"d",68*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x01E0,0x0318,0x0608,0x060C,0x07FC,0x000C,0x000C,0x000C,0x0418,0x0238,0x01E0,0x0000,0x0000,0x0000},/*"e",69*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x03C0,0x0660,0x0630,0x0030,0x0030,0x03FE,0x0030,0x0030,0x0030,0x0030,0x0030,0x0030,0x0030,0x0030,0x0030,0x01FC,0x0000,0x0000,0x0000},/*"f",70*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0EF0,0x0998,0x030C,0x030C,0x030C,0x0198,0x00F8,0x000C,0x007C,0x03F8,0x0606,0x0606,0x070E,0x01F8},/*"g",71*/
+{0x0000,0x0000,0x0000,0x0000,0x0008,0x000E,0x000C,0x000C,0x000C,0x000C,0x01EC,0x031C,0x030C,0x030C,0x030C,0x030C,0x030C,0x030C,0x030C,0x030C,0x079E,0x0000,0x0000,0x0000},/*"h",72*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0060,0x0060,0x0000,0x0000,0x0000,0x007C,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x03FC,0x0000,0x0000,0x0000},/*"i",73*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0180,0x0180,0x0000,0x0000,0x0000,0x01F0,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x00CC,0x007C},/*"j",74*/
+{0x0000,0x0000,0x0000,0x0000,0x0008,0x000E,0x000C,0x000C,0x000C,0x000C,0x03CC,0x008C,0x00CC,0x004C,0x006C,0x007C,0x00DC,0x00CC,0x018C,0x018C,0x079E,0x0000,0x0000,0x0000},/*"k",75*/
+{0x0000,0x0000,0x0000,0x0000,0x0040,0x007C,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x03FC,0x0000,0x0000,0x0000},/*"l",76*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0777,0x06EE,0x0666,0x0666,0x0666,0x0666,0x0666,0x0666,0x0666,0x0666,0x0EEF,0x0000,0x0000,0x0000},/*"m",77*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x01CE,0x033C,0x030C,0x030C,0x030C,0x030C,0x030C,0x030C,0x030C,0x030C,0x079E,0x0000,0x0000,0x0000},/*"n",78*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x00F0,0x0198,0x030C,0x0606,0x0606,0x0606,0x0606,0x0606,0x030C,0x030C,0x00F0,0x0000,0x0000,0x0000},/*"o",79*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x01EE,0x031C,0x060C,0x060C,0x060C,0x060C,0x060C,0x060C,0x030C,0x031C,0x01EC,0x000C,0x000C,0x003E},/*"p",80*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0278,0x038C,0x030C,0x0306,0x0306,0x0306,0x0306,0x0306,0x0304,0x038C,0x0378,0x0300,0x0300,0x07C0},/*"q",81*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x079F,0x0658,0x0038,0x0018,0x0018,0x0018,0x0018,0x0018,0x0018,0x0018,0x00FF,0x0000,0x0000,0x0000},/*"r",82*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x07F0,0x0618,0x040C,0x000C,0x0038,0x01F0,0x0380,0x0604,0x0604,0x030C,0x01FC,0x0000,0x0000,0x0000},/*"s",83*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0020,0x0020,0x0030,0x0030,0x01FE,0x0030,0x0030,0x0030,0x0030,0x0030,0x0030,0x0030,0x0230,0x0230,0x01E0,0x0000,0x0000,0x0000},/*"t",84*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0208,0x038E,0x030C,0x030C,0x030C,0x030C,0x030C,0x030C,0x030C,0x030C,0x079C,0x0178,0x0000,0x0000,0x0000},/*"u",85*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0F3E,0x061C,0x0218,0x0218,0x0130,0x0130,0x0130,0x00E0,0x00E0,0x00E0,0x0040,0x0000,0x0000,0x0000},/*"v",86*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0DEF,0x04C6,0x04C6,0x04E6,0x04EC,0x03AC,0x039C,0x039C,0x039C,0x0108,0x0108,0x0000,0x0000,0x0000},/*"w",87*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x07BE,0x0118,0x0198,0x00B0,0x0070,0x0060,0x00E0,0x00D0,0x0198,0x0388,0x07DE,0x0000,0x0000,0x0000},/*"x",88*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x07BE,0x011C,0x0118,0x0118,0x00B0,0x00B0,0x00B0,0x0060,0x0060,0x0040,0x0020,0x0020,0x0014,0x001C},/*"y",89*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x03FC,0x0184,0x01C4,0x00C0,0x00E0,0x0060,0x0070,0x0430,0x0438,0x0618,0x03FC,0x0000,0x0000,0x0000},/*"z",90*/
+{0x0000,0x0000,0x0300,0x0180,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x00C0,0x0020,0x00C0,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0180,0x0300,0x0000},/*"{",91*/
+{0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040},/*"|",92*/
+{0x0000,0x0000,0x000C,0x0018,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0030,0x0040,0x0030,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0018,0x000C,0x0000},/*"}",93*/
+{0x0000,0x001C,0x0024,0x0842,0x0482,0x0700,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000},/*"~",94*/
+};
+
+/* 16*32 ASCII字符集逐行点阵 */
+const unsigned short asc2_3216_row[95][32] = {
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000},/*" ",0*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x01C0,0x01C0,0x01C0,0x01C0,0x01C0,0x01C0,0x01C0,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0000,0x0000,0x0000,0x0000,0x0180,0x03C0,0x03C0,0x0180,0x0000,0x0000,0x0000,0x0000,0x0000},/*"!",1*/
+{0x0000,0x0000,0x0000,0x1CE0,0x1CE0,0x1EF0,0x0E70,0x0738,0x0318,0x0108,0x0084,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000},/*""",2*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1020,0x1020,0x1020,0x1020,0x1020,0x7FFE,0x7FFE,0x0810,0x0810,0x0810,0x0810,0x0810,0x0810,0x0810,0x7FFE,0x7FFE,0x0408,0x0408,0x0408,0x0408,0x0408,0x0000,0x0000,0x0000,0x0000,0x0000},/*"#",3*/
+{0x0000,0x0000,0x0000,0x0000,0x0100,0x0100,0x07C0,0x1960,0x3110,0x3118,0x3918,0x3918,0x0138,0x0170,0x01E0,0x03C0,0x0780,0x0F00,0x1D00,0x3900,0x3100,0x311C,0x311C,0x310C,0x110C,0x0D18,0x07E0,0x0100,0x0100,0x0100,0x0000,0x0000},/*"$",4*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x101C,0x1836,0x0863,0x0C63,0x0463,0x0463,0x0263,0x0263,0x0163,0x1D36,0x379C,0x2280,0x6380,0x6340,0x6340,0x6320,0x6320,0x6330,0x2210,0x3618,0x1C08,0x0000,0x0000,0x0000,0x0000,0x0000},/*"%",5*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x00F0,0x0198,0x018C,0x018C,0x018C,0x018C,0x008C,0x00CC,0x0078,0x3E18,0x081C,0x0836,0x0832,0x0463,0x0463,0x04C3,0x03C3,0x4383,0x4306,0x268E,0x1C78,0x0000,0x0000,0x0000,0x0000,0x0000},/*"&",6*/
+{0x0000,0x0000,0x0000,0x001C,0x003C,0x003C,0x0030,0x0030,0x0010,0x000C,0x0006,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000},/*"'",7*/
+{0x0000,0x0000,0x0000,0x4000,0x2000,0x1000,0x0800,0x0C00,0x0400,0x0600,0x0300,0x0300,0x0300,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0300,0x0300,0x0300,0x0600,0x0600,0x0C00,0x0800,0x1000,0x2000,0x4000,0x0000},/*"(",8*/
+{0x0000,0x0000,0x0000,0x0002,0x0004,0x0008,0x0010,0x0030,0x0020,0x0060,0x00C0,0x00C0,0x00C0,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x00C0,0x00C0,0x00C0,0x0060,0x0060,0x0030,0x0010,0x0008,0x0004,0x0002,0x0000},/*")",9*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0100,0x0380,0x0380,0x0100,0x711C,0x793C,0x3D78,0x07C0,0x0100,0x07C0,0x3D78,0x793C,0x711C,0x0100,0x0380,0x0380,0x0180,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000},/*"*",10*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0100,0x0100,0x0100,0x0100,0x0100,0x0100,0x0100,0x7FFC,0x0100,0x0100,0x0100,0x0100,0x0100,0x0100,0x0100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000},/*"+",11*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x001C,0x003C,0x003C,0x0030,0x0030,0x0010,0x000C,0x0006},/*",",12*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7FFE,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000},/*"-",13*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0018,0x003C,0x003C,0x0018,0x0000,0x0000,0x0000,0x0000,0x0000},/*".",14*/
+{0x0000,0x0000,0x0000,0x4000,0x6000,0x2000,0x3000,0x1000,0x1800,0x0800,0x0C00,0x0400,0x0600,0x0200,0x0300,0x0100,0x0180,0x0080,0x00C0,0x0040,0x0060,0x0020,0x0030,0x0010,0x0018,0x0008,0x000C,0x0004,0x0006,0x0002,0x0000,0x0000},/*"/",15*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x07C0,0x0C60,0x1830,0x3018,0x3018,0x2018,0x600C,0x600C,0x600C,0x600C,0x600C,0x600C,0x600C,0x600C,0x600C,0x2018,0x3018,0x3018,0x1830,0x0C60,0x07C0,0x0000,0x0000,0x0000,0x0000,0x0000},/*"0",16*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0100,0x0180,0x01F8,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x03C0,0x1FF8,0x0000,0x0000,0x0000,0x0000,0x0000},/*"1",17*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x07E0,0x1C10,0x1808,0x3004,0x3004,0x300C,0x300C,0x3000,0x1800,0x0800,0x0400,0x0200,0x0100,0x0080,0x0040,0x2020,0x2010,0x2008,0x3004,0x1FFC,0x1FFC,0x0000,0x0000,0x0000,0x0000,0x0000},/*"2",18*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x03E0,0x0E18,0x0C0C,0x180C,0x180C,0x180C,0x1800,0x0C00,0x0600,0x03C0,0x0E00,0x1800,0x1000,0x3000,0x3000,0x300C,0x300C,0x100C,0x180C,0x0C18,0x03E0,0x0000,0x0000,0x0000,0x0000,0x0000},/*"3",19*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0C00,0x0E00,0x0E00,0x0F00,0x0E80,0x0E80,0x0E40,0x0E60,0x0E20,0x0E10,0x0E10,0x0E08,0x0E04,0x0E04,0x7FFE,0x0E00,0x0E00,0x0E00,0x0E00,0x0E00,0x0E00,0x7FC0,0x0000,0x0000,0x0000,0x0000},/*"4",20*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3FF0,0x3FF0,0x0010,0x0010,0x0010,0x0008,0x0008,0x07C8,0x0C28,0x1818,0x1008,0x3000,0x3000,0x3000,0x3000,0x300C,0x300C,0x1804,0x1804,0x0C08,0x03F0,0x0000,0x0000,0x0000,0x0000,0x0000},/*"5",21*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0F80,0x10C0,0x3020,0x3010,0x0018,0x0018,0x0008,0x000C,0x0F8C,0x186C,0x303C,0x601C,0x600C,0x600C,0x600C,0x600C,0x6018,0x2018,0x3030,0x1860,0x07C0,0x0000,0x0000,0x0000,0x0000,0x0000},/*"6",22*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3FF8,0x3FF8,0x101C,0x080C,0x0804,0x0404,0x0400,0x0200,0x0200,0x0100,0x0100,0x0100,0x0080,0x0080,0x0080,0x00C0,0x00C0,0x00C0,0x00C0,0x00C0,0x00C0,0x0000,0x0000,0x0000,0x0000,0x0000},/*"7",23*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x07E0,0x0C30,0x1818,0x300C,0x300C,0x300C,0x301C,0x1838,0x0870,0x07E0,0x07B0,0x0E18,0x1C0C,0x3806,0x3006,0x3006,0x3006,0x3006,0x180C,0x0C18,0x03E0,0x0000,0x0000,0x0000,0x0000,0x0000},/*"8",24*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x03E0,0x0418,0x080C,0x180C,0x1006,0x3006,0x3006,0x3006,0x3006,0x3806,0x3C0C,0x3618,0x31F0,0x3000,0x1800,0x1800,0x1800,0x0C0C,0x060C,0x030C,0x01F0,0x0000,0x0000,0x0000,0x0000,0x0000},/*"9",25*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0180,0x03C0,0x03C0,0x0180,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0180,0x03C0,0x03C0,0x0180,0x0000,0x0000,0x0000,0x0000,0x0000},/*":",26*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x00C0,0x00C0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x00C0,0x00C0,0x0080,0x0080,0x0040,0x0040,0x0000},/*";",27*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x2000,0x1000,0x0800,0x0400,0x0600,0x0300,0x0180,0x00C0,0x0060,0x0030,0x0018,0x000C,0x0018,0x0030,0x0060,0x00C0,0x0180,0x0300,0x0600,0x0400,0x0800,0x1000,0x2000,0x0000,0x0000,0x0000,0x0000},/*"<",28*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7FFE,0x0000,0x0000,0x0000,0x0000,0x0000,0x7FFE,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000},/*"=",29*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0004,0x0008,0x0010,0x0020,0x0060,0x00C0,0x0180,0x0300,0x0600,0x0C00,0x1800,0x3000,0x1800,0x0C00,0x0600,0x0300,0x0180,0x00C0,0x0060,0x0020,0x0010,0x0008,0x0004,0x0000,0x0000,0x0000,0x0000},/*">",30*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x07C0,0x1830,0x3008,0x6008,0x600C,0x601C,0x601C,0x601C,0x3000,0x1C00,0x0600,0x0100,0x0080,0x0080,0x0080,0x0080,0x0000,0x0000,0x0180,0x03C0,0x03C0,0x0180,0x0000,0x0000,0x0000,0x0000,0x0000},/*"?",31*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x07C0,0x1860,0x3010,0x2018,0x2F0C,0x4D8C,0x4C86,0x4CC6,0x4CC6,0x4C66,0x4466,0x4466,0x2666,0x2666,0x1566,0x1CCC,0x400C,0x2008,0x3018,0x1830,0x07C0,0x0000,0x0000,0x0000,0x0000,0x0000},/*"@",32*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0100,0x01C0,0x01C0,0x01C0,0x0140,0x0360,0x0320,0x0320,0x0320,0x0630,0x0610,0x0610,0x0610,0x0FF8,0x0C08,0x0C08,0x0C08,0x0C0C,0x1804,0x1804,0x1806,0x7C1F,0x0000,0x0000,0x0000,0x0000,0x0000},/*"A",33*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x07FE,0x1C18,0x3818,0x3018,0x3018,0x3018,0x3018,0x1818,0x0C18,0x07F8,0x1818,0x3018,0x2018,0x6018,0x6018,0x6018,0x6018,0x6018,0x3018,0x1818,0x0FFE,0x0000,0x0000,0x0000,0x0000,0x0000},/*"B",34*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x27C0,0x3860,0x3010,0x2018,0x400C,0x400C,0x0004,0x0006,0x0006,0x0006,0x0006,0x0006,0x0006,0x0006,0x0006,0x400C,0x400C,0x200C,0x3018,0x1830,0x07C0,0x0000,0x0000,0x0000,0x0000,0x0000},/*"C",35*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x03FE,0x0E18,0x1818,0x3018,0x3018,0x3018,0x6018,0x6018,0x6018,0x6018,0x6018,0x6018,0x6018,0x6018,0x6018,0x3018,0x3018,0x1018,0x1818,0x0E18,0x03FE,0x0000,0x0000,0x0000,0x0000,0x0000},/*"D",36*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3FFE,0x3018,0x2018,0x6018,0x4018,0x0018,0x0818,0x0818,0x0C18,0x0FF8,0x0C18,0x0818,0x0818,0x0018,0x0018,0x0018,0x4018,0x4018,0x2018,0x3018,0x3FFE,0x0000,0x0000,0x0000,0x0000,0x0000},/*"E",37*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7FFE,0x7018,0x4018,0xC018,0x8018,0x0018,0x1018,0x1018,0x1818,0x1FF8,0x1818,0x1018,0x1018,0x0018,0x0018,0x0018,0x0018,0x0018,0x0018,0x0018,0x007E,0x0000,0x0000,0x0000,0x0000,0x0000},/*"F",38*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x13C0,0x1C70,0x1010,0x1018,0x200C,0x200C,0x0004,0x0006,0x0006,0x0006,0x0006,0x0006,0xFC06,0x3006,0x3006,0x300C,0x300C,0x3018,0x3018,0x0830,0x07C0,0x0000,0x0000,0x0000,0x0000,0x0000},/*"G",39*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7E3F,0x180C,0x180C,0x180C,0x180C,0x180C,0x180C,0x180C,0x180C,0x180C,0x1FFC,0x180C,0x180C,0x180C,0x180C,0x180C,0x180C,0x180C,0x180C,0x180C,0x7E3F,0x0000,0x0000,0x0000,0x0000,0x0000},/*"H",40*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1FF8,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x1FF8,0x0000,0x0000,0x0000,0x0000,0x0000},/*"I",41*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7FE0,0x0600,0x0600,0x0600,0x0600,0x0600,0x0600,0x0600,0x0600,0x0600,0x0600,0x0600,0x0600,0x0600,0x0600,0x0600,0x0600,0x0600,0x0600,0x0600,0x0600,0x0600,0x060E,0x030E,0x018E,0x00FC},/*"J",42*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7C7E,0x1818,0x0818,0x0418,0x0618,0x0218,0x0118,0x0198,0x0198,0x01D8,0x03B8,0x0338,0x0718,0x0618,0x0E18,0x0C18,0x1C18,0x1818,0x3018,0x3018,0xFC7E,0x0000,0x0000,0x0000,0x0000,0x0000},/*"K",43*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x007E,0x0018,0x0018,0x0018,0x0018,0x0018,0x0018,0x0018,0x0018,0x0018,0x0018,0x0018,0x0018,0x0018,0x0018,0x0018,0x4018,0x4018,0x2018,0x3018,0x3FFE,0x0000,0x0000,0x0000,0x0000,0x0000},/*"L",44*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF81F,0x381C,0x381C,0x381C,0x3C1C,0x3434,0x3434,0x3434,0x3634,0x3274,0x3264,0x3264,0x3264,0x3164,0x31C4,0x31C4,0x31C4,0x30C4,0x30C4,0x3084,0xFC9F,0x0000,0x0000,0x0000,0x0000,0x0000},/*"M",45*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7C1F,0x101C,0x103C,0x1034,0x1034,0x1074,0x1064,0x10E4,0x10C4,0x11C4,0x1184,0x1384,0x1304,0x1704,0x1604,0x1E04,0x1C04,0x1C04,0x1C04,0x1804,0x181F,0x0000,0x0000,0x0000,0x0000,0x0000},/*"N",46*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x03C0,0x0C30,0x1818,0x1008,0x300C,0x300C,0x6006,0x6006,0x6006,0x6006,0x6006,0x6006,0x6006,0x6006,0x6006,0x200C,0x300C,0x1008,0x1818,0x0C30,0x03C0,0x0000,0x0000,0x0000,0x0000,0x0000},/*"O",47*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0FFE,0x1818,0x3018,0x6018,0x6018,0x6018,0x6018,0x6018,0x3018,0x1818,0x0FF8,0x0018,0x0018,0x0018,0x0018,0x0018,0x0018,0x0018,0x0018,0x0018,0x007E,0x0000,0x0000,0x0000,0x0000,0x0000},/*"P",48*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x03C0,0x0C30,0x1818,0x100C,0x300C,0x200C,0x6006,0x6006,0x6006,0x6006,0x6006,0x6006,0x6006,0x6006,0x6006,0x61E4,0x332C,0x321C,0x1618,0x0E30,0x07C0,0x4C00,0x7C00,0x3800,0x0000,0x0000},/*"Q",49*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x07FE,0x1C18,0x3818,0x3018,0x3018,0x3018,0x3018,0x1818,0x0C18,0x07F8,0x0398,0x0318,0x0718,0x0618,0x0618,0x0E18,0x0C18,0x0C18,0x1C18,0x1818,0x787E,0x0000,0x0000,0x0000,0x0000,0x0000},/*"R",50*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x27E0,0x3830,0x3018,0x200C,0x200C,0x000C,0x000C,0x0018,0x0078,0x03E0,0x0F80,0x1E00,0x3800,0x7000,0x6000,0x6004,0x6004,0x6008,0x3018,0x1838,0x0FC8,0x0000,0x0000,0x0000,0x0000,0x0000},/*"S",51*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3FFC,0x218C,0x6184,0x4182,0x4182,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x07E0,0x0000,0x0000,0x0000,0x0000,0x0000},/*"T",52*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7C3F,0x100C,0x100C,0x100C,0x100C,0x100C,0x100C,0x100C,0x100C,0x100C,0x100C,0x100C,0x100C,0x100C,0x100C,0x100C,0x100C,0x100C,0x0808,0x0438,0x03E0,0x0000,0x0000,0x0000,0x0000,0x0000},/*"U",53*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF83E,0x2018,0x2018,0x2018,0x1030,0x1030,0x1030,0x1030,0x0860,0x0860,0x0860,0x0CE0,0x04C0,0x04C0,0x04C0,0x0380,0x0380,0x0380,0x0380,0x0100,0x0100,0x0000,0x0000,0x0000,0x0000,0x0000},/*"V",54*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF3DF,0x6186,0x2186,0x2186,0x218C,0x210C,0x238C,0x138C,0x138C,0x138C,0x134C,0x1258,0x1658,0x0E58,0x0E38,0x0E38,0x0E38,0x0C30,0x0410,0x0410,0x0410,0x0000,0x0000,0x0000,0x0000,0x0000},/*"W",55*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3E7E,0x0818,0x0838,0x0430,0x0430,0x0270,0x0260,0x01E0,0x01C0,0x01C0,0x0180,0x0380,0x0340,0x0740,0x0620,0x0620,0x0C10,0x0C10,0x1808,0x1808,0x7C3E,0x0000,0x0000,0x0000,0x0000,0x0000},/*"X",56*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7C7E,0x101C,0x1018,0x0818,0x0830,0x0C30,0x0470,0x0460,0x0260,0x02C0,0x02C0,0x01C0,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x07E0,0x0000,0x0000,0x0000,0x0000,0x0000},/*"Y",57*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3FF8,0x1818,0x1808,0x0C04,0x0E04,0x0600,0x0700,0x0300,0x0380,0x0180,0x01C0,0x00C0,0x00E0,0x0060,0x0070,0x0030,0x2038,0x2018,0x101C,0x180C,0x1FFE,0x0000,0x0000,0x0000,0x0000,0x0000},/*"Z",58*/
+{0x0000,0x0000,0x0000,0x3FC0,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x3FC0,0x0000,0x0000},/*"[",59*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0008,0x0018,0x0018,0x0010,0x0030,0x0020,0x0060,0x0060,0x0040,0x00C0,0x0080,0x0180,0x0180,0x0100,0x0300,0x0200,0x0600,0x0600,0x0400,0x0C00,0x0800,0x1800,0x1800,0x1000,0x3000,0x2000,0x0000},/*"\",60*/
+{0x0000,0x0000,0x0000,0x03FC,0x0200,0x0200,0x0200,0x0200,0x0200,0x0200,0x0200,0x0200,0x0200,0x0200,0x0200,0x0200,0x0200,0x0200,0x0200,0x0200,0x0200,0x0200,0x0200,0x0200,0x0200,0x0200,0x0200,0x0200,0x0200,0x03FC,0x0000,0x0000},/*"]",61*/
+{0x0000,0x0000,0x0000,0x0780,0x06C0,0x0820,0x1010,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000},/*"^",62*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xFFFF},/*"_",63*/
+{0x0000,0x0000,0x0000,0x0078,0x00C0,0x0100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000},/*"`",64*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x03F0,0x0618,0x0C0C,0x0C0C,0x0C00,0x0F80,0x0C70,0x0C1C,0x0C0C,0x0C06,0x0C06,0x4C06,0x4F0C,0x38F8,0x0000,0x0000,0x0000,0x0000,0x0000},/*"a",65*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x001E,0x0018,0x0018,0x0018,0x0018,0x0018,0x0018,0x0F18,0x18D8,0x3038,0x6038,0x6018,0x6018,0x6018,0x6018,0x6018,0x6018,0x2018,0x3038,0x1878,0x07C8,0x0000,0x0000,0x0000,0x0000,0x0000},/*"b",66*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x07C0,0x0C70,0x1818,0x1818,0x180C,0x000C,0x000C,0x000C,0x000C,0x200C,0x2018,0x1018,0x0830,0x07C0,0x0000,0x0000,0x0000,0x0000,0x0000},/*"c",67*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x1000,0x1E00,0x1800,0x1800,0x1800,0x1800,0x1800,0x1800,0x1BE0,0x1C30,0x1818,0x1818,0x180C,0x180C,0x180C,0x180C,0x180C,0x180C,0x1808,0x1C18,0x7A30,0x09E0,0x0000,0x0000,0x0000,0x0000,0x0000},/*"d",68*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x07C0,0x0C30,0x1818,0x1008,0x300C,0x300C,0x3FFC,0x000C,0x000C,0x000C,0x2018,0x1018,0x1870,0x07C0,0x0000,0x0000,0x0000,0x0000,0x0000},/*"e",69*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3E00,0xC380,0xC080,0xC0C0,0x00C0,0x00C0,0x00C0,0x1FFC,0x00C0,0x00C0,0x00C0,0x00C0,0x00C0,0x00C0,0x00C0,0x00C0,0x00C0,0x00C0,0x00C0,0x00C0,0x0FF8,0x0000,0x0000,0x0000,0x0000,0x0000},/*"f",70*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x77C0,0x6C30,0x1810,0x1818,0x1818,0x1818,0x1810,0x0C30,0x07F0,0x0018,0x0018,0x0FF0,0x3FF0,0x7008,0x600C,0x600C,0x600C,0x3838,0x0FE0},/*"g",71*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x001E,0x0018,0x0018,0x0018,0x0018,0x0018,0x0018,0x0F98,0x18D8,0x3038,0x3018,0x3018,0x3018,0x3018,0x3018,0x3018,0x3018,0x3018,0x3018,0x3018,0xFC7E,0x0000,0x0000,0x0000,0x0000,0x0000},/*"h",72*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0380,0x0380,0x0380,0x0000,0x0000,0x0000,0x0100,0x01F8,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x1FF8,0x0000,0x0000,0x0000,0x0000,0x0000},/*"i",73*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3800,0x3800,0x3800,0x0000,0x0000,0x0000,0x1000,0x1F80,0x1800,0x1800,0x1800,0x1800,0x1800,0x1800,0x1800,0x1800,0x1800,0x1800,0x1800,0x1800,0x1800,0x1800,0x1800,0x0C18,0x0618,0x03F0},/*"j",74*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x001E,0x0018,0x0018,0x0018,0x0018,0x0018,0x0018,0x3E18,0x0C18,0x0618,0x0318,0x0118,0x0198,0x01D8,0x0338,0x0718,0x0618,0x0C18,0x1C18,0x1818,0x7C7E,0x0000,0x0000,0x0000,0x0000,0x0000},/*"k",75*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0100,0x01F8,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x0180,0x1FF8,0x0000,0x0000,0x0000,0x0000,0x0000},/*"l",76*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0008,0x1CEE,0x339C,0x318C,0x318C,0x318C,0x318C,0x318C,0x318C,0x318C,0x318C,0x318C,0x318C,0x318C,0x7BDE,0x0000,0x0000,0x0000,0x0000,0x0000},/*"m",77*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x0F1E,0x18D8,0x3038,0x3018,0x3018,0x3018,0x3018,0x3018,0x3018,0x3018,0x3018,0x3018,0x3018,0xFC7E,0x0000,0x0000,0x0000,0x0000,0x0000},/*"n",78*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x07C0,0x1C70,0x3010,0x3018,0x600C,0x600C,0x600C,0x600C,0x600C,0x600C,0x3018,0x3018,0x1830,0x07C0,0x0000,0x0000,0x0000,0x0000,0x0000},/*"o",79*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x0F9E,0x1858,0x3038,0x2018,0x6018,0x6018,0x6018,0x6018,0x6018,0x6018,0x3018,0x3038,0x1878,0x0798,0x0018,0x0018,0x0018,0x0018,0x007E},/*"p",80*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x23C0,0x3C30,0x3818,0x3018,0x300C,0x300C,0x300C,0x300C,0x300C,0x300C,0x3008,0x3818,0x3C30,0x33E0,0x3000,0x3000,0x3000,0x3000,0xFC00},/*"q",81*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0060,0x3C7E,0x6660,0x6160,0x00E0,0x00E0,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x0060,0x07FE,0x0000,0x0000,0x0000,0x0000,0x0000},/*"r",82*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x27E0,0x3830,0x3018,0x2018,0x0018,0x0070,0x03E0,0x0F80,0x1C00,0x3004,0x3004,0x300C,0x181C,0x0FEC,0x0000,0x0000,0x0000,0x0000,0x0000},/*"s",83*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0080,0x0080,0x0080,0x00C0,0x00E0,0x1FFC,0x00C0,0x00C0,0x00C0,0x00C0,0x00C0,0x00C0,0x00C0,0x00C0,0x00C0,0x20C0,0x20C0,0x1180,0x0F00,0x0000,0x0000,0x0000,0x0000,0x0000},/*"t",84*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2010,0x3C1E,0x3018,0x3018,0x3018,0x3018,0x3018,0x3018,0x3018,0x3018,0x3018,0x3018,0x3818,0xF430,0x13E0,0x0000,0x0000,0x0000,0x0000,0x0000},/*"u",85*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3C7E,0x1818,0x0818,0x0838,0x0430,0x0430,0x0270,0x0260,0x0260,0x01E0,0x01C0,0x01C0,0x00C0,0x0080,0x0000,0x0000,0x0000,0x0000,0x0000},/*"v",86*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xF7DF,0x638E,0x230C,0x238C,0x238C,0x1398,0x1398,0x1658,0x1658,0x0E70,0x0E70,0x0E70,0x0420,0x0420,0x0000,0x0000,0x0000,0x0000,0x0000},/*"w",87*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3EFC,0x0870,0x0470,0x04E0,0x02C0,0x01C0,0x0380,0x0380,0x0740,0x0660,0x0C20,0x0C10,0x1818,0x7E3E,0x0000,0x0000,0x0000,0x0000,0x0000},/*"x",88*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7C7E,0x1818,0x0818,0x0830,0x0830,0x0430,0x0460,0x0460,0x02C0,0x02C0,0x02C0,0x0180,0x0180,0x0180,0x0080,0x0080,0x0080,0x004C,0x003C},/*"y",89*/
+{0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1FFC,0x0C0C,0x0E04,0x0604,0x0300,0x0380,0x0180,0x00C0,0x00E0,0x2070,0x2030,0x3038,0x181C,0x1FFC,0x0000,0x0000,0x0000,0x0000,0x0000},/*"z",90*/
+{0x0000,0x0000,0x0000,0x3000,0x0800,0x0400,0x0400,0x0400,0x0400,0x0400,0x0400,0x0400,0x0400,0x0400,0x0400,0x0200,0x0180,0x0200,0x0400,0x0400,0x0400,0x0400,0x0400,0x0400,0x0400,0x0400,0x0400,0x0400,0x0400,0x0800,0x3000,0x0000},/*"{",91*/
+{0x0100,0x0100,0x0100,0x0100,0x0100,0x0100,0x0100,0x0100,0x0100,0x0100,0x0100,0x0100,0x0100,0x0100,0x0100,0x0100,0x0100,0x0100,0x0100,0x0100,0x0100,0x0100,0x0100,0x0100,0x0100,0x0100,0x0100,0x0100,0x0100,0x0100,0x0100,0x0100},/*"|",92*/
+{0x0000,0x0000,0x0000,0x000C,0x0010,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0040,0x0180,0x0040,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0010,0x000C,0x0000},/*"}",93*/
+{0x0000,0x0038,0x00C4,0x4086,0x6102,0x2200,0x1C00,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000},/*"~",94*/
+};
+
+#endif
@@ -0,0 +1,288 @@
+/*
+ * FreeRTOS Kernel V10.4.6
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Binary kernel event trace recorder.
+ *
+ * The trace hook macros below write one 8 byte record per kernel event into a
+ * RAM ring buffer.  A record holds the DWT cycle counter, an event code, an 8
+ * bit argument and a 16 bit object identifier (the object address divided by
+ * four).  Events that need a full 32 bit value - ticks to delay, bytes sent,
+ * event group bits, allocation sizes - are followed by a trcEVT_PARAM record
+ * whose timestamp field holds the value.
+ *
+ * Space in the ring is claimed with LDREX/STREX, so recording never disables
+ * interrupts and can be used from any interrupt, including those above
+ * configMAX_SYSCALL_INTERRUPT_PRIORITY.
+ *
+ * In trcMODE_SNAPSHOT the ring is overwritten continuously and holds the most
+ * recent events.  Call vTraceStop() when something goes wrong, then read the
+ * ring out with vTraceSnapshotDump() or with a debugger.  In trcMODE_STREAM a
+ * low priority task sends the ring out through configTRACE_RECORDER_WRITE()
+ * every configTRACE_STREAM_PERIOD_MS, and events are dropped (and counted)
+ * while the ring is full.
+ *
+ * Both modes produce the same framed output.  Every frame is:
+ *
+ *     0xA5 0x5A 'T' 'R' | type | length (2 bytes) | payload | checksum
+ *
+ * where the checksum is the low byte of the sum of the type, length and
+ * payload bytes, and all values are little endian.  The frame types are
+ * trcFRAME_HEADER, trcFRAME_SYMBOL and trcFRAME_EVENTS.  The framing lets
+ * trace data share the UART with printf() output.  Tools/tracedec in the
+ * repository root turns a capture into Perfetto/Chrome JSON or CTF and reports
+ * per task run time, wakeup latency and blocking time per queue.
+ *
+ * Objects that carry the trace output itself, such as the UART transmit stream
+ * buffer and its mutex, should be passed to vTraceExcludeObject() so sending
+ * the trace does not generate more trace.
+ *
+ * Set configUSE_TRACE_RECORDER to 1 in FreeRTOSConfig.h, include this header
+ * at the end of FreeRTOSConfig.h, and call vTraceEnable() before the first task
+ * is created so that every task name is recorded.
+ */
+
+#ifndef TRACE_RECORDER_H
+#define TRACE_RECORDER_H
+
+#include <stdint.h>
+
+#if ( configUSE_TRACE_FACILITY != 1 )
+    #error configUSE_TRACE_FACILITY must be set to 1 in FreeRTOSConfig.h to use the trace recorder.
+#endif
+
+/* Recorder modes for configTRACE_RECORDER_MODE. */
+#define trcMODE_SNAPSHOT    0
+#define trcMODE_STREAM      1
+
+#ifndef configTRACE_RECORDER_MODE
+    #define configTRACE_RECORDER_MODE    trcMODE_SNAPSHOT
+#endif
+
+/* Number of 8 byte records in the ring buffer.  Must be a power of 2. */
+#ifndef configTRACE_RECORDER_BUFFER_RECORDS
+    #define configTRACE_RECORDER_BUFFER_RECORDS    256
+#endif
+
+/* Number of task, queue and timer names that are kept for the decoder. */
+#ifndef configTRACE_RECORDER_MAX_SYMBOLS
+    #define configTRACE_RECORDER_MAX_SYMBOLS    24
+#endif
+
+/* Set to 1 to record every tick interrupt.  At the default tick rate this is
+ * more data than a 115200 baud UART can stream, so it is off by default. */
+#ifndef configTRACE_RECORDER_TICK_EVENTS
+    #define configTRACE_RECORDER_TICK_EVENTS    0
+#endif
+
+#ifndef configTRACE_STREAM_TASK_PRIORITY
+    #define configTRACE_STREAM_TASK_PRIORITY    1
+#endif
+
+#ifndef configTRACE_STREAM_TASK_STACK_DEPTH
+    #define configTRACE_STREAM_TASK_STACK_DEPTH    configMINIMAL_STACK_SIZE
+#endif
+
+#ifndef configTRACE_STREAM_PERIOD_MS
+    #define configTRACE_STREAM_PERIOD_MS    10
+#endif
+
+/* Frame types. */
+#define trcFRAME_HEADER     ( ( uint8_t ) 'H' )
+#define trcFRAME_SYMBOL     ( ( uint8_t ) 'S' )
+#define trcFRAME_EVENTS     ( ( uint8_t ) 'E' )
+
+/* Symbol kinds. */
+#define trcOBJ_TASK         1
+#define trcOBJ_QUEUE        2
+#define trcOBJ_TIMER        3
+
+/* Event codes.  Unless noted the object is the task, queue, stream buffer,
+ * event group or timer the event applies to. */
+#define trcEVT_NONE                         0x00    /* Slot not written yet. */
+#define trcEVT_PARAM                        0x01    /* 32 bit value of the previous event. */
+#define trcEVT_DROPPED                      0x02    /* Stream mode: parameter = events lost since the last report. */
+#define trcEVT_USER                         0x03    /* vTraceUserEvent(): arg = code, parameter = value. */
+
+#define trcEVT_TASK_SWITCHED_IN             0x10    /* arg = priority. */
+#define trcEVT_TASK_READY                   0x11    /* arg = priority. */
+#define trcEVT_TASK_CREATE                  0x12    /* arg = priority. */
+#define trcEVT_TASK_DELETE                  0x13
+#define trcEVT_TASK_DELAY                   0x14    /* parameter = ticks to delay. */
+#define trcEVT_TASK_DELAY_UNTIL             0x15    /* parameter = tick count to wake at. */
+#define trcEVT_TASK_SUSPEND                 0x16
+#define trcEVT_TASK_RESUME                  0x17
+#define trcEVT_TASK_RESUME_FROM_ISR         0x18
+#define trcEVT_TASK_PRIORITY_SET            0x19    /* arg = new priority. */
+#define trcEVT_TASK_PRIORITY_INHERIT        0x1A    /* arg = inherited priority. */
+#define trcEVT_TASK_PRIORITY_DISINHERIT     0x1B    /* arg = priority returned to. */
+#define trcEVT_TASK_NOTIFY                  0x1C    /* Object = task notified, arg = index. */
+#define trcEVT_TASK_NOTIFY_FROM_ISR         0x1D    /* Object = task notified, arg = index. */
+#define trcEVT_TASK_NOTIFY_WAIT_BLOCK       0x1E    /* arg = index. */
+
+#define trcEVT_TICK                         0x20    /* Object = 0, parameter = tick count. */
+#define trcEVT_ISR_ENTER                    0x21    /* Object = 0, arg = exception number. */
+#define trcEVT_ISR_EXIT                     0x22    /* Object = 0, arg = exception number. */
+
+#define trcEVT_QUEUE_CREATE                 0x30    /* arg = queueQUEUE_TYPE_xxx. */
+#define trcEVT_QUEUE_DELETE                 0x31
+#define trcEVT_QUEUE_SEND                   0x32    /* For all queue events arg = items in the queue before the call. */
+#define trcEVT_QUEUE_SEND_FAILED            0x33
+#define trcEVT_QUEUE_SEND_FROM_ISR          0x34
+#define trcEVT_QUEUE_SEND_FROM_ISR_FAILED   0x35
+#define trcEVT_QUEUE_RECEIVE                0x36
+#define trcEVT_QUEUE_RECEIVE_FAILED         0x37
+#define trcEVT_QUEUE_RECEIVE_FROM_ISR       0x38
+#define trcEVT_QUEUE_RECEIVE_FROM_ISR_FAILED 0x39
+#define trcEVT_QUEUE_PEEK                   0x3A
+#define trcEVT_QUEUE_BLOCK_SEND             0x3B
+#define trcEVT_QUEUE_BLOCK_RECEIVE          0x3C    /* Also used when blocking on a peek. */
+
+#define trcEVT_STREAM_CREATE                0x40    /* arg = 1 for a message buffer. */
+#define trcEVT_STREAM_DELETE                0x41
+#define trcEVT_STREAM_SEND                  0x42    /* parameter = bytes sent. */
+#define trcEVT_STREAM_SEND_FROM_ISR         0x43    /* parameter = bytes sent. */
+#define trcEVT_STREAM_RECEIVE               0x44    /* parameter = bytes received. */
+#define trcEVT_STREAM_RECEIVE_FROM_ISR      0x45    /* parameter = bytes received. */
+#define trcEVT_STREAM_BLOCK_SEND            0x46
+#define trcEVT_STREAM_BLOCK_RECEIVE         0x47
+
+#define trcEVT_EVENT_GROUP_CREATE           0x50
+#define trcEVT_EVENT_GROUP_DELETE           0x51
+#define trcEVT_EVENT_GROUP_SET_BITS         0x52    /* parameter = bits set. */
+#define trcEVT_EVENT_GROUP_SET_BITS_FROM_ISR 0x53   /* parameter = bits set. */
+#define trcEVT_EVENT_GROUP_CLEAR_BITS       0x54    /* parameter = bits cleared. */
+#define trcEVT_EVENT_GROUP_WAIT_BLOCK       0x55    /* parameter = bits waited for. */
+#define trcEVT_EVENT_GROUP_SYNC_BLOCK       0x56    /* parameter = bits waited for. */
+
+#define trcEVT_TIMER_CREATE                 0x60
+#define trcEVT_TIMER_EXPIRED                0x61
+
+#define trcEVT_MALLOC                       0x70    /* Object = block, parameter = size. */
+#define trcEVT_FREE                         0x71    /* Object = block, parameter = size. */
+
+/* Recorder API. */
+void vTraceEnable( void );
+void vTraceStop( void );
+void vTraceSnapshotDump( void );
+void vTraceUserEvent( uint8_t ucCode, uint32_t ulValue );
+void vTraceExcludeObject( const void * pvObject );
+uint32_t ulTraceGetDropped( void );
+
+/* Called by the hook macros only. */
+void vTraceRecord( uint32_t ulEvent, uint32_t ulArg, const void * pvObject );
+void vTraceRecordParam( uint32_t ulEvent, uint32_t ulArg, const void * pvObject, uint32_t ulParam );
+void vTraceObjectName( const void * pvObject, uint32_t ulKind, uint32_t ulArg, const char * pcName );
+void vTraceISREnter( void );
+void vTraceISRExit( void );
+
+/* Task hooks.  These expand inside tasks.c, so they can read the TCB. */
+#define traceTASK_SWITCHED_IN()                             vTraceRecord( trcEVT_TASK_SWITCHED_IN, pxCurrentTCB->uxPriority, pxCurrentTCB )
+#define traceMOVED_TASK_TO_READY_STATE( pxTCB )             vTraceRecord( trcEVT_TASK_READY, ( pxTCB )->uxPriority, ( pxTCB ) )
+#define traceTASK_CREATE( pxNewTCB )                                                                \
+    do {                                                                                            \
+        vTraceObjectName( ( pxNewTCB ), trcOBJ_TASK, ( pxNewTCB )->uxPriority, ( pxNewTCB )->pcTaskName ); \
+        vTraceRecord( trcEVT_TASK_CREATE, ( pxNewTCB )->uxPriority, ( pxNewTCB ) );                 \
+    } while( 0 )
+#define traceTASK_DELETE( pxTaskToDelete )                  vTraceRecord( trcEVT_TASK_DELETE, 0, ( pxTaskToDelete ) )
+#define traceTASK_DELAY()                                   vTraceRecordParam( trcEVT_TASK_DELAY, 0, pxCurrentTCB, xTicksToDelay )
+#define traceTASK_DELAY_UNTIL( xTimeToWake )                vTraceRecordParam( trcEVT_TASK_DELAY_UNTIL, 0, pxCurrentTCB, ( xTimeToWake ) )
+#define traceTASK_SUSPEND( pxTaskToSuspend )                vTraceRecord( trcEVT_TASK_SUSPEND, 0, ( pxTaskToSuspend ) )
+#define traceTASK_RESUME( pxTaskToResume )                  vTraceRecord( trcEVT_TASK_RESUME, 0, ( pxTaskToResume ) )
+#define traceTASK_RESUME_FROM_ISR( pxTaskToResume )         vTraceRecord( trcEVT_TASK_RESUME_FROM_ISR, 0, ( pxTaskToResume ) )
+#define traceTASK_PRIORITY_SET( pxTask, uxNewPriority )     vTraceRecord( trcEVT_TASK_PRIORITY_SET, ( uxNewPriority ), ( pxTask ) )
+#define traceTASK_PRIORITY_INHERIT( pxTCBOfMutexHolder, uxInheritedPriority ) \
+    vTraceRecord( trcEVT_TASK_PRIORITY_INHERIT, ( uxInheritedPriority ), ( pxTCBOfMutexHolder ) )
+#define traceTASK_PRIORITY_DISINHERIT( pxTCBOfMutexHolder, uxOriginalPriority ) \
+    vTraceRecord( trcEVT_TASK_PRIORITY_DISINHERIT, ( uxOriginalPriority ), ( pxTCBOfMutexHolder ) )
+#define traceTASK_NOTIFY( uxIndexToNotify )                 vTraceRecord( trcEVT_TASK_NOTIFY, ( uxIndexToNotify ), pxTCB )
+#define traceTASK_NOTIFY_FROM_ISR( uxIndexToNotify )        vTraceRecord( trcEVT_TASK_NOTIFY_FROM_ISR, ( uxIndexToNotify ), pxTCB )
+#define traceTASK_NOTIFY_GIVE_FROM_ISR( uxIndexToNotify )   vTraceRecord( trcEVT_TASK_NOTIFY_FROM_ISR, ( uxIndexToNotify ), pxTCB )
+#define traceTASK_NOTIFY_TAKE_BLOCK( uxIndexToWait )        vTraceRecord( trcEVT_TASK_NOTIFY_WAIT_BLOCK, ( uxIndexToWait ), pxCurrentTCB )
+#define traceTASK_NOTIFY_WAIT_BLOCK( uxIndexToWait )        vTraceRecord( trcEVT_TASK_NOTIFY_WAIT_BLOCK, ( uxIndexToWait ), pxCurrentTCB )
+
+#if ( configTRACE_RECORDER_TICK_EVENTS == 1 )
+    #define traceTASK_INCREMENT_TICK( xTickCount )          vTraceRecordParam( trcEVT_TICK, 0, 0, ( xTickCount ) )
+#endif
+
+/* Queue, semaphore and mutex hooks, expanded inside queue.c. */
+#define traceQUEUE_CREATE( pxNewQueue )                     vTraceRecord( trcEVT_QUEUE_CREATE, ( pxNewQueue )->ucQueueType, ( pxNewQueue ) )
+#define traceQUEUE_DELETE( pxQueue )                        vTraceRecord( trcEVT_QUEUE_DELETE, 0, ( pxQueue ) )
+#define traceQUEUE_SEND( pxQueue )                          vTraceRecord( trcEVT_QUEUE_SEND, ( pxQueue )->uxMessagesWaiting, ( pxQueue ) )
+#define traceQUEUE_SEND_FAILED( pxQueue )                   vTraceRecord( trcEVT_QUEUE_SEND_FAILED, ( pxQueue )->uxMessagesWaiting, ( pxQueue ) )
+#define traceQUEUE_SEND_FROM_ISR( pxQueue )                 vTraceRecord( trcEVT_QUEUE_SEND_FROM_ISR, ( pxQueue )->uxMessagesWaiting, ( pxQueue ) )
+#define traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue )          vTraceRecord( trcEVT_QUEUE_SEND_FROM_ISR_FAILED, ( pxQueue )->uxMessagesWaiting, ( pxQueue ) )
+#define traceQUEUE_RECEIVE( pxQueue )                       vTraceRecord( trcEVT_QUEUE_RECEIVE, ( pxQueue )->uxMessagesWaiting, ( pxQueue ) )
+#define traceQUEUE_RECEIVE_FAILED( pxQueue )                vTraceRecord( trcEVT_QUEUE_RECEIVE_FAILED, ( pxQueue )->uxMessagesWaiting, ( pxQueue ) )
+#define traceQUEUE_RECEIVE_FROM_ISR( pxQueue )              vTraceRecord( trcEVT_QUEUE_RECEIVE_FROM_ISR, ( pxQueue )->uxMessagesWaiting, ( pxQueue ) )
+#define traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue )       vTraceRecord( trcEVT_QUEUE_RECEIVE_FROM_ISR_FAILED, ( pxQueue )->uxMessagesWaiting, ( pxQueue ) )
+#define traceQUEUE_PEEK( pxQueue )                          vTraceRecord( trcEVT_QUEUE_PEEK, ( pxQueue )->uxMessagesWaiting, ( pxQueue ) )
+#define traceQUEUE_PEEK_FROM_ISR( pxQueue )                 vTraceRecord( trcEVT_QUEUE_PEEK, ( pxQueue )->uxMessagesWaiting, ( pxQueue ) )
+#define traceBLOCKING_ON_QUEUE_SEND( pxQueue )              vTraceRecord( trcEVT_QUEUE_BLOCK_SEND, ( pxQueue )->uxMessagesWaiting, ( pxQueue ) )
+#define traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue )           vTraceRecord( trcEVT_QUEUE_BLOCK_RECEIVE, ( pxQueue )->uxMessagesWaiting, ( pxQueue ) )
+#define traceBLOCKING_ON_QUEUE_PEEK( pxQueue )              vTraceRecord( trcEVT_QUEUE_BLOCK_RECEIVE, ( pxQueue )->uxMessagesWaiting, ( pxQueue ) )
+#define traceQUEUE_REGISTRY_ADD( xQueue, pcQueueName )      vTraceObjectName( ( xQueue ), trcOBJ_QUEUE, 0, ( pcQueueName ) )
+
+/* Stream and message buffer hooks. */
+#define traceSTREAM_BUFFER_CREATE( pxStreamBuffer, xIsMessageBuffer )       vTraceRecord( trcEVT_STREAM_CREATE, ( xIsMessageBuffer ), ( pxStreamBuffer ) )
+#define traceSTREAM_BUFFER_DELETE( xStreamBuffer )                          vTraceRecord( trcEVT_STREAM_DELETE, 0, ( xStreamBuffer ) )
+#define traceSTREAM_BUFFER_SEND( xStreamBuffer, xBytesSent )                vTraceRecordParam( trcEVT_STREAM_SEND, 0, ( xStreamBuffer ), ( xBytesSent ) )
+#define traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xBytesSent )       vTraceRecordParam( trcEVT_STREAM_SEND_FROM_ISR, 0, ( xStreamBuffer ), ( xBytesSent ) )
+#define traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xReceivedLength )        vTraceRecordParam( trcEVT_STREAM_RECEIVE, 0, ( xStreamBuffer ), ( xReceivedLength ) )
+#define traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xReceivedLength ) vTraceRecordParam( trcEVT_STREAM_RECEIVE_FROM_ISR, 0, ( xStreamBuffer ), ( xReceivedLength ) )
+#define traceBLOCKING_ON_STREAM_BUFFER_SEND( xStreamBuffer )                vTraceRecord( trcEVT_STREAM_BLOCK_SEND, 0, ( xStreamBuffer ) )
+#define traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( xStreamBuffer )             vTraceRecord( trcEVT_STREAM_BLOCK_RECEIVE, 0, ( xStreamBuffer ) )
+
+/* Event group hooks. */
+#define traceEVENT_GROUP_CREATE( xEventGroup )                              vTraceRecord( trcEVT_EVENT_GROUP_CREATE, 0, ( xEventGroup ) )
+#define traceEVENT_GROUP_DELETE( xEventGroup )                              vTraceRecord( trcEVT_EVENT_GROUP_DELETE, 0, ( xEventGroup ) )
+#define traceEVENT_GROUP_SET_BITS( xEventGroup, uxBitsToSet )               vTraceRecordParam( trcEVT_EVENT_GROUP_SET_BITS, 0, ( xEventGroup ), ( uxBitsToSet ) )
+#define traceEVENT_GROUP_SET_BITS_FROM_ISR( xEventGroup, uxBitsToSet )      vTraceRecordParam( trcEVT_EVENT_GROUP_SET_BITS_FROM_ISR, 0, ( xEventGroup ), ( uxBitsToSet ) )
+#define traceEVENT_GROUP_CLEAR_BITS( xEventGroup, uxBitsToClear )           vTraceRecordParam( trcEVT_EVENT_GROUP_CLEAR_BITS, 0, ( xEventGroup ), ( uxBitsToClear ) )
+#define traceEVENT_GROUP_WAIT_BITS_BLOCK( xEventGroup, uxBitsToWaitFor )    vTraceRecordParam( trcEVT_EVENT_GROUP_WAIT_BLOCK, 0, ( xEventGroup ), ( uxBitsToWaitFor ) )
+#define traceEVENT_GROUP_SYNC_BLOCK( xEventGroup, uxBitsToSet, uxBitsToWaitFor ) \
+    vTraceRecordParam( trcEVT_EVENT_GROUP_SYNC_BLOCK, 0, ( xEventGroup ), ( uxBitsToWaitFor ) )
+
+/* Software timer hooks, expanded inside timers.c. */
+#define traceTIMER_CREATE( pxNewTimer )                                                             \
+    do {                                                                                            \
+        vTraceObjectName( ( pxNewTimer ), trcOBJ_TIMER, 0, ( pxNewTimer )->pcTimerName );           \
+        vTraceRecord( trcEVT_TIMER_CREATE, 0, ( pxNewTimer ) );                                     \
+    } while( 0 )
+#define traceTIMER_EXPIRED( pxTimer )                       vTraceRecord( trcEVT_TIMER_EXPIRED, 0, ( pxTimer ) )
+
+/* Memory hooks. */
+#define traceMALLOC( pvAddress, uiSize )                    vTraceRecordParam( trcEVT_MALLOC, 0, ( pvAddress ), ( uiSize ) )
+#define traceFREE( pvAddress, uiSize )                      vTraceRecordParam( trcEVT_FREE, 0, ( pvAddress ), ( uiSize ) )
+
+/* Interrupt entry and exit, called by the interrupt handlers that want to
+ * appear in the trace. */
+#define traceISR_ENTER()                                    vTraceISREnter()
+#define traceISR_EXIT()                                     vTraceISRExit()
+
+#endif /* TRACE_RECORDER_H */
@@ -44,6 +44,10 @@
     #error configUSE_TASK_NOTIFICATIONS must be set to 1 to build stream_buffer.c
 #endif
 
+#if ( configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS == 1 ) && ( !defined( portLOAD_EXCLUSIVE ) || !defined( portSTORE_EXCLUSIVE ) || !defined( portCLEAR_EXCLUSIVE ) )
+    #error configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS is set to 1 but the port does not define portLOAD_EXCLUSIVE(), portSTORE_EXCLUSIVE() and portCLEAR_EXCLUSIVE()
+#endif
+
 /* Lint e961, e9021 and e750 are suppressed as a MISRA exception justified
  * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
  * for the header files above, but not in this file, in order to generate the
@@ -135,6 +139,11 @@
 /* Bits stored in the ucFlags field of the stream buffer. */
 #define sbFLAGS_IS_MESSAGE_BUFFER          ( ( uint8_t ) 1 ) /* Set if the stream buffer was created as a message buffer, in which case it holds discrete messages rather than a stream. */
 #define sbFLAGS_IS_STATICALLY_ALLOCATED    ( ( uint8_t ) 2 ) /* Set if the stream buffer was created using statically allocated memory. */
+#define sbFLAGS_IS_MULTI_PRODUCER          ( ( uint8_t ) 4 ) /* Set if the message buffer was created to accept writes from more than one task or interrupt. */
+
+/* In a multi producer message buffer the most significant bit of a message's
+ * stored length is set while the message is still being written. */
+#define sbMULTI_PRODUCER_BUSY_BIT          ( ( configMESSAGE_BUFFER_LENGTH_TYPE ) 1 << ( ( sizeof( configMESSAGE_BUFFER_LENGTH_TYPE ) * ( size_t ) 8 ) - ( size_t ) 1 ) )
 
 /*-----------------------------------------------------------*/
 
@@ -153,6 +162,15 @@ typedef struct StreamBufferDef_t                 /*lint !e9058 Style convention
     #if ( configUSE_TRACE_FACILITY == 1 )
         UBaseType_t uxStreamBufferNumber; /* Used for tracing purposes. */
     #endif
+
+    #if ( configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS == 1 )
+        volatile size_t xReserveHead; /* Index to the next free byte in a multi producer message buffer.  Runs ahead of xHead by the messages that are reserved but not yet visible to the reader. */
+    #endif
+
+    #if ( configUSE_STREAM_BUFFER_MAX_LATENCY == 1 )
+        TickType_t xMaxLatencyTicks;          /* The longest time data can sit in the stream buffer below the trigger level before a task that is waiting for data is unblocked.  0 if not used. */
+        volatile TickType_t xOldestByteTime; /* The tick count at which the stream buffer last went from empty to not empty. */
+    #endif
 } StreamBuffer_t;
 
 /*
@@ -218,6 +236,130 @@ static size_t prvReadBytesFromBuffer( StreamBuffer_t * pxStreamBuffer,
                                       size_t xCount,
                                       size_t xTail ) PRIVILEGED_FUNCTION;
 
+/*
+ * Describes the xCount bytes of the buffer's data storage area that start at
+ * index xIndex as one contiguous span, or as two spans if the region wraps
+ * around the end of the storage area.  No data is copied.
+ */
+static void prvGetSpan( const StreamBuffer_t * const pxStreamBuffer,
+                        size_t xIndex,
+                        size_t xCount,
+                        StreamBufferSpan_t * const pxSpan ) PRIVILEGED_FUNCTION;
+
+/*
+ * Used by the zero copy reserve functions.  Works out how much of the free
+ * space can be granted to the writer (all or nothing for a message buffer, as
+ * much as possible for a stream buffer) and describes it in pxSpan.  The space
+ * following xHead is left for the message length when the stream buffer is
+ * being used as a message buffer.
+ */
+static size_t prvReserveSpan( const StreamBuffer_t * const pxStreamBuffer,
+                              size_t xDataLengthBytes,
+                              size_t xSpace,
+                              StreamBufferSpan_t * const pxSpan ) PRIVILEGED_FUNCTION;
+
+/*
+ * Used by the zero copy commit functions.  Publishes xDataLengthBytes bytes the
+ * writer has already placed in the span returned by prvReserveSpan(), first
+ * writing the message length if the stream buffer is being used as a message
+ * buffer.
+ */
+static size_t prvCommitSpan( StreamBuffer_t * const pxStreamBuffer,
+                             size_t xDataLengthBytes ) PRIVILEGED_FUNCTION;
+
+/*
+ * Used by the zero copy peek functions.  Describes the next message (message
+ * buffer) or all the available bytes (stream buffer) in pxSpan without moving
+ * xTail.
+ */
+static size_t prvPeekSpan( StreamBuffer_t * const pxStreamBuffer,
+                           size_t xBytesAvailable,
+                           StreamBufferSpan_t * const pxSpan ) PRIVILEGED_FUNCTION;
+
+/*
+ * Used by the zero copy consume functions.  Moves xTail past the next message
+ * (message buffer) or past xBytesConsumed bytes (stream buffer).
+ */
+static size_t prvConsumeSpan( StreamBuffer_t * const pxStreamBuffer,
+                              size_t xBytesConsumed,
+                              size_t xBytesAvailable ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS == 1 )
+
+/*
+ * Claims space for a message in a multi producer message buffer by moving
+ * xReserveHead with LDREX/STREX, then stores the message's length with the
+ * busy bit set.  Interrupts are never masked, so any number of tasks and
+ * interrupts can reserve concurrently.
+ */
+    static size_t prvMultiProducerReserve( StreamBuffer_t * const pxStreamBuffer,
+                                           size_t xDataLengthBytes,
+                                           StreamBufferSpan_t * const pxSpan ) PRIVILEGED_FUNCTION;
+
+/*
+ * Marks the message described by pxSpan as complete, then moves xHead past
+ * the complete messages at the front of the reserved region one message per
+ * LDREX/STREX step, so the reader only ever sees whole messages, in the order
+ * they were reserved.
+ */
+    static size_t prvMultiProducerCommit( StreamBuffer_t * const pxStreamBuffer,
+                                          const StreamBufferSpan_t * const pxSpan ) PRIVILEGED_FUNCTION;
+
+/*
+ * Reserve, copy and commit in one call - used when xStreamBufferSend() or
+ * xStreamBufferSendFromISR() writes to a multi producer message buffer.
+ */
+    static size_t prvMultiProducerWrite( StreamBuffer_t * const pxStreamBuffer,
+                                         const void * pvTxData,
+                                         size_t xDataLengthBytes ) PRIVILEGED_FUNCTION;
+
+/*
+ * Read and write the length stored in front of a message in a multi producer
+ * message buffer.  The length is written most significant byte first, so a
+ * commit that reads it half written sees either zero or the busy bit.
+ */
+    static configMESSAGE_BUFFER_LENGTH_TYPE prvMultiProducerReadLength( const StreamBuffer_t * const pxStreamBuffer,
+                                                                        size_t xIndex ) PRIVILEGED_FUNCTION;
+
+    static void prvMultiProducerWriteLength( StreamBuffer_t * const pxStreamBuffer,
+                                             size_t xIndex,
+                                             configMESSAGE_BUFFER_LENGTH_TYPE xLength ) PRIVILEGED_FUNCTION;
+
+/*
+ * Zeroes xCount bytes from xIndex.  The reader zeroes every message it
+ * removes before moving xTail, so the length slot of a message that has been
+ * reserved but not yet given its length always reads zero.
+ */
+    static void prvMultiProducerClear( StreamBuffer_t * const pxStreamBuffer,
+                                       size_t xIndex,
+                                       size_t xCount ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS */
+
+/*
+ * Called after data has been written to the buffer to decide whether a task
+ * that is waiting for data should be unblocked.  When a maximum latency is set
+ * the waiting task is also unblocked by the first bytes written to an empty
+ * buffer, so it can shorten its block time to the latency deadline - see
+ * prvWaitForTriggerOrLatency().
+ */
+static BaseType_t prvIsTriggerReached( StreamBuffer_t * const pxStreamBuffer,
+                                       size_t xBytesWritten ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_STREAM_BUFFER_MAX_LATENCY == 1 )
+
+/*
+ * Used by the receive functions of a stream buffer that has a maximum latency
+ * set.  Blocks the calling task until the trigger level is reached, the oldest
+ * unread byte has been in the buffer for the maximum latency, or xTicksToWait
+ * expires - whichever happens first.  No software timer is needed as the
+ * latency deadline is simply used as the task's block time.
+ */
+    static void prvWaitForTriggerOrLatency( StreamBuffer_t * const pxStreamBuffer,
+                                            TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_STREAM_BUFFER_MAX_LATENCY */
+
 /*
  * Called by both pxStreamBufferCreate() and pxStreamBufferCreateStatic() to
  * initialise the members of the newly created stream buffer structure.
@@ -243,11 +385,20 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
          * (that is, it will hold discrete messages with a little meta data that
          * says how big the next message is) check the buffer will be large enough
          * to hold at least one message. */
-        if( xIsMessageBuffer == pdTRUE )
+        if( xIsMessageBuffer != pdFALSE )
         {
             /* Is a message buffer but not statically allocated. */
             ucFlags = sbFLAGS_IS_MESSAGE_BUFFER;
             configASSERT( xBufferSizeBytes > sbBYTES_TO_STORE_MESSAGE_LENGTH );
+
+            #if ( configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS == 1 )
+                {
+                    if( xIsMessageBuffer == sbTYPE_MULTI_PRODUCER_MESSAGE_BUFFER )
+                    {
+                        ucFlags |= sbFLAGS_IS_MULTI_PRODUCER;
+                    }
+                }
+            #endif
         }
         else
         {
@@ -331,6 +482,15 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
         {
             /* Statically allocated message buffer. */
             ucFlags = sbFLAGS_IS_MESSAGE_BUFFER | sbFLAGS_IS_STATICALLY_ALLOCATED;
+
+            #if ( configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS == 1 )
+                {
+                    if( xIsMessageBuffer == sbTYPE_MULTI_PRODUCER_MESSAGE_BUFFER )
+                    {
+                        ucFlags |= sbFLAGS_IS_MULTI_PRODUCER;
+                    }
+                }
+            #endif
         }
         else
         {
@@ -424,6 +584,10 @@ BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer )
         UBaseType_t uxStreamBufferNumber;
     #endif
 
+    #if ( configUSE_STREAM_BUFFER_MAX_LATENCY == 1 )
+        TickType_t xMaxLatencyTicks;
+    #endif
+
     configASSERT( pxStreamBuffer );
 
     #if ( configUSE_TRACE_FACILITY == 1 )
@@ -434,6 +598,14 @@ BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer )
         }
     #endif
 
+    #if ( configUSE_STREAM_BUFFER_MAX_LATENCY == 1 )
+        {
+            /* The maximum latency is a setting, like the trigger level, so is
+             * also kept across the reset. */
+            xMaxLatencyTicks = pxStreamBuffer->xMaxLatencyTicks;
+        }
+    #endif
+
     /* Can only reset a message buffer if there are no tasks blocked on it. */
     taskENTER_CRITICAL();
     {
@@ -454,6 +626,12 @@ BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer )
                     }
                 #endif
 
+                #if ( configUSE_STREAM_BUFFER_MAX_LATENCY == 1 )
+                    {
+                        pxStreamBuffer->xMaxLatencyTicks = xMaxLatencyTicks;
+                    }
+                #endif
+
                 traceSTREAM_BUFFER_RESET( xStreamBuffer );
             }
         }
@@ -494,6 +672,42 @@ BaseType_t xStreamBufferSetTriggerLevel( StreamBufferHandle_t xStreamBuffer,
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_STREAM_BUFFER_MAX_LATENCY == 1 )
+
+    BaseType_t xStreamBufferSetMaxLatency( StreamBufferHandle_t xStreamBuffer,
+                                           TickType_t xMaxLatencyTicks )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        BaseType_t xReturn;
+
+        configASSERT( pxStreamBuffer );
+
+        /* A task waiting on a message buffer is unblocked by every message, so
+         * a maximum latency only applies to stream buffers. */
+        if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 )
+        {
+            taskENTER_CRITICAL();
+            {
+                /* Start timing any data that is already in the buffer from
+                 * now. */
+                pxStreamBuffer->xOldestByteTime = xTaskGetTickCount();
+                pxStreamBuffer->xMaxLatencyTicks = xMaxLatencyTicks;
+            }
+            taskEXIT_CRITICAL();
+
+            xReturn = pdPASS;
+        }
+        else
+        {
+            xReturn = pdFALSE;
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_STREAM_BUFFER_MAX_LATENCY */
+/*-----------------------------------------------------------*/
+
 size_t xStreamBufferSpacesAvailable( StreamBufferHandle_t xStreamBuffer )
 {
     const StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
@@ -509,7 +723,19 @@ size_t xStreamBufferSpacesAvailable( StreamBufferHandle_t xStreamBuffer )
     {
         xOriginalTail = pxStreamBuffer->xTail;
         xSpace = pxStreamBuffer->xLength + pxStreamBuffer->xTail;
-        xSpace -= pxStreamBuffer->xHead;
+
+        #if ( configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS == 1 )
+            if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MULTI_PRODUCER ) != ( uint8_t ) 0 )
+            {
+                /* Space that has been reserved is not free even though the
+                 * reader cannot see it yet. */
+                xSpace -= pxStreamBuffer->xReserveHead;
+            }
+            else
+        #endif
+        {
+            xSpace -= pxStreamBuffer->xHead;
+        }
     } while( xOriginalTail != pxStreamBuffer->xTail );
 
     xSpace -= ( size_t ) 1;
@@ -580,6 +806,22 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
         {
             mtCOVERAGE_TEST_MARKER();
         }
+
+        #if ( configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS == 1 )
+            {
+                /* There can be any number of writers to a multi producer
+                 * message buffer but only one xTaskWaitingToSend, so writes to
+                 * a multi producer message buffer never block. */
+                if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MULTI_PRODUCER ) != ( uint8_t ) 0 )
+                {
+                    xTicksToWait = ( TickType_t ) 0;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif
     }
     else
     {
@@ -644,14 +886,23 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
         mtCOVERAGE_TEST_MARKER();
     }
 
-    xReturn = prvWriteMessageToBuffer( pxStreamBuffer, pvTxData, xDataLengthBytes, xSpace, xRequiredSpace );
+    #if ( configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS == 1 )
+        if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MULTI_PRODUCER ) != ( uint8_t ) 0 )
+        {
+            xReturn = prvMultiProducerWrite( pxStreamBuffer, pvTxData, xDataLengthBytes );
+        }
+        else
+    #endif
+    {
+        xReturn = prvWriteMessageToBuffer( pxStreamBuffer, pvTxData, xDataLengthBytes, xSpace, xRequiredSpace );
+    }
 
     if( xReturn > ( size_t ) 0 )
     {
         traceSTREAM_BUFFER_SEND( xStreamBuffer, xReturn );
 
         /* Was a task waiting for the data? */
-        if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+        if( prvIsTriggerReached( pxStreamBuffer, xReturn ) != pdFALSE )
         {
             sbSEND_COMPLETED( pxStreamBuffer );
         }
@@ -695,13 +946,22 @@ size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer,
         mtCOVERAGE_TEST_MARKER();
     }
 
-    xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
-    xReturn = prvWriteMessageToBuffer( pxStreamBuffer, pvTxData, xDataLengthBytes, xSpace, xRequiredSpace );
+    #if ( configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS == 1 )
+        if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MULTI_PRODUCER ) != ( uint8_t ) 0 )
+        {
+            xReturn = prvMultiProducerWrite( pxStreamBuffer, pvTxData, xDataLengthBytes );
+        }
+        else
+    #endif
+    {
+        xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
+        xReturn = prvWriteMessageToBuffer( pxStreamBuffer, pvTxData, xDataLengthBytes, xSpace, xRequiredSpace );
+    }
 
     if( xReturn > ( size_t ) 0 )
     {
         /* Was a task waiting for the data? */
-        if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+        if( prvIsTriggerReached( pxStreamBuffer, xReturn ) != pdFALSE )
         {
             sbSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
         }
@@ -789,6 +1049,24 @@ size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
         xBytesToStoreMessageLength = 0;
     }
 
+    #if ( configUSE_STREAM_BUFFER_MAX_LATENCY == 1 )
+        {
+            /* Only set on stream buffers.  Wait for the trigger level or the
+             * latency deadline, after which the code below does not wait
+             * again. */
+            if( ( pxStreamBuffer->xMaxLatencyTicks != ( TickType_t ) 0 ) &&
+                ( xTicksToWait != ( TickType_t ) 0 ) )
+            {
+                prvWaitForTriggerOrLatency( pxStreamBuffer, xTicksToWait );
+                xTicksToWait = ( TickType_t ) 0;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    #endif
+
     if( xTicksToWait != ( TickType_t ) 0 )
     {
         /* Checking if there is data and clearing the notification state must be
@@ -1010,89 +1288,1152 @@ static size_t prvReadMessageFromBuffer( StreamBuffer_t * pxStreamBuffer,
     if( xCount != ( size_t ) 0 )
     {
         /* Read the actual data and update the tail to mark the data as officially consumed. */
-        pxStreamBuffer->xTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) pvRxData, xCount, xNextTail ); /*lint !e9079 Data storage area is implemented as uint8_t array for ease of sizing, indexing and alignment. */
+        xNextTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) pvRxData, xCount, xNextTail ); /*lint !e9079 Data storage area is implemented as uint8_t array for ease of sizing, indexing and alignment. */
+
+        #if ( configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS == 1 )
+            {
+                /* Writers must find the freed space zeroed. */
+                if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MULTI_PRODUCER ) != ( uint8_t ) 0 )
+                {
+                    prvMultiProducerClear( pxStreamBuffer, pxStreamBuffer->xTail, xCount + sbBYTES_TO_STORE_MESSAGE_LENGTH );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif
+
+        pxStreamBuffer->xTail = xNextTail;
     }
 
     return xCount;
 }
 /*-----------------------------------------------------------*/
 
-BaseType_t xStreamBufferIsEmpty( StreamBufferHandle_t xStreamBuffer )
+size_t xStreamBufferSendReserve( StreamBufferHandle_t xStreamBuffer,
+                                 size_t xDataLengthBytes,
+                                 StreamBufferSpan_t * const pxSpan,
+                                 TickType_t xTicksToWait )
 {
-    const StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
-    BaseType_t xReturn;
-    size_t xTail;
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xReturn, xSpace = 0;
+    size_t xRequiredSpace = xDataLengthBytes;
+    TimeOut_t xTimeOut;
+    size_t xMaxReportedSpace;
 
+    configASSERT( pxSpan );
     configASSERT( pxStreamBuffer );
 
-    /* True if no bytes are available. */
-    xTail = pxStreamBuffer->xTail;
+    /* The maximum amount of space a stream buffer will ever report is its length
+     * minus 1. */
+    xMaxReportedSpace = pxStreamBuffer->xLength - ( size_t ) 1;
 
-    if( pxStreamBuffer->xHead == xTail )
+    /* The space that has to be free before the reservation can be granted is
+     * calculated exactly as it is by xStreamBufferSend(). */
+    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
     {
-        xReturn = pdTRUE;
+        xRequiredSpace += sbBYTES_TO_STORE_MESSAGE_LENGTH;
+
+        /* Overflow? */
+        configASSERT( xRequiredSpace > xDataLengthBytes );
+
+        if( xRequiredSpace > xMaxReportedSpace )
+        {
+            /* The message would not fit even if the entire buffer was empty,
+             * so don't wait for space. */
+            xTicksToWait = ( TickType_t ) 0;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
     }
     else
     {
-        xReturn = pdFALSE;
+        if( xRequiredSpace > xMaxReportedSpace )
+        {
+            xRequiredSpace = xMaxReportedSpace;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
     }
 
-    return xReturn;
-}
-/*-----------------------------------------------------------*/
+    if( xTicksToWait != ( TickType_t ) 0 )
+    {
+        vTaskSetTimeOutState( &xTimeOut );
 
-BaseType_t xStreamBufferIsFull( StreamBufferHandle_t xStreamBuffer )
-{
-    BaseType_t xReturn;
-    size_t xBytesToStoreMessageLength;
-    const StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        do
+        {
+            /* Wait until the required number of bytes are free in the
+             * buffer. */
+            taskENTER_CRITICAL();
+            {
+                xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
 
-    configASSERT( pxStreamBuffer );
+                if( xSpace < xRequiredSpace )
+                {
+                    /* Clear notification state as going to wait for space. */
+                    ( void ) xTaskNotifyStateClear( NULL );
 
-    /* This generic version of the receive function is used by both message
-     * buffers, which store discrete messages, and stream buffers, which store a
-     * continuous stream of bytes.  Discrete messages include an additional
-     * sbBYTES_TO_STORE_MESSAGE_LENGTH bytes that hold the length of the message. */
-    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+                    /* Should only be one writer. */
+                    configASSERT( pxStreamBuffer->xTaskWaitingToSend == NULL );
+                    pxStreamBuffer->xTaskWaitingToSend = xTaskGetCurrentTaskHandle();
+                }
+                else
+                {
+                    taskEXIT_CRITICAL();
+                    break;
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            traceBLOCKING_ON_STREAM_BUFFER_SEND( xStreamBuffer );
+            ( void ) xTaskNotifyWait( ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+            pxStreamBuffer->xTaskWaitingToSend = NULL;
+        } while( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE );
+    }
+    else
     {
-        xBytesToStoreMessageLength = sbBYTES_TO_STORE_MESSAGE_LENGTH;
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    if( xSpace == ( size_t ) 0 )
+    {
+        xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
     }
     else
     {
-        xBytesToStoreMessageLength = 0;
+        mtCOVERAGE_TEST_MARKER();
     }
 
-    /* True if the available space equals zero. */
-    if( xStreamBufferSpacesAvailable( xStreamBuffer ) <= xBytesToStoreMessageLength )
+    xReturn = prvReserveSpan( pxStreamBuffer, xDataLengthBytes, xSpace, pxSpan );
+
+    if( xReturn == ( size_t ) 0 )
     {
-        xReturn = pdTRUE;
+        traceSTREAM_BUFFER_SEND_FAILED( xStreamBuffer );
     }
     else
     {
-        xReturn = pdFALSE;
+        mtCOVERAGE_TEST_MARKER();
     }
 
     return xReturn;
 }
 /*-----------------------------------------------------------*/
 
-BaseType_t xStreamBufferSendCompletedFromISR( StreamBufferHandle_t xStreamBuffer,
-                                              BaseType_t * pxHigherPriorityTaskWoken )
+size_t xStreamBufferSendReserveFromISR( StreamBufferHandle_t xStreamBuffer,
+                                        size_t xDataLengthBytes,
+                                        StreamBufferSpan_t * const pxSpan )
 {
     StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
-    BaseType_t xReturn;
-    UBaseType_t uxSavedInterruptStatus;
 
+    configASSERT( pxSpan );
     configASSERT( pxStreamBuffer );
 
-    uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
-    {
-        if( ( pxStreamBuffer )->xTaskWaitingToReceive != NULL )
-        {
-            ( void ) xTaskNotifyFromISR( ( pxStreamBuffer )->xTaskWaitingToReceive,
-                                         ( uint32_t ) 0,
-                                         eNoAction,
-                                         pxHigherPriorityTaskWoken );
+    return prvReserveSpan( pxStreamBuffer, xDataLengthBytes, xStreamBufferSpacesAvailable( pxStreamBuffer ), pxSpan );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSendCommit( StreamBufferHandle_t xStreamBuffer,
+                                size_t xDataLengthBytes )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xReturn;
+
+    configASSERT( pxStreamBuffer );
+
+    xReturn = prvCommitSpan( pxStreamBuffer, xDataLengthBytes );
+
+    if( xReturn > ( size_t ) 0 )
+    {
+        traceSTREAM_BUFFER_SEND( xStreamBuffer, xReturn );
+
+        /* Was a task waiting for the data? */
+        if( prvIsTriggerReached( pxStreamBuffer, xReturn ) != pdFALSE )
+        {
+            sbSEND_COMPLETED( pxStreamBuffer );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSendCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+                                       size_t xDataLengthBytes,
+                                       BaseType_t * const pxHigherPriorityTaskWoken )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xReturn;
+
+    configASSERT( pxStreamBuffer );
+
+    xReturn = prvCommitSpan( pxStreamBuffer, xDataLengthBytes );
+
+    if( xReturn > ( size_t ) 0 )
+    {
+        /* Was a task waiting for the data? */
+        if( prvIsTriggerReached( pxStreamBuffer, xReturn ) != pdFALSE )
+        {
+            sbSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceivePeek( StreamBufferHandle_t xStreamBuffer,
+                                 StreamBufferSpan_t * const pxSpan,
+                                 TickType_t xTicksToWait )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xReturn = 0, xBytesAvailable, xBytesToStoreMessageLength;
+
+    configASSERT( pxSpan );
+    configASSERT( pxStreamBuffer );
+
+    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+    {
+        xBytesToStoreMessageLength = sbBYTES_TO_STORE_MESSAGE_LENGTH;
+    }
+    else
+    {
+        xBytesToStoreMessageLength = 0;
+    }
+
+    #if ( configUSE_STREAM_BUFFER_MAX_LATENCY == 1 )
+        {
+            /* Only set on stream buffers.  Wait for the trigger level or the
+             * latency deadline, after which the code below does not wait
+             * again. */
+            if( ( pxStreamBuffer->xMaxLatencyTicks != ( TickType_t ) 0 ) &&
+                ( xTicksToWait != ( TickType_t ) 0 ) )
+            {
+                prvWaitForTriggerOrLatency( pxStreamBuffer, xTicksToWait );
+                xTicksToWait = ( TickType_t ) 0;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    #endif
+
+    if( xTicksToWait != ( TickType_t ) 0 )
+    {
+        /* Checking if there is data and clearing the notification state must be
+         * performed atomically. */
+        taskENTER_CRITICAL();
+        {
+            xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+
+            if( xBytesAvailable <= xBytesToStoreMessageLength )
+            {
+                /* Clear notification state as going to wait for data. */
+                ( void ) xTaskNotifyStateClear( NULL );
+
+                /* Should only be one reader. */
+                configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
+                pxStreamBuffer->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( xBytesAvailable <= xBytesToStoreMessageLength )
+        {
+            /* Wait for data to be available. */
+            traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( xStreamBuffer );
+            ( void ) xTaskNotifyWait( ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+            pxStreamBuffer->xTaskWaitingToReceive = NULL;
+
+            /* Recheck the data available after blocking. */
+            xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+    }
+
+    if( xBytesAvailable > xBytesToStoreMessageLength )
+    {
+        xReturn = prvPeekSpan( pxStreamBuffer, xBytesAvailable, pxSpan );
+    }
+    else
+    {
+        prvGetSpan( pxStreamBuffer, pxStreamBuffer->xTail, 0, pxSpan );
+        traceSTREAM_BUFFER_RECEIVE_FAILED( xStreamBuffer );
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceivePeekFromISR( StreamBufferHandle_t xStreamBuffer,
+                                        StreamBufferSpan_t * const pxSpan )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xReturn = 0, xBytesAvailable, xBytesToStoreMessageLength;
+
+    configASSERT( pxSpan );
+    configASSERT( pxStreamBuffer );
+
+    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+    {
+        xBytesToStoreMessageLength = sbBYTES_TO_STORE_MESSAGE_LENGTH;
+    }
+    else
+    {
+        xBytesToStoreMessageLength = 0;
+    }
+
+    xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+
+    if( xBytesAvailable > xBytesToStoreMessageLength )
+    {
+        xReturn = prvPeekSpan( pxStreamBuffer, xBytesAvailable, pxSpan );
+    }
+    else
+    {
+        prvGetSpan( pxStreamBuffer, pxStreamBuffer->xTail, 0, pxSpan );
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceiveConsume( StreamBufferHandle_t xStreamBuffer,
+                                    size_t xBytesConsumed )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xReturn;
+
+    configASSERT( pxStreamBuffer );
+
+    xReturn = prvConsumeSpan( pxStreamBuffer, xBytesConsumed, prvBytesInBuffer( pxStreamBuffer ) );
+
+    /* Was a task waiting for space in the buffer? */
+    if( xReturn != ( size_t ) 0 )
+    {
+        traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xReturn );
+        sbRECEIVE_COMPLETED( pxStreamBuffer );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceiveConsumeFromISR( StreamBufferHandle_t xStreamBuffer,
+                                           size_t xBytesConsumed,
+                                           BaseType_t * const pxHigherPriorityTaskWoken )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xReturn;
+
+    configASSERT( pxStreamBuffer );
+
+    xReturn = prvConsumeSpan( pxStreamBuffer, xBytesConsumed, prvBytesInBuffer( pxStreamBuffer ) );
+
+    /* Was a task waiting for space in the buffer? */
+    if( xReturn != ( size_t ) 0 )
+    {
+        sbRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS == 1 )
+
+    size_t xStreamBufferMultiProducerReserve( StreamBufferHandle_t xStreamBuffer,
+                                              size_t xDataLengthBytes,
+                                              StreamBufferSpan_t * const pxSpan )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn;
+
+        configASSERT( pxSpan );
+        configASSERT( pxStreamBuffer );
+        configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MULTI_PRODUCER ) != ( uint8_t ) 0 );
+
+        xReturn = prvMultiProducerReserve( pxStreamBuffer, xDataLengthBytes, pxSpan );
+
+        if( xReturn == ( size_t ) 0 )
+        {
+            traceSTREAM_BUFFER_SEND_FAILED( xStreamBuffer );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS == 1 )
+
+    size_t xStreamBufferMultiProducerCommit( StreamBufferHandle_t xStreamBuffer,
+                                             const StreamBufferSpan_t * const pxSpan )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn;
+
+        configASSERT( pxSpan );
+        configASSERT( pxStreamBuffer );
+        configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MULTI_PRODUCER ) != ( uint8_t ) 0 );
+
+        xReturn = prvMultiProducerCommit( pxStreamBuffer, pxSpan );
+
+        traceSTREAM_BUFFER_SEND( xStreamBuffer, xReturn );
+
+        /* Committing a message does not necessarily make it visible to the
+         * reader (an older message may still be being written), so check the
+         * trigger level against what the reader can actually see. */
+        if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+        {
+            sbSEND_COMPLETED( pxStreamBuffer );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS == 1 )
+
+    size_t xStreamBufferMultiProducerCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+                                                    const StreamBufferSpan_t * const pxSpan,
+                                                    BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn;
+
+        configASSERT( pxSpan );
+        configASSERT( pxStreamBuffer );
+        configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MULTI_PRODUCER ) != ( uint8_t ) 0 );
+
+        xReturn = prvMultiProducerCommit( pxStreamBuffer, pxSpan );
+
+        if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+        {
+            sbSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS */
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvIsTriggerReached( StreamBuffer_t * const pxStreamBuffer,
+                                       size_t xBytesWritten )
+{
+    size_t xBytesAvailable;
+    BaseType_t xReturn;
+
+    xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+
+    if( xBytesAvailable >= pxStreamBuffer->xTriggerLevelBytes )
+    {
+        xReturn = pdTRUE;
+    }
+    else
+    {
+        xReturn = pdFALSE;
+    }
+
+    #if ( configUSE_STREAM_BUFFER_MAX_LATENCY == 1 )
+        {
+            /* If the buffer was empty before this write then the bytes just
+             * written are now the oldest unread bytes. */
+            if( ( pxStreamBuffer->xMaxLatencyTicks != ( TickType_t ) 0 ) &&
+                ( xBytesWritten != ( size_t ) 0 ) &&
+                ( xBytesAvailable == xBytesWritten ) )
+            {
+                /* This function is called from both tasks and interrupts.  The
+                 * FromISR version of the tick count read is safe from both. */
+                pxStreamBuffer->xOldestByteTime = xTaskGetTickCountFromISR();
+
+                /* Unblock a waiting task even though the trigger level has not
+                 * been reached, so it can block again with a block time that
+                 * ends at the latency deadline. */
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    #else /* if ( configUSE_STREAM_BUFFER_MAX_LATENCY == 1 ) */
+        {
+            ( void ) xBytesWritten;
+        }
+    #endif /* configUSE_STREAM_BUFFER_MAX_LATENCY */
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STREAM_BUFFER_MAX_LATENCY == 1 )
+
+    static void prvWaitForTriggerOrLatency( StreamBuffer_t * const pxStreamBuffer,
+                                            TickType_t xTicksToWait )
+    {
+        TimeOut_t xTimeOut;
+        TickType_t xBlockTime, xAge;
+        size_t xBytesAvailable;
+        BaseType_t xShouldBlock;
+
+        vTaskSetTimeOutState( &xTimeOut );
+
+        for( ; ; )
+        {
+            /* Checking the data and clearing the notification state must be
+             * performed atomically. */
+            taskENTER_CRITICAL();
+            {
+                xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+                xBlockTime = xTicksToWait;
+
+                if( xBytesAvailable >= pxStreamBuffer->xTriggerLevelBytes )
+                {
+                    xShouldBlock = pdFALSE;
+                }
+                else if( xBytesAvailable == ( size_t ) 0 )
+                {
+                    /* The first bytes written will unblock this task - see
+                     * prvIsTriggerReached(). */
+                    xShouldBlock = pdTRUE;
+                }
+                else
+                {
+                    xAge = xTaskGetTickCount() - pxStreamBuffer->xOldestByteTime;
+
+                    if( xAge >= pxStreamBuffer->xMaxLatencyTicks )
+                    {
+                        xShouldBlock = pdFALSE;
+                    }
+                    else
+                    {
+                        xShouldBlock = pdTRUE;
+
+                        if( ( pxStreamBuffer->xMaxLatencyTicks - xAge ) < xBlockTime )
+                        {
+                            xBlockTime = pxStreamBuffer->xMaxLatencyTicks - xAge;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                }
+
+                if( xShouldBlock != pdFALSE )
+                {
+                    /* Clear notification state as going to wait for data. */
+                    ( void ) xTaskNotifyStateClear( NULL );
+
+                    /* Should only be one reader. */
+                    configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
+                    pxStreamBuffer->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            if( xShouldBlock == pdFALSE )
+            {
+                break;
+            }
+
+            traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( pxStreamBuffer );
+            ( void ) xTaskNotifyWait( ( uint32_t ) 0, ( uint32_t ) 0, NULL, xBlockTime );
+            pxStreamBuffer->xTaskWaitingToReceive = NULL;
+
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+            {
+                /* The caller's block time has expired - it receives whatever
+                 * is available. */
+                break;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    }
+
+#endif /* configUSE_STREAM_BUFFER_MAX_LATENCY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS == 1 )
+
+    static size_t prvMultiProducerReserve( StreamBuffer_t * const pxStreamBuffer,
+                                           size_t xDataLengthBytes,
+                                           StreamBufferSpan_t * const pxSpan )
+    {
+        size_t xSpace, xIndex, xNextReserveHead = 0;
+
+        /* The busy bit must not be needed to hold the length itself. */
+        configASSERT( ( ( configMESSAGE_BUFFER_LENGTH_TYPE ) xDataLengthBytes & sbMULTI_PRODUCER_BUSY_BIT ) == 0 );
+
+        /* An interrupt between the LDREX and the STREX makes the STREX fail,
+         * and the space is claimed again from the new xReserveHead. */
+        do
+        {
+            xIndex = ( size_t ) portLOAD_EXCLUSIVE( ( volatile uint32_t * ) &( pxStreamBuffer->xReserveHead ) );
+            xSpace = pxStreamBuffer->xLength + pxStreamBuffer->xTail;
+            xSpace -= xIndex + ( size_t ) 1;
+
+            if( xSpace >= pxStreamBuffer->xLength )
+            {
+                xSpace -= pxStreamBuffer->xLength;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( ( xDataLengthBytes == ( size_t ) 0 ) ||
+                ( xSpace < ( xDataLengthBytes + sbBYTES_TO_STORE_MESSAGE_LENGTH ) ) )
+            {
+                portCLEAR_EXCLUSIVE();
+                xDataLengthBytes = 0;
+                break;
+            }
+            else
+            {
+                xNextReserveHead = ( xIndex + sbBYTES_TO_STORE_MESSAGE_LENGTH + xDataLengthBytes ) % pxStreamBuffer->xLength;
+            }
+        } while( portSTORE_EXCLUSIVE( ( uint32_t ) xNextReserveHead, ( volatile uint32_t * ) &( pxStreamBuffer->xReserveHead ) ) != 0U );
+
+        if( xDataLengthBytes != ( size_t ) 0 )
+        {
+            /* Until this write the length slot reads zero, which a commit
+             * walking xHead forward treats the same as the busy bit. */
+            prvMultiProducerWriteLength( pxStreamBuffer, xIndex, ( configMESSAGE_BUFFER_LENGTH_TYPE ) xDataLengthBytes | sbMULTI_PRODUCER_BUSY_BIT );
+            xIndex = ( xIndex + sbBYTES_TO_STORE_MESSAGE_LENGTH ) % pxStreamBuffer->xLength;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        prvGetSpan( pxStreamBuffer, xIndex, xDataLengthBytes, pxSpan );
+
+        return xDataLengthBytes;
+    }
+
+#endif /* configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS == 1 )
+
+    static size_t prvMultiProducerCommit( StreamBuffer_t * const pxStreamBuffer,
+                                          const StreamBufferSpan_t * const pxSpan )
+    {
+        size_t xIndex, xHead, xNextHead;
+        configMESSAGE_BUFFER_LENGTH_TYPE xTempDataLength;
+        size_t xReturn;
+
+        /* The message's length is stored immediately before its first byte,
+         * possibly at the end of the storage area if the message itself starts
+         * at the beginning. */
+        xIndex = ( size_t ) ( pxSpan->pucFirst - pxStreamBuffer->pucBuffer );
+        xIndex += pxStreamBuffer->xLength - sbBYTES_TO_STORE_MESSAGE_LENGTH;
+
+        if( xIndex >= pxStreamBuffer->xLength )
+        {
+            xIndex -= pxStreamBuffer->xLength;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* Clear the busy bit.  Only this writer touches its own length. */
+        xTempDataLength = prvMultiProducerReadLength( pxStreamBuffer, xIndex );
+        configASSERT( ( xTempDataLength & sbMULTI_PRODUCER_BUSY_BIT ) != 0 );
+        xTempDataLength &= ( configMESSAGE_BUFFER_LENGTH_TYPE ) ~sbMULTI_PRODUCER_BUSY_BIT;
+        xReturn = ( size_t ) xTempDataLength;
+        prvMultiProducerWriteLength( pxStreamBuffer, xIndex, xTempDataLength );
+
+        /* Publish the complete messages at the front of the reserved region,
+         * one message per LDREX/STREX step with interrupts enabled throughout.
+         * Each commit clears its own busy bit before it looks at xHead, so a
+         * message committed out of order is published by the commit of the
+         * oldest message that was still being written. */
+        for( ; ; )
+        {
+            xHead = ( size_t ) portLOAD_EXCLUSIVE( ( volatile uint32_t * ) &( pxStreamBuffer->xHead ) );
+
+            if( xHead == pxStreamBuffer->xReserveHead )
+            {
+                portCLEAR_EXCLUSIVE();
+                break;
+            }
+
+            xTempDataLength = prvMultiProducerReadLength( pxStreamBuffer, xHead );
+
+            if( ( xTempDataLength == ( configMESSAGE_BUFFER_LENGTH_TYPE ) 0 ) ||
+                ( ( xTempDataLength & sbMULTI_PRODUCER_BUSY_BIT ) != 0 ) )
+            {
+                portCLEAR_EXCLUSIVE();
+                break;
+            }
+
+            xNextHead = ( xHead + sbBYTES_TO_STORE_MESSAGE_LENGTH + ( size_t ) xTempDataLength ) % pxStreamBuffer->xLength;
+
+            /* Fails, and the step is taken again, if an interrupt moved xHead
+             * in the meantime. */
+            ( void ) portSTORE_EXCLUSIVE( ( uint32_t ) xNextHead, ( volatile uint32_t * ) &( pxStreamBuffer->xHead ) );
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS == 1 )
+
+    static configMESSAGE_BUFFER_LENGTH_TYPE prvMultiProducerReadLength( const StreamBuffer_t * const pxStreamBuffer,
+                                                                        size_t xIndex )
+    {
+        const volatile uint8_t * const pucBuffer = pxStreamBuffer->pucBuffer;
+        configMESSAGE_BUFFER_LENGTH_TYPE xLength = 0;
+        size_t x;
+
+        for( x = sbBYTES_TO_STORE_MESSAGE_LENGTH; x > ( size_t ) 0; x-- )
+        {
+            xLength <<= 8;
+            xLength |= ( configMESSAGE_BUFFER_LENGTH_TYPE ) pucBuffer[ ( xIndex + x - ( size_t ) 1 ) % pxStreamBuffer->xLength ];
+        }
+
+        return xLength;
+    }
+
+#endif /* configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS == 1 )
+
+    static void prvMultiProducerWriteLength( StreamBuffer_t * const pxStreamBuffer,
+                                             size_t xIndex,
+                                             configMESSAGE_BUFFER_LENGTH_TYPE xLength )
+    {
+        volatile uint8_t * const pucBuffer = pxStreamBuffer->pucBuffer;
+        size_t x;
+
+        /* Stored least significant byte first, which is how the reader's
+         * memcpy() sees it on the little endian Cortex-M, but written from
+         * the most significant byte - the one that holds the busy bit. */
+        for( x = sbBYTES_TO_STORE_MESSAGE_LENGTH; x > ( size_t ) 0; x-- )
+        {
+            pucBuffer[ ( xIndex + x - ( size_t ) 1 ) % pxStreamBuffer->xLength ] = ( uint8_t ) ( xLength >> ( ( x - ( size_t ) 1 ) * ( size_t ) 8 ) );
+        }
+    }
+
+#endif /* configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS == 1 )
+
+    static void prvMultiProducerClear( StreamBuffer_t * const pxStreamBuffer,
+                                       size_t xIndex,
+                                       size_t xCount )
+    {
+        size_t xFirstLength;
+
+        xFirstLength = configMIN( pxStreamBuffer->xLength - xIndex, xCount );
+        ( void ) memset( ( void * ) &( pxStreamBuffer->pucBuffer[ xIndex ] ), 0x00, xFirstLength ); /*lint !e9087 memset() requires void *. */
+
+        if( xCount > xFirstLength )
+        {
+            ( void ) memset( ( void * ) pxStreamBuffer->pucBuffer, 0x00, xCount - xFirstLength ); /*lint !e9087 memset() requires void *. */
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS == 1 )
+
+    static size_t prvMultiProducerWrite( StreamBuffer_t * const pxStreamBuffer,
+                                         const void * pvTxData,
+                                         size_t xDataLengthBytes )
+    {
+        StreamBufferSpan_t xSpan;
+        size_t xReturn;
+
+        xReturn = prvMultiProducerReserve( pxStreamBuffer, xDataLengthBytes, &xSpan );
+
+        if( xReturn != ( size_t ) 0 )
+        {
+            /* Copy the message in place - no other writer touches the
+             * reserved space. */
+            ( void ) memcpy( ( void * ) xSpan.pucFirst, pvTxData, xSpan.xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+
+            if( xSpan.xSecondLength != ( size_t ) 0 )
+            {
+                ( void ) memcpy( ( void * ) xSpan.pucSecond, ( const void * ) &( ( ( const uint8_t * ) pvTxData )[ xSpan.xFirstLength ] ), xSpan.xSecondLength ); /*lint !e9087 memcpy() requires void *. */
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            ( void ) prvMultiProducerCommit( pxStreamBuffer, &xSpan );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS */
+/*-----------------------------------------------------------*/
+
+static void prvGetSpan( const StreamBuffer_t * const pxStreamBuffer,
+                        size_t xIndex,
+                        size_t xCount,
+                        StreamBufferSpan_t * const pxSpan )
+{
+    size_t xFirstLength;
+
+    configASSERT( xIndex < pxStreamBuffer->xLength );
+    configASSERT( xCount < pxStreamBuffer->xLength );
+
+    /* The first span runs from xIndex to the end of the storage area at most.
+     * Anything left over wraps back to the start of the storage area. */
+    xFirstLength = configMIN( pxStreamBuffer->xLength - xIndex, xCount );
+
+    pxSpan->pucFirst = &( pxStreamBuffer->pucBuffer[ xIndex ] );
+    pxSpan->xFirstLength = xFirstLength;
+
+    if( xCount > xFirstLength )
+    {
+        pxSpan->pucSecond = pxStreamBuffer->pucBuffer;
+        pxSpan->xSecondLength = xCount - xFirstLength;
+    }
+    else
+    {
+        pxSpan->pucSecond = NULL;
+        pxSpan->xSecondLength = 0;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvReserveSpan( const StreamBuffer_t * const pxStreamBuffer,
+                              size_t xDataLengthBytes,
+                              size_t xSpace,
+                              StreamBufferSpan_t * const pxSpan )
+{
+    size_t xIndex = pxStreamBuffer->xHead;
+
+    /* Multi producer message buffers have their own reserve function. */
+    configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MULTI_PRODUCER ) == ( uint8_t ) 0 );
+
+    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+    {
+        /* A message can only be reserved in its entirety, and the bytes that
+         * follow xHead are kept back for the length that is written by the
+         * commit. */
+        if( xSpace >= ( xDataLengthBytes + sbBYTES_TO_STORE_MESSAGE_LENGTH ) )
+        {
+            xIndex += sbBYTES_TO_STORE_MESSAGE_LENGTH;
+
+            if( xIndex >= pxStreamBuffer->xLength )
+            {
+                xIndex -= pxStreamBuffer->xLength;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            xDataLengthBytes = 0;
+        }
+    }
+    else
+    {
+        /* Grant as many bytes of a stream as will fit. */
+        xDataLengthBytes = configMIN( xDataLengthBytes, xSpace );
+    }
+
+    prvGetSpan( pxStreamBuffer, xIndex, xDataLengthBytes, pxSpan );
+
+    return xDataLengthBytes;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvCommitSpan( StreamBuffer_t * const pxStreamBuffer,
+                             size_t xDataLengthBytes )
+{
+    size_t xNextHead = pxStreamBuffer->xHead;
+    configMESSAGE_BUFFER_LENGTH_TYPE xTempDataLength;
+
+    /* Multi producer message buffers have their own commit function. */
+    configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MULTI_PRODUCER ) == ( uint8_t ) 0 );
+
+    if( xDataLengthBytes != ( size_t ) 0 )
+    {
+        if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+        {
+            /* The writer must not commit more than was reserved. */
+            configASSERT( xStreamBufferSpacesAvailable( pxStreamBuffer ) >= ( xDataLengthBytes + sbBYTES_TO_STORE_MESSAGE_LENGTH ) );
+
+            /* The message itself is already in place, so only its length has
+             * to be copied into the buffer. */
+            xTempDataLength = ( configMESSAGE_BUFFER_LENGTH_TYPE ) xDataLengthBytes;
+            xNextHead = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) &( xTempDataLength ), sbBYTES_TO_STORE_MESSAGE_LENGTH, xNextHead );
+        }
+        else
+        {
+            configASSERT( xStreamBufferSpacesAvailable( pxStreamBuffer ) >= xDataLengthBytes );
+        }
+
+        xNextHead += xDataLengthBytes;
+
+        if( xNextHead >= pxStreamBuffer->xLength )
+        {
+            xNextHead -= pxStreamBuffer->xLength;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* Only now does the reader see the new data. */
+        pxStreamBuffer->xHead = xNextHead;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xDataLengthBytes;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvPeekSpan( StreamBuffer_t * const pxStreamBuffer,
+                           size_t xBytesAvailable,
+                           StreamBufferSpan_t * const pxSpan )
+{
+    size_t xNextTail = pxStreamBuffer->xTail;
+    configMESSAGE_BUFFER_LENGTH_TYPE xTempNextMessageLength;
+
+    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+    {
+        /* Skip over the length of the message - the span only describes the
+         * message itself. */
+        xNextTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xTempNextMessageLength, sbBYTES_TO_STORE_MESSAGE_LENGTH, xNextTail );
+        xBytesAvailable = ( size_t ) xTempNextMessageLength;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    prvGetSpan( pxStreamBuffer, xNextTail, xBytesAvailable, pxSpan );
+
+    return xBytesAvailable;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvConsumeSpan( StreamBuffer_t * const pxStreamBuffer,
+                              size_t xBytesConsumed,
+                              size_t xBytesAvailable )
+{
+    size_t xNextTail = pxStreamBuffer->xTail;
+    configMESSAGE_BUFFER_LENGTH_TYPE xTempNextMessageLength;
+
+    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+    {
+        /* Messages are discrete, so the whole of the next message is removed
+         * whatever the value of xBytesConsumed. */
+        if( xBytesAvailable > sbBYTES_TO_STORE_MESSAGE_LENGTH )
+        {
+            xNextTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xTempNextMessageLength, sbBYTES_TO_STORE_MESSAGE_LENGTH, xNextTail );
+            xBytesConsumed = ( size_t ) xTempNextMessageLength;
+        }
+        else
+        {
+            xBytesConsumed = 0;
+        }
+    }
+    else
+    {
+        xBytesConsumed = configMIN( xBytesConsumed, xBytesAvailable );
+    }
+
+    if( xBytesConsumed != ( size_t ) 0 )
+    {
+        xNextTail += xBytesConsumed;
+
+        if( xNextTail >= pxStreamBuffer->xLength )
+        {
+            xNextTail -= pxStreamBuffer->xLength;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* Only now does the writer see the freed space. */
+        pxStreamBuffer->xTail = xNextTail;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xBytesConsumed;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferIsEmpty( StreamBufferHandle_t xStreamBuffer )
+{
+    const StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    BaseType_t xReturn;
+    size_t xTail;
+
+    configASSERT( pxStreamBuffer );
+
+    /* True if no bytes are available. */
+    xTail = pxStreamBuffer->xTail;
+
+    if( pxStreamBuffer->xHead == xTail )
+    {
+        xReturn = pdTRUE;
+    }
+    else
+    {
+        xReturn = pdFALSE;
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferIsFull( StreamBufferHandle_t xStreamBuffer )
+{
+    BaseType_t xReturn;
+    size_t xBytesToStoreMessageLength;
+    const StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+    configASSERT( pxStreamBuffer );
+
+    /* This generic version of the receive function is used by both message
+     * buffers, which store discrete messages, and stream buffers, which store a
+     * continuous stream of bytes.  Discrete messages include an additional
+     * sbBYTES_TO_STORE_MESSAGE_LENGTH bytes that hold the length of the message. */
+    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+    {
+        xBytesToStoreMessageLength = sbBYTES_TO_STORE_MESSAGE_LENGTH;
+    }
+    else
+    {
+        xBytesToStoreMessageLength = 0;
+    }
+
+    /* True if the available space equals zero. */
+    if( xStreamBufferSpacesAvailable( xStreamBuffer ) <= xBytesToStoreMessageLength )
+    {
+        xReturn = pdTRUE;
+    }
+    else
+    {
+        xReturn = pdFALSE;
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferSendCompletedFromISR( StreamBufferHandle_t xStreamBuffer,
+                                              BaseType_t * pxHigherPriorityTaskWoken )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    BaseType_t xReturn;
+    UBaseType_t uxSavedInterruptStatus;
+
+    configASSERT( pxStreamBuffer );
+
+    uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+    {
+        if( ( pxStreamBuffer )->xTaskWaitingToReceive != NULL )
+        {
+            ( void ) xTaskNotifyFromISR( ( pxStreamBuffer )->xTaskWaitingToReceive,
+                                         ( uint32_t ) 0,
+                                         eNoAction,
+                                         pxHigherPriorityTaskWoken );
             ( pxStreamBuffer )->xTaskWaitingToReceive = NULL;
             xReturn = pdTRUE;
         }
@@ -1273,6 +2614,20 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
     pxStreamBuffer->xLength = xBufferSizeBytes;
     pxStreamBuffer->xTriggerLevelBytes = xTriggerLevelBytes;
     pxStreamBuffer->ucFlags = ucFlags;
+
+    #if ( configUSE_MULTI_PRODUCER_MESSAGE_BUFFERS == 1 )
+        {
+            /* Length slots that have not been written yet must read zero. */
+            if( ( ucFlags & sbFLAGS_IS_MULTI_PRODUCER ) != ( uint8_t ) 0 )
+            {
+                ( void ) memset( ( void * ) pucBuffer, 0x00, xBufferSizeBytes ); /*lint !e9087 memset() requires void *. */
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    #endif
 }
 
 #if ( configUSE_TRACE_FACILITY == 1 )
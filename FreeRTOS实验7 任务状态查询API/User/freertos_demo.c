@@ -25,6 +25,7 @@
 #include "./BSP/KEY/key.h"
 #include "./SYSTEM/delay/delay.h"
 #include "./MALLOC/malloc.h"
+#include <string.h>
 
 /*FreeRTOS*********************************************************************************************/
 #include "FreeRTOS.h"
@@ -73,6 +74,84 @@ void task1( void * pvParameters )
 
 char task_buff[400];
 
+#if configUSE_STACK_PROFILER
+//打印每个任务的栈大小, 空闲任务扫描得到的最小剩余栈和推荐栈大小, 单位: 字(4 Byte)
+void print_stack_profile(void)
+{
+    TaskIterator_t it;
+    TaskStatus_t status[4];
+    UBaseType_t num;
+
+    printf("任务名\t\t栈大小\t最小剩余\t推荐大小\r\n");
+    vTaskIteratorInit(&it);
+    while ((num = uxTaskIteratorNext(&it, status, 4, pdFALSE)) > 0)
+    {
+        for (UBaseType_t i = 0; i < num; i++)
+        {
+            if (status[i].usRecommendedStackDepth == 0)     //还没有扫描完
+            {
+                printf("%s\t\t%u\t-\t-\r\n", status[i].pcTaskName, status[i].usStackDepth);
+            }
+            else
+            {
+                printf("%s\t\t%u\t%u\t%u\r\n",
+                        status[i].pcTaskName,
+                        status[i].usStackDepth,
+                        status[i].usStackMinFree,
+                        status[i].usRecommendedStackDepth);
+            }
+        }
+    }
+}
+
+#define STACK_WARN_NUM      4   //最多暂存的栈余量警告个数
+
+//空闲任务发现的栈余量不足的任务, 由task2打印
+typedef struct
+{
+    char name[configMAX_TASK_NAME_LEN];
+    configSTACK_DEPTH_TYPE free_words;
+} _stack_warn;
+
+static _stack_warn g_stack_warn[STACK_WARN_NUM];
+static uint8_t g_stack_warn_num = 0;
+
+//剩余栈小于configSTACK_PROFILER_MARGIN_WORDS时由空闲任务调用, 不能阻塞
+//printf会等待串口的互斥量和发送缓冲区, 所以这里只记下任务名和余量, 由task2打印
+void vApplicationStackMarginHook(TaskHandle_t xTask, char *pcTaskName, configSTACK_DEPTH_TYPE uxFreeWords)
+{
+    (void)xTask;
+
+    taskENTER_CRITICAL();
+    if (g_stack_warn_num < STACK_WARN_NUM)
+    {
+        strncpy(g_stack_warn[g_stack_warn_num].name, pcTaskName, configMAX_TASK_NAME_LEN - 1);
+        g_stack_warn[g_stack_warn_num].name[configMAX_TASK_NAME_LEN - 1] = '\0';
+        g_stack_warn[g_stack_warn_num].free_words = uxFreeWords;
+        g_stack_warn_num++;
+    }
+    taskEXIT_CRITICAL();
+}
+
+//打印空闲任务记下的栈余量警告
+void print_stack_warn(void)
+{
+    _stack_warn warn[STACK_WARN_NUM];
+    uint8_t num;
+
+    taskENTER_CRITICAL();
+    num = g_stack_warn_num;
+    memcpy(warn, g_stack_warn, sizeof(warn));
+    g_stack_warn_num = 0;
+    taskEXIT_CRITICAL();
+
+    for (uint8_t i = 0; i < num; i++)
+    {
+        printf("警告: 任务%s的栈只剩%u字未使用\r\n", warn[i].name, warn[i].free_words);
+    }
+}
+#endif
+
 //任务2：用于展示任务状态信息查询相关API函数的使用
 void task2( void * pvParameters )
 {
@@ -138,6 +217,10 @@ void task2( void * pvParameters )
     {
         // task_stack_min = uxTaskGetStackHighWaterMark( task2_handler );
         // printf("task2历史最小剩余堆栈: %d\r\n", task_stack_min);
+#if configUSE_STACK_PROFILER
+        print_stack_warn();
+        print_stack_profile();
+#endif
         vTaskDelay(1000);
     }
 }
@@ -0,0 +1,77 @@
+/**
+ ****************************************************************************************************
+ * @file        lcd_task.h
+ * @author      正点原子团队(ALIENTEK)
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       LCD 绘图任务(异步绘图命令队列) 驱动代码
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 STM32F103开发板
+ * 在线视频:www.yuanzige.com
+ * 技术论坛:www.openedv.com
+ * 公司网址:www.alientek.com
+ * 购买地址:openedv.taobao.com
+ *
+ * 使用说明
+ * 1, lcd_task_init 创建绘图任务, 之后屏幕只由该任务操作, 其他任务不要再直接调用 lcd_xxx 函数.
+ * 2, lcd_task_xxx 只把绘图命令放入队列后立即返回, 绘图任务按顺序执行. 字符串会被复制,
+ *    lcd_task_color_fill 的颜色数组和 lcd_task_comp_flush 的画布只保存指针, 在 lcd_task_fence
+ *    返回之前不能修改.
+ * 3, 绘图任务每次从队列中取出一批命令, 后面有相同的命令, 或后面的纯色填充/彩色填充/清屏
+ *    完全覆盖了某条命令的区域时, 这条命令不再执行. 合并不会跨过 fence.
+ * 4, lcd_task_fence 等待在它之前提交的命令全部写到屏幕, 使用调用任务的第 LCD_TASK_NOTIFY_INDEX
+ *    个任务通知.
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __LCD_TASK_H
+#define __LCD_TASK_H
+
+#include "./SYSTEM/sys/sys.h"
+#include "./BSP/LCD/lcd_comp.h"
+
+
+/******************************************************************************************/
+/* 绘图任务 定义 */
+
+#define LCD_EN_TASK                 SYS_SUPPORT_OS      /* 使能(1)/禁止(0) LCD绘图任务, 需要FreeRTOS */
+
+#define LCD_TASK_PRIO               2                   /* 绘图任务优先级 */
+#define LCD_TASK_STACK_SIZE         256                 /* 绘图任务堆栈大小, 单位: Word */
+#define LCD_TASK_QUEUE_LEN          16                  /* 命令队列长度 */
+#define LCD_TASK_BATCH_LEN          8                   /* 每批最多取出的命令数, 即合并的范围 */
+#define LCD_TASK_STR_LEN            24                  /* 字符串命令最多保存的字符数(含结束符) */
+#define LCD_TASK_NOTIFY_INDEX       0                   /* lcd_task_fence 使用的任务通知序号 */
+
+/******************************************************************************************/
+
+#if LCD_EN_TASK
+
+#include "FreeRTOS.h"
+
+uint8_t lcd_task_init(void);                                                                        /* 创建绘图任务 */
+uint8_t lcd_task_fence(TickType_t wait);                                                            /* 等待之前提交的命令执行完成 */
+#define lcd_task_flush()            lcd_task_fence(portMAX_DELAY)                                   /* 一直等到之前提交的命令执行完成 */
+
+uint8_t lcd_task_clear(uint16_t color);                                                             /* 清屏 */
+uint8_t lcd_task_draw_point(uint16_t x, uint16_t y, uint16_t color);                                /* 画点 */
+uint8_t lcd_task_fill(uint16_t sx, uint16_t sy, uint16_t ex, uint16_t ey, uint16_t color);          /* 纯色填充矩形 */
+uint8_t lcd_task_color_fill(uint16_t sx, uint16_t sy, uint16_t ex, uint16_t ey, uint16_t *color);   /* 彩色填充矩形 */
+uint8_t lcd_task_draw_line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color);     /* 画直线 */
+uint8_t lcd_task_draw_rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color);/* 画矩形 */
+uint8_t lcd_task_draw_circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color);                  /* 画圆 */
+uint8_t lcd_task_show_num(uint16_t x, uint16_t y, uint32_t num, uint8_t len, uint8_t size, uint16_t color);                     /* 显示数字 */
+uint8_t lcd_task_show_string(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t size, char *p, uint16_t color);   /* 显示字符串 */
+uint8_t lcd_task_comp_flush(_lcd_comp *comp);                                                       /* 把画布的脏区域写到屏幕 */
+
+#endif
+
+#endif
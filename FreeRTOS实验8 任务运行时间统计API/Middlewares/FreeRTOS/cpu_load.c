@@ -0,0 +1,471 @@
+/*
+ * FreeRTOS Kernel V10.4.6
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Windowed CPU load service - see cpu_load.h. */
+
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+#include "cpu_load.h"
+
+#if ( configUSE_CPU_LOAD == 1 )
+
+#if ( configGENERATE_RUN_TIME_STATS != 1 )
+    #error configGENERATE_RUN_TIME_STATS must be set to 1 in FreeRTOSConfig.h to use the CPU load service.
+#endif
+
+#if ( configUSE_TRACE_FACILITY != 1 )
+    #error configUSE_TRACE_FACILITY must be set to 1 in FreeRTOSConfig.h to use the CPU load service.
+#endif
+
+#if ( configUSE_TIMERS != 1 )
+    #error configUSE_TIMERS must be set to 1 in FreeRTOSConfig.h to use the CPU load service.
+#endif
+
+#if ( INCLUDE_xTaskGetIdleTaskHandle != 1 )
+    #error INCLUDE_xTaskGetIdleTaskHandle must be set to 1 in FreeRTOSConfig.h to use the CPU load service.
+#endif
+
+#define cpuloadFULL_SCALE    10000U /* 100% in 0.01% units. */
+
+/* A task table entry.  An uxTaskNumber of 0 marks a free entry, as task
+ * numbers start at 1. */
+typedef struct CpuLoadEntry
+{
+    CpuLoadTask_t xTask;
+    configRUN_TIME_COUNTER_TYPE ulLastCounter; /* The task's run time counter at the end of the last window. */
+    configRUN_TIME_COUNTER_TYPE ulDelta;       /* Run time used in the window being closed. */
+    uint8_t ucSeen;                            /* Set when the task is found by the current sample. */
+} CpuLoadEntry_t;
+
+typedef struct CpuLoadState
+{
+    CpuLoadEntry_t xEntries[ configCPU_LOAD_MAX_TASKS ];
+    CpuLoad_t xLoad;                           /* Figures of the last completed window. */
+    TimerHandle_t xTimer;
+    configRUN_TIME_COUNTER_TYPE ulLastTotal;   /* Run time clock at the end of the last window. */
+    UBaseType_t uxLastTaskNumber;              /* Highest task number seen by the last sample. */
+    uint8_t ucStarted;                         /* Set once the first window has begun. */
+
+    #if ( configCPU_LOAD_ISR_TIME == 1 )
+        uint32_t ulLastCycles;                 /* DWT cycle counter at the end of the last window. */
+        uint32_t ulLastIsrCycles;              /* ulIsrCycles at the end of the last window. */
+        volatile uint32_t ulIsrCycles;         /* Cycles spent in timed interrupt handlers, wraps. */
+        volatile uint32_t ulIsrStart;          /* Cycle count on entry to the outermost handler. */
+        volatile uint32_t ulIsrNesting;        /* Handlers currently running. */
+    #endif
+} CpuLoadState_t;
+
+static CpuLoadState_t xCpuLoad;
+
+/*-----------------------------------------------------------*/
+
+static configRUN_TIME_COUNTER_TYPE prvGetRunTime( void )
+{
+    configRUN_TIME_COUNTER_TYPE ulTime;
+
+    #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+        portALT_GET_RUN_TIME_COUNTER_VALUE( ulTime );
+    #else
+        ulTime = portGET_RUN_TIME_COUNTER_VALUE();
+    #endif
+
+    return ulTime;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * ulPart as a share of ulWhole in 0.01% units.  A task's counter is read a
+ * little after the total, so the result is clamped to 100%.
+ */
+static uint16_t prvShare( uint32_t ulPart,
+                          uint32_t ulWhole )
+{
+    uint64_t ullShare = 0;
+
+    if( ulWhole != 0U )
+    {
+        ullShare = ( ( uint64_t ) ulPart * cpuloadFULL_SCALE ) / ulWhole;
+
+        if( ullShare > cpuloadFULL_SCALE )
+        {
+            ullShare = cpuloadFULL_SCALE;
+        }
+    }
+
+    return ( uint16_t ) ullShare;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Returns the table entry of the task described by pxStatus, taking a free
+ * entry if the task is new.  Returns NULL if the table is full.
+ */
+static CpuLoadEntry_t * prvFindEntry( const TaskStatus_t * pxStatus )
+{
+    CpuLoadEntry_t * pxFree = NULL;
+    UBaseType_t x;
+
+    for( x = 0; x < configCPU_LOAD_MAX_TASKS; x++ )
+    {
+        if( xCpuLoad.xEntries[ x ].xTask.uxTaskNumber == pxStatus->xTaskNumber )
+        {
+            return &( xCpuLoad.xEntries[ x ] );
+        }
+
+        if( ( pxFree == NULL ) && ( xCpuLoad.xEntries[ x ].xTask.uxTaskNumber == 0U ) )
+        {
+            pxFree = &( xCpuLoad.xEntries[ x ] );
+        }
+    }
+
+    if( pxFree != NULL )
+    {
+        pxFree->xTask.xHandle = pxStatus->xHandle;
+        pxFree->xTask.uxTaskNumber = pxStatus->xTaskNumber;
+        pxFree->xTask.usLoad = 0;
+        pxFree->xTask.usPeakLoad = 0;
+        ( void ) strncpy( pxFree->xTask.cName, pxStatus->pcTaskName, configMAX_TASK_NAME_LEN );
+        pxFree->xTask.cName[ configMAX_TASK_NAME_LEN - 1 ] = '\0';
+
+        /* A task created during the window has used nothing before it, but a
+         * task that already existed, and only now found a free entry, has
+         * counted time in earlier windows too. */
+        if( ( xCpuLoad.ucStarted != 0U ) && ( pxStatus->xTaskNumber > xCpuLoad.uxLastTaskNumber ) )
+        {
+            pxFree->ulLastCounter = 0;
+        }
+        else
+        {
+            pxFree->ulLastCounter = pxStatus->ulRunTimeCounter;
+        }
+    }
+
+    return pxFree;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCpuLoadTimerCallback( TimerHandle_t xTimer )
+{
+    ( void ) xTimer;
+
+    vCpuLoadSample();
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xCpuLoadStart( void )
+{
+    BaseType_t xReturn = pdFAIL;
+
+    #if ( configCPU_LOAD_ISR_TIME == 1 )
+        {
+            portENABLE_CYCLE_COUNTER();
+        }
+    #endif
+
+    if( xCpuLoad.xTimer == NULL )
+    {
+        xCpuLoad.xTimer = xTimerCreate( "CpuLoad", pdMS_TO_TICKS( configCPU_LOAD_WINDOW_MS ), pdTRUE, NULL, prvCpuLoadTimerCallback );
+    }
+
+    if( xCpuLoad.xTimer != NULL )
+    {
+        /* Start the first window now rather than at the first expiry. */
+        vCpuLoadSample();
+        xReturn = xTimerStart( xCpuLoad.xTimer, 0 );
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vCpuLoadSample( void )
+{
+    TaskIterator_t xIterator;
+    TaskStatus_t xStatus[ configTASK_STATS_CHUNK_SIZE ];
+    CpuLoadEntry_t * pxEntry;
+    CpuLoad_t xLoad;
+    TaskHandle_t xIdleTask = NULL;
+    configRUN_TIME_COUNTER_TYPE ulTotal, ulWindow;
+    UBaseType_t uxCount, x, uxLastTaskNumber = 0, uxUntracked = 0;
+    uint16_t usIdle = 0;
+
+    #if ( configCPU_LOAD_ISR_TIME == 1 )
+        uint32_t ulCycles, ulIsrCycles;
+    #endif
+
+    /* Read the clocks before the walk.  The walk runs in the timer task at a
+     * high priority, so little else runs until it completes. */
+    ulTotal = prvGetRunTime();
+    ulWindow = ulTotal - xCpuLoad.ulLastTotal;
+
+    #if ( configCPU_LOAD_ISR_TIME == 1 )
+        {
+            ulCycles = DWT->CYCCNT;
+            ulIsrCycles = xCpuLoad.ulIsrCycles;
+        }
+    #endif
+
+    for( x = 0; x < configCPU_LOAD_MAX_TASKS; x++ )
+    {
+        xCpuLoad.xEntries[ x ].ucSeen = 0U;
+    }
+
+    /* Read the run time counters a few tasks at a time, so the scheduler is
+     * never suspended for long however many tasks there are. */
+    vTaskIteratorInit( &xIterator );
+
+    while( ( uxCount = uxTaskIteratorNext( &xIterator, xStatus, configTASK_STATS_CHUNK_SIZE, pdFALSE ) ) > 0U )
+    {
+        for( x = 0; x < uxCount; x++ )
+        {
+            pxEntry = prvFindEntry( &( xStatus[ x ] ) );
+
+            if( pxEntry != NULL )
+            {
+                pxEntry->ulDelta = xStatus[ x ].ulRunTimeCounter - pxEntry->ulLastCounter;
+                pxEntry->ulLastCounter = xStatus[ x ].ulRunTimeCounter;
+                pxEntry->ucSeen = 1U;
+            }
+            else
+            {
+                uxUntracked++;
+            }
+
+            uxLastTaskNumber = xStatus[ x ].xTaskNumber;
+        }
+    }
+
+    if( xCpuLoad.ucStarted != 0U )
+    {
+        xIdleTask = xTaskGetIdleTaskHandle();
+    }
+
+    /* Publish the window in one go so readers never see half of it. */
+    vTaskSuspendAll();
+    {
+        for( x = 0; x < configCPU_LOAD_MAX_TASKS; x++ )
+        {
+            pxEntry = &( xCpuLoad.xEntries[ x ] );
+
+            if( pxEntry->ucSeen == 0U )
+            {
+                /* Deleted, or never used. */
+                pxEntry->xTask.uxTaskNumber = 0;
+            }
+            else if( xCpuLoad.ucStarted != 0U )
+            {
+                pxEntry->xTask.usLoad = prvShare( pxEntry->ulDelta, ulWindow );
+
+                if( pxEntry->xTask.usLoad > pxEntry->xTask.usPeakLoad )
+                {
+                    pxEntry->xTask.usPeakLoad = pxEntry->xTask.usLoad;
+                }
+
+                if( pxEntry->xTask.xHandle == xIdleTask )
+                {
+                    usIdle = pxEntry->xTask.usLoad;
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        if( xCpuLoad.ucStarted != 0U )
+        {
+            xCpuLoad.xLoad.ulWindows++;
+            xCpuLoad.xLoad.usIdle = usIdle;
+            xCpuLoad.xLoad.usCpuLoad = ( uint16_t ) ( cpuloadFULL_SCALE - usIdle );
+            xCpuLoad.xLoad.usUntrackedTasks = ( uint16_t ) uxUntracked;
+
+            if( xCpuLoad.xLoad.usCpuLoad > xCpuLoad.xLoad.usPeakCpuLoad )
+            {
+                xCpuLoad.xLoad.usPeakCpuLoad = xCpuLoad.xLoad.usCpuLoad;
+            }
+
+            #if ( configCPU_LOAD_ISR_TIME == 1 )
+                {
+                    xCpuLoad.xLoad.usIsrLoad = prvShare( ulIsrCycles - xCpuLoad.ulLastIsrCycles, ulCycles - xCpuLoad.ulLastCycles );
+
+                    if( xCpuLoad.xLoad.usIsrLoad > xCpuLoad.xLoad.usPeakIsrLoad )
+                    {
+                        xCpuLoad.xLoad.usPeakIsrLoad = xCpuLoad.xLoad.usIsrLoad;
+                    }
+                }
+            #endif
+        }
+
+        xCpuLoad.ulLastTotal = ulTotal;
+        xCpuLoad.uxLastTaskNumber = uxLastTaskNumber;
+
+        #if ( configCPU_LOAD_ISR_TIME == 1 )
+            {
+                xCpuLoad.ulLastCycles = ulCycles;
+                xCpuLoad.ulLastIsrCycles = ulIsrCycles;
+            }
+        #endif
+
+        xLoad = xCpuLoad.xLoad;
+    }
+    ( void ) xTaskResumeAll();
+
+    #if ( configUSE_CPU_LOAD_HOOK == 1 )
+        {
+            if( xCpuLoad.ucStarted != 0U )
+            {
+                vApplicationCpuLoadHook( &xLoad );
+            }
+        }
+    #else
+        {
+            ( void ) xLoad;
+        }
+    #endif
+
+    xCpuLoad.ucStarted = 1U;
+}
+/*-----------------------------------------------------------*/
+
+void vCpuLoadGet( CpuLoad_t * pxLoad )
+{
+    configASSERT( pxLoad );
+
+    vTaskSuspendAll();
+    {
+        *pxLoad = xCpuLoad.xLoad;
+    }
+    ( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxCpuLoadGetTasks( CpuLoadTask_t * pxTasks,
+                               UBaseType_t uxArraySize )
+{
+    UBaseType_t uxCount = 0, uxAfter = 0, x;
+    const CpuLoadEntry_t * pxNext;
+
+    configASSERT( pxTasks );
+
+    vTaskSuspendAll();
+    {
+        /* Selection by task number, as entries are reused in any order.  The
+         * table is small, so the quadratic time does not matter. */
+        while( uxCount < uxArraySize )
+        {
+            pxNext = NULL;
+
+            for( x = 0; x < configCPU_LOAD_MAX_TASKS; x++ )
+            {
+                if( ( xCpuLoad.xEntries[ x ].xTask.uxTaskNumber > uxAfter ) &&
+                    ( ( pxNext == NULL ) || ( xCpuLoad.xEntries[ x ].xTask.uxTaskNumber < pxNext->xTask.uxTaskNumber ) ) )
+                {
+                    pxNext = &( xCpuLoad.xEntries[ x ] );
+                }
+            }
+
+            if( pxNext == NULL )
+            {
+                break;
+            }
+
+            pxTasks[ uxCount ] = pxNext->xTask;
+            uxAfter = pxNext->xTask.uxTaskNumber;
+            uxCount++;
+        }
+    }
+    ( void ) xTaskResumeAll();
+
+    return uxCount;
+}
+/*-----------------------------------------------------------*/
+
+void vCpuLoadResetPeaks( void )
+{
+    UBaseType_t x;
+
+    vTaskSuspendAll();
+    {
+        for( x = 0; x < configCPU_LOAD_MAX_TASKS; x++ )
+        {
+            xCpuLoad.xEntries[ x ].xTask.usPeakLoad = xCpuLoad.xEntries[ x ].xTask.usLoad;
+        }
+
+        xCpuLoad.xLoad.usPeakCpuLoad = xCpuLoad.xLoad.usCpuLoad;
+        xCpuLoad.xLoad.usPeakIsrLoad = xCpuLoad.xLoad.usIsrLoad;
+    }
+    ( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+#if ( configCPU_LOAD_ISR_TIME == 1 )
+
+    void vCpuLoadISREnter( void )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+
+        /* Only the outermost handler is timed, so nested handlers are not
+         * counted twice. */
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            if( xCpuLoad.ulIsrNesting == 0U )
+            {
+                xCpuLoad.ulIsrStart = DWT->CYCCNT;
+            }
+
+            xCpuLoad.ulIsrNesting++;
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    }
+/*-----------------------------------------------------------*/
+
+    void vCpuLoadISRExit( void )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            if( xCpuLoad.ulIsrNesting > 0U )
+            {
+                xCpuLoad.ulIsrNesting--;
+
+                if( xCpuLoad.ulIsrNesting == 0U )
+                {
+                    xCpuLoad.ulIsrCycles += DWT->CYCCNT - xCpuLoad.ulIsrStart;
+                }
+            }
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    }
+
+#endif /* configCPU_LOAD_ISR_TIME */
+
+#endif /* configUSE_CPU_LOAD */
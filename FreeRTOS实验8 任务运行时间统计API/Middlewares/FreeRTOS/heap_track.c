@@ -0,0 +1,371 @@
+/*
+ * FreeRTOS Kernel V10.4.6
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Heap allocation tracker - see heap_track.h. */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "heap_track.h"
+
+#if ( configUSE_HEAP_TRACKER == 1 )
+
+#if ( INCLUDE_xTaskGetCurrentTaskHandle != 1 )
+    #error INCLUDE_xTaskGetCurrentTaskHandle must be set to 1 in FreeRTOSConfig.h to use the heap tracker.
+#endif
+
+#if ( INCLUDE_xTaskGetSchedulerState != 1 ) && ( configUSE_TIMERS != 1 )
+    #error INCLUDE_xTaskGetSchedulerState must be set to 1 in FreeRTOSConfig.h to use the heap tracker.
+#endif
+
+#if ( configHEAP_TRACK_MAX_TASKS > 254 )
+    #error configHEAP_TRACK_MAX_TASKS must be less than 255.
+#endif
+
+#define heaptrackNO_TASK          ( ( uint8_t ) 0xFFU )                /* ucOwner of a block allocated before the scheduler started. */
+#define heaptrackTABLE_FULL       ( ( uint8_t ) 0xFEU )                /* Returned by prvFindOwner() when the task table is full. */
+#define heaptrackRECORD_LENGTH    ( 64 + configMAX_TASK_NAME_LEN )     /* Longest line written by xHeapTrackDump(). */
+
+/* A block table entry.  A NULL pvAddress marks a free entry. */
+typedef struct HeapTrackBlock
+{
+    void * pvAddress;
+    void * pvCaller;
+    size_t xSize;
+    TickType_t xTime;   /* Tick count when the block was allocated. */
+    uint8_t ucHeap;     /* heaptrackHEAP_xxx. */
+    uint8_t ucOwner;    /* Index into xTasks, or heaptrackNO_TASK. */
+} HeapTrackBlock_t;
+
+/* A task table entry. */
+typedef struct HeapTrackEntry
+{
+    HeapTrackTask_t xTask;
+    uint8_t ucUsed;
+} HeapTrackEntry_t;
+
+/* Only accessed with the scheduler suspended. */
+typedef struct HeapTrackState
+{
+    HeapTrackBlock_t xBlocks[ configHEAP_TRACK_MAX_BLOCKS ];
+    HeapTrackEntry_t xTasks[ configHEAP_TRACK_MAX_TASKS ];
+    HeapTrackStats_t xStats;
+} HeapTrackState_t;
+
+static HeapTrackState_t xHeapTrack;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Returns the index of the task table entry of the calling task, taking an
+ * entry if the task has none yet.  Returns heaptrackNO_TASK before the
+ * scheduler has started, and heaptrackTABLE_FULL if no entry is left.
+ */
+static uint8_t prvFindOwner( void )
+{
+    TaskHandle_t xHandle;
+    HeapTrackEntry_t * pxEntry;
+    UBaseType_t x, uxFree = configHEAP_TRACK_MAX_TASKS, uxReuse = configHEAP_TRACK_MAX_TASKS;
+
+    if( xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED )
+    {
+        return heaptrackNO_TASK;
+    }
+
+    xHandle = xTaskGetCurrentTaskHandle();
+
+    for( x = 0; x < configHEAP_TRACK_MAX_TASKS; x++ )
+    {
+        pxEntry = &( xHeapTrack.xTasks[ x ] );
+
+        if( pxEntry->ucUsed == 0U )
+        {
+            if( uxFree == configHEAP_TRACK_MAX_TASKS )
+            {
+                uxFree = x;
+            }
+        }
+        else if( pxEntry->xTask.xHandle == xHandle )
+        {
+            return ( uint8_t ) x;
+        }
+        else if( ( pxEntry->xTask.xHandle == NULL ) && ( pxEntry->xTask.xCurrentBytes == 0U ) && ( uxReuse == configHEAP_TRACK_MAX_TASKS ) )
+        {
+            /* A deleted task that owns nothing any more. */
+            uxReuse = x;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    /* Keep the figures of deleted tasks for as long as there is room. */
+    if( uxFree == configHEAP_TRACK_MAX_TASKS )
+    {
+        uxFree = uxReuse;
+    }
+
+    if( uxFree == configHEAP_TRACK_MAX_TASKS )
+    {
+        return heaptrackTABLE_FULL;
+    }
+
+    pxEntry = &( xHeapTrack.xTasks[ uxFree ] );
+    pxEntry->xTask.xHandle = xHandle;
+    pxEntry->xTask.xCurrentBytes = 0;
+    pxEntry->xTask.xPeakBytes = 0;
+    pxEntry->xTask.ulAllocations = 0;
+    ( void ) strncpy( pxEntry->xTask.cName, pcTaskGetName( xHandle ), configMAX_TASK_NAME_LEN );
+    pxEntry->xTask.cName[ configMAX_TASK_NAME_LEN - 1 ] = '\0';
+    pxEntry->ucUsed = 1U;
+
+    return ( uint8_t ) uxFree;
+}
+/*-----------------------------------------------------------*/
+
+void vHeapTrackMalloc( uint8_t ucHeap,
+                       void * pvAddress,
+                       size_t xSize,
+                       void * pvCaller )
+{
+    HeapTrackBlock_t * pxBlock = NULL;
+    HeapTrackTask_t * pxTask;
+    UBaseType_t x;
+    uint8_t ucOwner;
+
+    /* traceMALLOC() is also called when an allocation fails. */
+    if( pvAddress == NULL )
+    {
+        return;
+    }
+
+    /* pvPortMalloc() has already suspended the scheduler, mymalloc() has
+     * not. */
+    vTaskSuspendAll();
+    {
+        ucOwner = prvFindOwner();
+
+        for( x = 0; x < configHEAP_TRACK_MAX_BLOCKS; x++ )
+        {
+            if( xHeapTrack.xBlocks[ x ].pvAddress == NULL )
+            {
+                pxBlock = &( xHeapTrack.xBlocks[ x ] );
+                break;
+            }
+        }
+
+        if( ( pxBlock == NULL ) || ( ucOwner == heaptrackTABLE_FULL ) )
+        {
+            xHeapTrack.xStats.ulUntrackedBlocks++;
+        }
+        else
+        {
+            pxBlock->pvAddress = pvAddress;
+            pxBlock->pvCaller = pvCaller;
+            pxBlock->xSize = xSize;
+            pxBlock->xTime = xTaskGetTickCount();
+            pxBlock->ucHeap = ucHeap;
+            pxBlock->ucOwner = ucOwner;
+
+            if( ucOwner != heaptrackNO_TASK )
+            {
+                pxTask = &( xHeapTrack.xTasks[ ucOwner ].xTask );
+                pxTask->xCurrentBytes += xSize;
+                pxTask->ulAllocations++;
+
+                if( pxTask->xCurrentBytes > pxTask->xPeakBytes )
+                {
+                    pxTask->xPeakBytes = pxTask->xCurrentBytes;
+                }
+            }
+
+            xHeapTrack.xStats.uxLiveBlocks++;
+            xHeapTrack.xStats.xLiveBytes += xSize;
+
+            if( xHeapTrack.xStats.uxLiveBlocks > xHeapTrack.xStats.uxPeakLiveBlocks )
+            {
+                xHeapTrack.xStats.uxPeakLiveBlocks = xHeapTrack.xStats.uxLiveBlocks;
+            }
+        }
+    }
+    ( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+void vHeapTrackFree( void * pvAddress )
+{
+    HeapTrackBlock_t * pxBlock;
+    UBaseType_t x;
+
+    if( pvAddress == NULL )
+    {
+        return;
+    }
+
+    vTaskSuspendAll();
+    {
+        for( x = 0; x < configHEAP_TRACK_MAX_BLOCKS; x++ )
+        {
+            pxBlock = &( xHeapTrack.xBlocks[ x ] );
+
+            if( pxBlock->pvAddress == pvAddress )
+            {
+                if( pxBlock->ucOwner != heaptrackNO_TASK )
+                {
+                    xHeapTrack.xTasks[ pxBlock->ucOwner ].xTask.xCurrentBytes -= pxBlock->xSize;
+                }
+
+                xHeapTrack.xStats.uxLiveBlocks--;
+                xHeapTrack.xStats.xLiveBytes -= pxBlock->xSize;
+                pxBlock->pvAddress = NULL;
+                break;
+            }
+        }
+
+        /* A task's TCB is freed last when the task is deleted, so this is the
+         * point at which its handle stops being valid and may be given to a
+         * new task. */
+        for( x = 0; x < configHEAP_TRACK_MAX_TASKS; x++ )
+        {
+            if( ( xHeapTrack.xTasks[ x ].ucUsed != 0U ) && ( xHeapTrack.xTasks[ x ].xTask.xHandle == ( TaskHandle_t ) pvAddress ) )
+            {
+                xHeapTrack.xTasks[ x ].xTask.xHandle = NULL;
+            }
+        }
+    }
+    ( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+void vHeapTrackGetStats( HeapTrackStats_t * pxStats )
+{
+    configASSERT( pxStats );
+
+    vTaskSuspendAll();
+    {
+        *pxStats = xHeapTrack.xStats;
+    }
+    ( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxHeapTrackGetTasks( HeapTrackTask_t * pxTasks,
+                                 UBaseType_t uxArraySize )
+{
+    UBaseType_t uxCount = 0, x;
+
+    configASSERT( pxTasks );
+
+    vTaskSuspendAll();
+    {
+        for( x = 0; ( x < configHEAP_TRACK_MAX_TASKS ) && ( uxCount < uxArraySize ); x++ )
+        {
+            if( xHeapTrack.xTasks[ x ].ucUsed != 0U )
+            {
+                pxTasks[ uxCount ] = xHeapTrack.xTasks[ x ].xTask;
+                uxCount++;
+            }
+        }
+    }
+    ( void ) xTaskResumeAll();
+
+    return uxCount;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xHeapTrackDump( TickType_t xMinAge,
+                           TaskStatsWriteFunction_t pxWrite,
+                           void * pvContext )
+{
+    static const char cHeader[] = "heap,address,size,caller,age_ms,task\r\n";
+    char cRecord[ heaptrackRECORD_LENGTH ];
+    char cOwner[ configMAX_TASK_NAME_LEN ];
+    char cHeap[ 8 ];
+    HeapTrackBlock_t xBlock;
+    TickType_t xAge = 0;
+    UBaseType_t x;
+    size_t xLength;
+    BaseType_t xReturn;
+
+    configASSERT( pxWrite );
+
+    xReturn = pxWrite( cHeader, sizeof( cHeader ) - 1U, pvContext );
+
+    for( x = 0; ( x < configHEAP_TRACK_MAX_BLOCKS ) && ( xReturn != pdFAIL ); x++ )
+    {
+        /* Copy one block, and the name of its owner, at a time so the
+         * scheduler is not suspended while the record is written out. */
+        vTaskSuspendAll();
+        {
+            xBlock = xHeapTrack.xBlocks[ x ];
+
+            if( xBlock.pvAddress != NULL )
+            {
+                xAge = xTaskGetTickCount() - xBlock.xTime;
+
+                if( xBlock.ucOwner != heaptrackNO_TASK )
+                {
+                    ( void ) memcpy( ( void * ) cOwner, ( const void * ) xHeapTrack.xTasks[ xBlock.ucOwner ].xTask.cName, sizeof( cOwner ) );
+                }
+                else
+                {
+                    ( void ) strcpy( cOwner, "-" );
+                }
+            }
+        }
+        ( void ) xTaskResumeAll();
+
+        if( ( xBlock.pvAddress != NULL ) && ( xAge >= xMinAge ) )
+        {
+            if( xBlock.ucHeap == heaptrackHEAP_FREERTOS )
+            {
+                ( void ) strcpy( cHeap, "rtos" );
+            }
+            else
+            {
+                ( void ) sprintf( cHeap, "mem%u", ( unsigned int ) ( xBlock.ucHeap - 1U ) );
+            }
+
+            xLength = ( size_t ) sprintf( cRecord, "%s,0x%08lx,%lu,0x%08lx,%lu,%s\r\n",
+                                          cHeap,
+                                          ( unsigned long ) ( size_t ) xBlock.pvAddress,
+                                          ( unsigned long ) xBlock.xSize,
+                                          ( unsigned long ) ( size_t ) xBlock.pvCaller,
+                                          ( unsigned long ) ( xAge * portTICK_PERIOD_MS ),
+                                          cOwner );
+            xReturn = pxWrite( cRecord, xLength, pvContext );
+        }
+    }
+
+    return xReturn;
+}
+
+#endif /* configUSE_HEAP_TRACKER */
@@ -29,6 +29,9 @@
 /*FreeRTOS*********************************************************************************************/
 #include "FreeRTOS.h"
 #include "task.h"
+#if configUSE_CPU_LOAD
+#include "cpu_load.h"
+#endif
 
 /******************************************************************************************************/
 /*FreeRTOS配置*/
@@ -56,7 +59,7 @@ TaskHandle_t task1_handler;
  */
  
 #define TASK2_PRIO         3
-#define TASK2_STACK_SIZE   128  //128 * 4 Byte
+#define TASK2_STACK_SIZE   320  //320 * 4 Byte, 流式统计函数的局部变量要用掉几百字节的栈, 见task.h
 TaskHandle_t task2_handler;
 
 
@@ -72,6 +75,14 @@ void task1( void * pvParameters )
 }
 
 char task_buff[500];
+
+//流式统计函数的输出回调：每次输出一个任务的记录, 直接通过串口发出
+BaseType_t stats_write( const void * pvData, size_t xLength, void * pvContext )
+{
+    usart_write((const uint8_t *)pvData, (uint16_t)xLength);
+    return pdPASS;
+}
+
 //任务2：用于展示任务运行时间统计相关API函数的使用
 void task2( void * pvParameters )
 {
@@ -85,6 +96,43 @@ void task2( void * pvParameters )
             printf("任务运行时间:\r\n");
             printf("%s\r\n", task_buff);
         }
+        else if (key == KEY1_PRES)
+        {
+            //不申请内存, 每次只挂起调度器读取几个任务, 任务再多也不会写越界
+            printf("任务运行时间(CSV):\r\n");
+            xTaskGetRunTimeStatsStream(stats_write, NULL, tskSTATS_FORMAT_CSV);
+
+            if (xTaskListToBuffer(task_buff, sizeof(task_buff), tskSTATS_FORMAT_CSV) >= sizeof(task_buff))
+            {
+                printf("task_buff太小, 输出被截断\r\n");
+            }
+            printf("任务状态(CSV):\r\n");
+            printf("%s\r\n", task_buff);
+        }
+#if configUSE_CPU_LOAD
+        else if (key == WKUP_PRES)
+        {
+            //最近一个统计窗口的负载, 单位0.01%, 峰值为上次清除以来的最大值
+            CpuLoad_t load;
+            CpuLoadTask_t tasks[8];
+            UBaseType_t i, n;
+
+            vCpuLoadGet(&load);
+            printf("CPU负载:%u.%02u%% 峰值:%u.%02u%% 中断:%u.%02u%%\r\n",
+                   load.usCpuLoad / 100, load.usCpuLoad % 100,
+                   load.usPeakCpuLoad / 100, load.usPeakCpuLoad % 100,
+                   load.usIsrLoad / 100, load.usIsrLoad % 100);
+
+            n = uxCpuLoadGetTasks(tasks, 8);
+            for (i = 0; i < n; i++)
+            {
+                printf("%s\t%u.%02u%%\t峰值%u.%02u%%\r\n", tasks[i].cName,
+                       tasks[i].usLoad / 100, tasks[i].usLoad % 100,
+                       tasks[i].usPeakLoad / 100, tasks[i].usPeakLoad % 100);
+            }
+            vCpuLoadResetPeaks();
+        }
+#endif
         
         vTaskDelay(10);
     }
@@ -113,6 +161,9 @@ void start_task( void * pvParameters )
                );
     
                         
+#if configUSE_CPU_LOAD
+     xCpuLoadStart();       //开始按窗口统计CPU负载
+#endif
      vTaskDelete(NULL);     //删除任务自身
      taskEXIT_CRITICAL();   //退出临界区
                
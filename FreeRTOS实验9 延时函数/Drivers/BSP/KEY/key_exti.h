@@ -0,0 +1,76 @@
+/**
+ ****************************************************************************************************
+ * @file        key_exti.h
+ * @author      正点原子团队(ALIENTEK)
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       按键输入(外部中断 + 事件队列) 驱动代码
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 STM32F103开发板
+ * 在线视频:www.yuanzige.com
+ * 技术论坛:www.openedv.com
+ * 公司网址:www.alientek.com
+ * 购买地址:openedv.taobao.com
+ *
+ * 使用说明
+ * 1, key_exti_init 把 KEY0/KEY1/WKUP 配置为双边沿外部中断, 并创建事件队列和消抖软件定时器,
+ *    用它代替 key_init. 之后不要再调用 key_scan.
+ * 2, 按键的边沿中断只屏蔽本中断线并启动消抖定时器, 定时器每 KEY_EXTI_SCAN_MS 采样一次引脚,
+ *    电平稳定 KEY_EXTI_DEBOUNCE_MS 后才确认按下/松开. 按住不放时产生长按和连发事件.
+ *    所有按键都松开后定时器停止, 中断线重新打开, 没有按键操作时不占用CPU.
+ * 3, 任务调用 key_exti_get 阻塞等待按键事件, 不需要轮询. 事件在软件定时器任务中发送,
+ *    队列满时事件被丢弃.
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __KEY_EXTI_H
+#define __KEY_EXTI_H
+
+#include "./SYSTEM/sys/sys.h"
+#include "./BSP/KEY/key.h"
+
+
+/******************************************************************************************/
+/* 中断按键 定义 */
+
+#define KEY_EN_EXTI                 SYS_SUPPORT_OS      /* 使能(1)/禁止(0) 中断按键驱动, 需要FreeRTOS软件定时器 */
+
+#define KEY_EXTI_SCAN_MS            10                  /* 消抖定时器采样周期, 单位: ms */
+#define KEY_EXTI_DEBOUNCE_MS        20                  /* 电平保持多长时间才确认, 单位: ms */
+#define KEY_EXTI_LONG_MS            1000                /* 按住多长时间产生长按事件, 单位: ms */
+#define KEY_EXTI_REPEAT_MS          200                 /* 长按之后连发事件的间隔, 单位: ms, 0表示不连发 */
+#define KEY_EXTI_QUEUE_LEN          8                   /* 事件队列长度 */
+#define KEY_EXTI_IRQ_PRIO           6                   /* 外部中断抢占优先级, 不能高于configMAX_SYSCALL_INTERRUPT_PRIORITY */
+
+/* 事件类型 */
+#define KEY_EVT_PRESS               1                   /* 按下 */
+#define KEY_EVT_RELEASE             2                   /* 松开 */
+#define KEY_EVT_LONG                3                   /* 长按, 按住 KEY_EXTI_LONG_MS 后产生一次 */
+#define KEY_EVT_REPEAT              4                   /* 连发, 长按之后每 KEY_EXTI_REPEAT_MS 产生一次 */
+
+/******************************************************************************************/
+
+#if KEY_EN_EXTI
+
+#include "FreeRTOS.h"
+
+typedef struct
+{
+    uint8_t key;                    /* 键值, KEY0_PRES / KEY1_PRES / WKUP_PRES */
+    uint8_t type;                   /* 事件类型, KEY_EVT_xxx */
+} _key_event;
+
+uint8_t key_exti_init(void);                                /* 中断按键初始化 */
+uint8_t key_exti_get(_key_event *evt, TickType_t wait);     /* 等待按键事件 */
+
+#endif
+
+#endif
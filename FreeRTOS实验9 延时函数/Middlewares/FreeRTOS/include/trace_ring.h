@@ -0,0 +1,113 @@
+/*
+ * FreeRTOS Kernel V10.4.6
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+
+/*
+ * Lock-free ring buffer and output framing shared by the trace recorder and
+ * the deferred log.
+ *
+ * Both services let any task or interrupt append fixed size slots (trace
+ * records, log words) to a RAM ring, and let one low priority task send them
+ * out later.  A writer claims its slots with LDREX/STREX on the head count, so
+ * writing never disables interrupts and works inside critical sections and
+ * from interrupts above configMAX_SYSCALL_INTERRUPT_PRIORITY.  The reader
+ * frees slots by advancing the tail count.  Head and tail are free running
+ * slot counts; the slot index is the count modulo the ring size.
+ *
+ * Output is sent in frames:
+ *
+ *     0xA5 0x5A tag tag | type | length (2 bytes) | payload | checksum
+ *
+ * where the two tag bytes say which service sent the frame, the checksum is
+ * the low byte of the sum of the type, length and payload bytes, and all
+ * values are little endian.  The sync word and tag let the frames share the
+ * UART with printf() output.
+ *
+ * This header is used by trace_recorder.c and deferred_log.c only.
+ */
+
+#ifndef TRACE_RING_H
+#define TRACE_RING_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include trace_ring.h"
+#endif
+
+/* Bytes a frame adds to its payload: sync word, tag, type, length and
+ * checksum.  The payload starts at offset ringFRAME_PAYLOAD. */
+#define ringFRAME_OVERHEAD    8U
+#define ringFRAME_PAYLOAD     7U
+
+typedef struct TraceRing
+{
+    volatile uint32_t ulHead;      /* Slots reserved so far. */
+    volatile uint32_t ulTail;      /* Slots freed by the reader so far. */
+    volatile uint32_t ulDropped;   /* Reservations refused because the ring was full. */
+} TraceRing_t;
+
+/*
+ * Add ulValue to *pulTarget without masking interrupts and return the old
+ * value.
+ */
+uint32_t ulTraceRingAtomicAdd( volatile uint32_t * pulTarget,
+                               uint32_t ulValue );
+
+/*
+ * Claim ulSlots consecutive slots of a ring of ulSize slots (a power of 2)
+ * and read the DWT cycle counter into *pulTimestamp.  The timestamp is read
+ * between LDREX and STREX, and an interrupt in between makes the STREX fail,
+ * so timestamps always increase in ring order.
+ *
+ * If xDropWhenFull is pdTRUE and the slots are not free, nothing is claimed,
+ * ulDropped is incremented and -1 is returned.  Otherwise the ring is
+ * overwritten.  Returns the index of the first slot.
+ */
+int32_t lTraceRingReserve( TraceRing_t * pxRing,
+                           uint32_t ulSize,
+                           uint32_t ulSlots,
+                           BaseType_t xDropWhenFull,
+                           uint32_t * pulTimestamp );
+
+/*
+ * Wrap the usLength payload bytes already at pucFrame[ ringFRAME_PAYLOAD ] in
+ * a frame of type ucType, tagged with the first two characters of pcTag.
+ * pucFrame must have room for usLength + ringFRAME_OVERHEAD bytes.  Returns
+ * the number of bytes to write out.
+ */
+uint16_t usTraceRingFrame( uint8_t * pucFrame,
+                           const char * pcTag,
+                           uint8_t ucType,
+                           uint16_t usLength );
+
+/*
+ * Store ulValue at pucDest, little endian.
+ */
+void vTraceRingPut32( uint8_t * pucDest,
+                      uint32_t ulValue );
+
+#endif /* TRACE_RING_H */
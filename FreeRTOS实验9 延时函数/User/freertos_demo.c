@@ -72,14 +72,51 @@ void task1( void * pvParameters )
     }
 }
 
+#if configUSE_TASK_LATENCY_STATS
+//打印任务的唤醒延迟和周期抖动, 单位: us
+void print_latency_stats( TaskHandle_t xTask )
+{
+    TaskStatus_t xStatus;
+    TaskLatencyStats_t *pxStats = &xStatus.xLatencyStats;
+
+    vTaskGetInfo(xTask, &xStatus, pdFALSE, eRunning);
+    if (pxStats->ulWakeups == 0)
+    {
+        return;
+    }
+
+    printf("%s: 唤醒%u次, 延迟 最小%uus 平均%uus 最大%uus",
+           xStatus.pcTaskName, pxStats->ulWakeups,
+           pxStats->ulMinLatency / configTASK_LATENCY_COUNTS_PER_US,
+           (uint32_t)(pxStats->ullTotalLatency / pxStats->ulWakeups) / configTASK_LATENCY_COUNTS_PER_US,
+           pxStats->ulMaxLatency / configTASK_LATENCY_COUNTS_PER_US);
+    if (pxStats->ulMaxPeriod != 0)
+    {
+        printf(", 周期抖动%uus", (pxStats->ulMaxPeriod - pxStats->ulMinPeriod) / configTASK_LATENCY_COUNTS_PER_US);
+    }
+    printf("\r\n");
+}
+#endif
+
 //任务2：用于展示绝对延时函数vTaskDelayUntil( )的使用
 void task2( void * pvParameters )
 {
     TickType_t xLastWakeTime;
+#if configUSE_TASK_LATENCY_STATS
+    uint8_t cnt = 0;
+#endif
     xLastWakeTime = xTaskGetTickCount();
     while(1)
     {
         LED1_TOGGLE();   //D2
+#if configUSE_TASK_LATENCY_STATS
+        if (++cnt >= 10) //每5秒打印一次: vTaskDelay的周期包含任务自身的运行时间, vTaskDelayUntil则没有
+        {
+            cnt = 0;
+            print_latency_stats(task1_handler);
+            print_latency_stats(task2_handler);
+        }
+#endif
         vTaskDelayUntil(&xLastWakeTime, 500);
     }
 }
@@ -0,0 +1,110 @@
+/**
+ ****************************************************************************************************
+ * @file        fontconv.c
+ * @author      正点原子团队(ALIENTEK)
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       把 lcdfont.h 的逐列字库转换成逐行字库 lcdfont_row.h
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
+ ****************************************************************************************************
+ * @attention
+ *
+ * lcdfont.h 为"阴码+逐列式+顺向"取模, 显示时需要逐位拆开. 逐行字库每行一个整数, 第 n 位对应
+ * 第 n 列, lcd_show_char 可以直接按行写GRAM. 修改 lcdfont.h 后在仓库根目录重新生成:
+ *
+ *   D="FreeRTOS实验1 任务创建与删除(动态方法)/Drivers/BSP/LCD"
+ *   gcc -I"$D" -o fontconv Tools/fontconv/fontconv.c && ./fontconv > "$D/lcdfont_row.h"
+ *
+ * 然后把生成的 lcdfont_row.h 复制到各个实验的 Drivers/BSP/LCD 目录.
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include "lcdfont.h"
+
+
+/**
+ * @brief       输出一个字库的逐行表
+ * @param       name : 表名
+ * @param       type : 每行的类型(uint8_t/uint16_t)
+ * @param       font : 逐列字库首地址
+ * @param       size : 字体大小
+ * @param       csize: 每个字符占用的字节数
+ */
+static void emit(const char *name, const char *type, const unsigned char *font, int size, int csize)
+{
+    int chr, col, row, t, bit;
+    int cbytes = size / 8 + ((size % 8) ? 1 : 0);
+    uint16_t rows[32];
+
+    printf("/* %d*%d ASCII字符集逐行点阵 */\n", size / 2, size);
+    printf("const %s %s[95][%d] = {\n", type, name, size);
+
+    for (chr = 0; chr < 95; chr++)
+    {
+        const unsigned char *p = font + chr * csize;
+
+        for (row = 0; row < size; row++) rows[row] = 0;
+
+        for (col = 0; col < size / 2; col++)
+        {
+            for (t = 0; t < cbytes; t++)
+            {
+                for (bit = 0; bit < 8 && t * 8 + bit < size; bit++)
+                {
+                    if (p[col * cbytes + t] & (0x80 >> bit))
+                    {
+                        rows[t * 8 + bit] |= 1 << col;
+                    }
+                }
+            }
+        }
+
+        printf("{");
+
+        for (row = 0; row < size; row++)
+        {
+            printf(size / 2 > 8 ? "0x%04X%s" : "0x%02X%s", rows[row], row + 1 < size ? "," : "");
+        }
+
+        printf("},/*\"%c\",%d*/\n", chr + ' ', chr);
+    }
+
+    printf("};\n\n");
+}
+
+int main(void)
+{
+    printf("/**\n"
+           " ****************************************************************************************************\n"
+           " * @file        lcdfont_row.h\n"
+           " * @author      正点原子团队(ALIENTEK)\n"
+           " * @version     V1.0\n"
+           " * @date        2026-10-19\n"
+           " * @brief       逐行ASCII字库, 由 Tools/fontconv 根据 lcdfont.h 生成, 不要手工修改\n"
+           " * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司\n"
+           " ****************************************************************************************************\n"
+           " * @attention\n"
+           " *\n"
+           " * 每个字符 size 行, 每行一个整数, 第 n 位对应第 n 列(1为有效点).\n"
+           " * 宽度不超过8的字体(12/16)每行占1字节, 其余每行占2字节.\n"
+           " *\n"
+           " ****************************************************************************************************\n"
+           " */\n\n"
+           "#ifndef __LCDFONT_ROW_H\n"
+           "#define __LCDFONT_ROW_H\n\n");
+
+    emit("asc2_1206_row", "unsigned char", &asc2_1206[0][0], 12, 12);
+    emit("asc2_1608_row", "unsigned char", &asc2_1608[0][0], 16, 16);
+    emit("asc2_2412_row", "unsigned short", &asc2_2412[0][0], 24, 36);
+    emit("asc2_3216_row", "unsigned short", &asc2_3216[0][0], 32, 64);
+
+    printf("#endif\n");
+    return 0;
+}
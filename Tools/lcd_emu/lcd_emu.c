@@ -0,0 +1,328 @@
+/**
+ ****************************************************************************************************
+ * @file        lcd_emu.c
+ * @author      正点原子团队(ALIENTEK)
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       LCD 控制器主机仿真器(ILI9341 指令集)
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
+ ****************************************************************************************************
+ * @attention
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "lcd_emu.h"
+
+
+lcd_emu_count g_lcd_emu_count;
+uint16_t g_lcd_emu_gram[LCD_EMU_HEIGHT][LCD_EMU_WIDTH];
+
+/* 仿真器状态 */
+static struct
+{
+    uint8_t pin[5];         /* 各引脚电平 */
+    uint16_t bus;           /* 数据线输出 */
+    uint8_t out;            /* 数据线方向, 1 为输出 */
+    uint16_t rdata;         /* RD下降沿锁存的读数据 */
+    uint8_t cmd;            /* 当前命令 */
+    uint8_t param;          /* 当前命令已收到的参数个数 */
+    uint16_t sc, ec;        /* 列地址窗口 */
+    uint16_t sp, ep;        /* 页地址窗口 */
+    uint16_t c, p;          /* GRAM读写指针 */
+    uint8_t madctl;         /* 0x36 扫描方向 */
+    uint32_t rcnt;          /* 当前命令已读出的次数 */
+    uint8_t rbyte[3];       /* 0x2E 读出的 R,G,B 字节 */
+    uint8_t rpos;           /* rbyte 中下一个要读出的字节 */
+} g_emu = {
+    {1, 1, 1, 1, 1},                    /* pin: 各控制线空闲为高 */
+    0, 1, 0,                            /* bus, out, rdata */
+    0, 0,                               /* cmd, param */
+    0, LCD_EMU_WIDTH - 1,               /* sc, ec */
+    0, LCD_EMU_HEIGHT - 1,              /* sp, ep */
+    0, 0,                               /* c, p */
+    0,                                  /* madctl */
+    0, {0, 0, 0}, 0                     /* rcnt, rbyte, rpos */
+};
+
+/**
+ * @brief       逻辑地址(列,页)转换成面板物理坐标
+ * @param       c,p  : 列地址, 页地址
+ * @param       x,y  : 物理坐标
+ * @retval      0, 超出面板; 1, 有效;
+ */
+static int lcd_emu_map(uint16_t c, uint16_t p, uint16_t *x, uint16_t *y)
+{
+    uint16_t a = (g_emu.madctl & 0x20) ? p : c;     /* MV: 行列交换 */
+    uint16_t b = (g_emu.madctl & 0x20) ? c : p;
+
+    if (a >= LCD_EMU_WIDTH || b >= LCD_EMU_HEIGHT) return 0;
+
+    *x = (g_emu.madctl & 0x40) ? LCD_EMU_WIDTH - 1 - a : a;     /* MX: 列地址反向 */
+    *y = (g_emu.madctl & 0x80) ? LCD_EMU_HEIGHT - 1 - b : b;    /* MY: 行地址反向 */
+    return 1;
+}
+
+/**
+ * @brief       GRAM指针前进一个点, 到窗口边界时换行/回绕
+ */
+static void lcd_emu_advance(void)
+{
+    if (++g_emu.c > g_emu.ec)
+    {
+        g_emu.c = g_emu.sc;
+
+        if (++g_emu.p > g_emu.ep)
+        {
+            g_emu.p = g_emu.sp;
+        }
+    }
+}
+
+/**
+ * @brief       处理一次命令写入(RS=0)
+ */
+static void lcd_emu_command(uint16_t cmd)
+{
+    g_lcd_emu_count.cmd++;
+    g_emu.cmd = cmd & 0xFF;
+    g_emu.param = 0;
+    g_emu.rcnt = 0;
+
+    if (g_emu.cmd == 0x2C || g_emu.cmd == 0x2E)    /* 写/读GRAM从窗口起点开始 */
+    {
+        g_emu.c = g_emu.sc;
+        g_emu.p = g_emu.sp;
+        g_emu.rpos = 3;
+    }
+}
+
+/**
+ * @brief       处理一次数据写入(RS=1)
+ */
+static void lcd_emu_data(uint16_t data)
+{
+    uint16_t x, y;
+    uint8_t d = data & 0xFF;
+
+    g_lcd_emu_count.data++;
+
+    switch (g_emu.cmd)
+    {
+        case 0x2A:
+            switch (g_emu.param)
+            {
+                case 0: g_emu.sc = (g_emu.sc & 0x00FF) | (d << 8); break;
+                case 1: g_emu.sc = (g_emu.sc & 0xFF00) | d; break;
+                case 2: g_emu.ec = (g_emu.ec & 0x00FF) | (d << 8); break;
+                case 3: g_emu.ec = (g_emu.ec & 0xFF00) | d; break;
+            }
+            break;
+
+        case 0x2B:
+            switch (g_emu.param)
+            {
+                case 0: g_emu.sp = (g_emu.sp & 0x00FF) | (d << 8); break;
+                case 1: g_emu.sp = (g_emu.sp & 0xFF00) | d; break;
+                case 2: g_emu.ep = (g_emu.ep & 0x00FF) | (d << 8); break;
+                case 3: g_emu.ep = (g_emu.ep & 0xFF00) | d; break;
+            }
+            break;
+
+        case 0x2C:
+        case 0x3C:
+            if (lcd_emu_map(g_emu.c, g_emu.p, &x, &y))
+            {
+                g_lcd_emu_gram[y][x] = data;
+            }
+
+            g_lcd_emu_count.pixel++;
+            lcd_emu_advance();
+            break;
+
+        case 0x36:
+            if (g_emu.param == 0) g_emu.madctl = d;
+            break;
+
+        default:    /* 初始化参数等, 只计数 */
+            break;
+    }
+
+    g_emu.param++;
+}
+
+/**
+ * @brief       准备一次读数据(RD下降沿)
+ */
+static uint16_t lcd_emu_read(void)
+{
+    static const uint8_t id9341[4] = {0x00, 0x00, 0x93, 0x41};
+    uint16_t x, y, pix, val = 0;
+    uint8_t i;
+
+    g_lcd_emu_count.rd++;
+
+    if (g_emu.cmd == 0xD3)
+    {
+        val = (g_emu.rcnt < 4) ? id9341[g_emu.rcnt] : 0;
+    }
+    else if (g_emu.cmd == 0x2E && g_emu.rcnt > 0)   /* 第一次为假读 */
+    {
+        /* 9341 读GRAM按 R,G,B 各8位连续输出, 每次读取取出两个字节 */
+        for (i = 0; i < 2; i++)
+        {
+            if (g_emu.rpos >= 3)
+            {
+                pix = lcd_emu_map(g_emu.c, g_emu.p, &x, &y) ? g_lcd_emu_gram[y][x] : 0;
+                g_emu.rbyte[0] = (pix >> 11) << 3;
+                g_emu.rbyte[1] = ((pix >> 5) & 0x3F) << 2;
+                g_emu.rbyte[2] = (pix & 0x1F) << 3;
+                g_emu.rpos = 0;
+                lcd_emu_advance();
+            }
+
+            val = (val << 8) | g_emu.rbyte[g_emu.rpos++];
+        }
+    }
+
+    g_emu.rcnt++;
+    return val;
+}
+
+/**
+ * @brief       设置引脚电平
+ * @param       pin  : LCD_EMU_PIN_xxx
+ * @param       level: 电平
+ * @retval      无
+ */
+void lcd_emu_pin(uint8_t pin, uint8_t level)
+{
+    uint8_t old = g_emu.pin[pin];
+
+    level = level ? 1 : 0;
+    g_emu.pin[pin] = level;
+    g_lcd_emu_count.gpio++;
+
+    if (pin == LCD_EMU_PIN_CS && old && !level)
+    {
+        g_lcd_emu_count.cs++;
+    }
+
+    if (g_emu.pin[LCD_EMU_PIN_CS])
+    {
+        return;     /* 片选无效, 总线上的动作不影响控制器 */
+    }
+
+    if (pin == LCD_EMU_PIN_WR && !old && level)     /* WR上升沿锁存 */
+    {
+        g_lcd_emu_count.wr++;
+
+        if (!g_emu.out)
+        {
+            return;     /* 数据线为输入, 没有驱动总线 */
+        }
+
+        if (g_emu.pin[LCD_EMU_PIN_RS])
+        {
+            lcd_emu_data(g_emu.bus);
+        }
+        else
+        {
+            lcd_emu_command(g_emu.bus);
+        }
+    }
+    else if (pin == LCD_EMU_PIN_RD && old && !level)    /* RD下降沿输出 */
+    {
+        g_emu.rdata = lcd_emu_read();
+    }
+}
+
+/**
+ * @brief       数据线输出
+ */
+void lcd_emu_data_out(uint16_t data)
+{
+    g_emu.bus = data;
+    g_lcd_emu_count.gpio++;
+}
+
+/**
+ * @brief       数据线输入
+ */
+uint16_t lcd_emu_data_in(void)
+{
+    return g_emu.out ? g_emu.bus : g_emu.rdata;
+}
+
+/**
+ * @brief       切换数据线方向
+ * @param       out  : 1, 输出; 0, 输入;
+ */
+void lcd_emu_data_mode(uint8_t out)
+{
+    g_emu.out = out ? 1 : 0;
+    g_lcd_emu_count.gpio += out ? 2 : 3;    /* CRL, CRH (, ODR) */
+}
+
+/**
+ * @brief       清零总线统计
+ */
+void lcd_emu_count_reset(void)
+{
+    memset(&g_lcd_emu_count, 0, sizeof(g_lcd_emu_count));
+}
+
+/**
+ * @brief       把GRAM保存为PPM图片(面板物理方向)
+ * @param       path : 文件名
+ * @retval      0, 成功; -1, 文件打开失败;
+ */
+int lcd_emu_dump_ppm(const char *path)
+{
+    FILE *f = fopen(path, "wb");
+    uint16_t x, y, pix;
+    uint8_t rgb[3];
+
+    if (f == NULL) return -1;
+
+    fprintf(f, "P6\n%d %d\n255\n", LCD_EMU_WIDTH, LCD_EMU_HEIGHT);
+
+    for (y = 0; y < LCD_EMU_HEIGHT; y++)
+    {
+        for (x = 0; x < LCD_EMU_WIDTH; x++)
+        {
+            pix = g_lcd_emu_gram[y][x];
+            rgb[0] = ((pix >> 11) << 3) | (pix >> 13);
+            rgb[1] = (((pix >> 5) & 0x3F) << 2) | ((pix >> 9) & 0x03);
+            rgb[2] = ((pix & 0x1F) << 3) | ((pix >> 2) & 0x07);
+            fwrite(rgb, 1, 3, f);
+        }
+    }
+
+    fclose(f);
+    return 0;
+}
+
+/**
+ * @brief       GRAM内容的FNV-1a校验值, 用于与标准图比较
+ */
+uint32_t lcd_emu_hash(void)
+{
+    const uint16_t *p = &g_lcd_emu_gram[0][0];
+    uint32_t h = 2166136261u;
+    uint32_t i;
+
+    for (i = 0; i < LCD_EMU_WIDTH * LCD_EMU_HEIGHT; i++)    /* 按低字节,高字节顺序, 与主机字节序无关 */
+    {
+        h = (h ^ (p[i] & 0xFF)) * 16777619u;
+        h = (h ^ (p[i] >> 8)) * 16777619u;
+    }
+
+    return h;
+}
@@ -0,0 +1,76 @@
+/**
+ ****************************************************************************************************
+ * @file        lcd_emu.h
+ * @author      正点原子团队(ALIENTEK)
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       LCD 控制器主机仿真器(ILI9341 指令集)
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
+ ****************************************************************************************************
+ * @attention
+ *
+ * 用 -DLCD_EMU 在 PC 上编译 Drivers/BSP/LCD/lcd.c 时, lcd.h 会包含本文件, LCD_RS/LCD_CS/LCD_WR/
+ * LCD_RD/LCD_DATA_OUT/LCD_DATA_IN 不再操作GPIO, 而是驱动这里的 8080 总线仿真:
+ * WR 上升沿锁存命令(RS=0)或数据(RS=1), RD 下降沿送出读数据. 数据线为输入时 LCD_DATA_OUT
+ * 不驱动总线, 数据线为输出时读到的是自己输出的值, 用于检查驱动的方向切换. 仿真器实现 ILI9341 的
+ * 0x2A/0x2B 地址窗口, 0x2C 写GRAM, 0x2E 读GRAM, 0x36 扫描方向, 0xD3 读ID, 其余命令只计数.
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __LCD_EMU_H
+#define __LCD_EMU_H
+
+#include <stdint.h>
+
+
+#define LCD_EMU_WIDTH       240         /* 面板物理宽度 */
+#define LCD_EMU_HEIGHT      320         /* 面板物理高度 */
+
+/* 引脚编号 */
+#define LCD_EMU_PIN_BL      0
+#define LCD_EMU_PIN_WR      1
+#define LCD_EMU_PIN_RD      2
+#define LCD_EMU_PIN_CS      3
+#define LCD_EMU_PIN_RS      4
+
+/* 总线统计 */
+typedef struct
+{
+    uint32_t gpio;      /* GPIO寄存器写次数(引脚操作 + 数据线输出), 近似CPU开销 */
+    uint32_t wr;        /* WR脉冲数(CS有效) */
+    uint32_t rd;        /* RD脉冲数(CS有效) */
+    uint32_t cmd;       /* 命令数 */
+    uint32_t data;      /* 数据数(含GRAM) */
+    uint32_t pixel;     /* 写入GRAM的点数 */
+    uint32_t cs;        /* CS有效次数 */
+} lcd_emu_count;
+
+extern lcd_emu_count g_lcd_emu_count;
+extern uint16_t g_lcd_emu_gram[LCD_EMU_HEIGHT][LCD_EMU_WIDTH];   /* 面板GRAM, 按物理方向存放 */
+
+
+void lcd_emu_pin(uint8_t pin, uint8_t level);       /* 设置引脚电平 */
+void lcd_emu_data_out(uint16_t data);               /* 数据线输出 */
+uint16_t lcd_emu_data_in(void);                     /* 数据线输入 */
+void lcd_emu_data_mode(uint8_t out);                /* 切换数据线方向 */
+void lcd_emu_count_reset(void);                     /* 清零总线统计 */
+int lcd_emu_dump_ppm(const char *path);             /* 把GRAM保存为PPM图片 */
+uint32_t lcd_emu_hash(void);                        /* GRAM内容的FNV-1a校验值 */
+
+/* 替换 lcd.h 中的引脚操作宏 */
+#define LCD_BL(x)       lcd_emu_pin(LCD_EMU_PIN_BL, (x))
+#define LCD_WR(x)       lcd_emu_pin(LCD_EMU_PIN_WR, (x))
+#define LCD_RD(x)       lcd_emu_pin(LCD_EMU_PIN_RD, (x))
+#define LCD_CS(x)       lcd_emu_pin(LCD_EMU_PIN_CS, (x))
+#define LCD_RS(x)       lcd_emu_pin(LCD_EMU_PIN_RS, (x))
+#define LCD_DATA_OUT(x) lcd_emu_data_out(x)
+#define LCD_DATA_IN     lcd_emu_data_in()
+#define LCD_DATA_MODE_IN()  lcd_emu_data_mode(0)
+#define LCD_DATA_MODE_OUT() lcd_emu_data_mode(1)
+
+#endif
@@ -0,0 +1,320 @@
+/**
+ ****************************************************************************************************
+ * @file        main.c
+ * @author      正点原子团队(ALIENTEK)
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       LCD 驱动主机仿真: 标准图测试与总线开销统计
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
+ ****************************************************************************************************
+ * @attention
+ *
+ * 在本目录执行 make check, 竖屏和横屏的每个场景都与 golden_d0.txt/golden_d1.txt 比较, 有不同时返回非0.
+ * 有意修改了绘图结果(而不只是总线开销)时, 执行 make golden 重新生成标准文件并一起提交.
+ *
+ * 也可以在仓库根目录直接编译(任一实验的 LCD 驱动都相同, 这里用实验1的):
+ *
+ *   D="FreeRTOS实验1 任务创建与删除(动态方法)/Drivers"
+ *   gcc -O2 -DLCD_EMU -ITools/lcd_emu -ITools/lcd_emu/stub -I"$D" -o lcd_emu \
+ *       Tools/lcd_emu/main.c Tools/lcd_emu/lcd_emu.c "$D/BSP/LCD/lcd.c" "$D/BSP/LCD/lcd_comp.c"
+ *
+ * 用法:
+ *   ./lcd_emu [-d 0|1] [-o 目录] [-u 标准文件 | -c 标准文件]
+ *     -d  显示方向, 0 竖屏(默认), 1 横屏
+ *     -o  每个测试场景的结果保存为 <目录>/<场景>.ppm (面板物理方向)
+ *     -u  把每个场景的GRAM校验值写入标准文件
+ *     -c  与标准文件比较, 有不同或缺少校验值时返回1
+ *
+ * 每个场景先清屏(不计入统计), 再执行绘图函数, 输出该函数产生的总线操作次数:
+ * gpio 为GPIO寄存器写次数(近似CPU开销), wr/rd 为总线周期数, cmd/data 为命令和数据数,
+ * pixel 为写入GRAM的点数, cs 为片选次数.
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include "./BSP/LCD/lcd.h"
+#include "./BSP/LCD/lcd_comp.h"
+
+
+static uint16_t g_image[64 * 64];
+static uint16_t g_canvas[120 * 80];
+static uint16_t g_capture[64 * 64];
+static uint32_t g_read_errors;
+
+static void scene_clear(void)
+{
+    lcd_clear(BLUE);
+}
+
+static void scene_fill(void)
+{
+    lcd_fill(20, 30, 199, 129, RED);
+}
+
+static void scene_color_fill(void)
+{
+    lcd_color_fill(40, 40, 103, 103, g_image);
+}
+
+static void scene_point(void)
+{
+    uint16_t i;
+
+    for (i = 0; i < 100; i++)
+    {
+        lcd_draw_point(20 + i * 2, 50 + (i * i) % 200, BLACK);
+    }
+}
+
+static void scene_line(void)
+{
+    lcd_draw_line(0, 0, lcddev.width - 1, lcddev.height - 1, BLACK);
+    lcd_draw_line(lcddev.width - 1, 0, 0, lcddev.height - 1, RED);
+    lcd_draw_line(10, 200, 230, 180, BLUE);
+    lcd_draw_line(120, 10, 130, 300, GREEN);
+}
+
+static void scene_hvline(void)
+{
+    lcd_draw_rectangle(10, 10, lcddev.width - 11, lcddev.height - 11, BLACK);
+    lcd_draw_hline(0, 160, lcddev.width, RED);
+}
+
+static void scene_circle(void)
+{
+    lcd_draw_circle(120, 160, 100, RED);
+    lcd_draw_circle(120, 160, 10, BLUE);
+}
+
+static void scene_fill_circle(void)
+{
+    lcd_fill_circle(120, 160, 80, MAGENTA);
+}
+
+static void scene_string(void)
+{
+    lcd_show_string(10, 10, 220, 12, 12, "STM32F103 FreeRTOS 12", RED);
+    lcd_show_string(10, 30, 220, 16, 16, "STM32 FreeRTOS 16", BLACK);
+    lcd_show_string(10, 50, 220, 24, 24, "FreeRTOS 24", BLUE);
+    lcd_show_string(10, 80, 220, 32, 32, "LCD 32", GREEN);
+}
+
+static void scene_char_mode1(void)
+{
+    lcd_fill(0, 0, 239, 40, YELLOW);
+    lcd_show_char(10, 4, 'A', 32, 1, BLACK);
+    lcd_show_char(30, 4, 'g', 32, 1, RED);
+    lcd_show_xnum(60, 4, 1234, 6, 24, 0X81, BLUE);
+}
+
+static void scene_num(void)
+{
+    lcd_show_num(10, 10, 4294967295u, 10, 16, BLACK);
+    lcd_show_num(10, 40, 42, 5, 24, RED);
+}
+
+static void scene_comp(void)
+{
+    _lcd_comp comp;
+
+    lcd_comp_init(&comp, g_canvas, 60, 100, 120, 80);
+    lcd_comp_fill(&comp, 0, 0, 239, 319, WHITE);
+    lcd_comp_fill(&comp, 70, 110, 120, 150, GREEN);
+    lcd_comp_fill(&comp, 100, 130, 170, 170, BLUE);
+    lcd_comp_show_string(&comp, 64, 104, 110, 16, 16, "canvas", BLACK);
+    lcd_comp_draw_line(&comp, 60, 100, 179, 179, RED);
+    lcd_comp_flush(&comp);
+    lcd_comp_draw_point(&comp, 175, 105, BLACK);    /* 只有一个方块需要刷新 */
+    lcd_comp_flush(&comp);
+}
+
+static void scene_read_point(void)
+{
+    uint16_t i;
+    uint32_t c;
+
+    lcd_color_fill(40, 40, 103, 103, g_image);
+
+    for (i = 0; i < 64; i++)
+    {
+        c = lcd_read_point(40 + i, 40 + i);
+
+        if (c != g_image[i * 64 + i]) g_read_errors++;
+    }
+}
+
+static void scene_read_area(void)
+{
+    uint32_t i;
+
+    lcd_color_fill(40, 40, 103, 103, g_image);
+    lcd_read_area(40, 40, 103, 103, g_capture);
+    lcd_fill(40, 40, 103, 103, WHITE);
+    lcd_color_fill(40, 40, 103, 103, g_capture);    /* 写回, 结果应与 color_fill 场景相同 */
+
+    for (i = 0; i < 64 * 64; i++)
+    {
+        if (g_capture[i] != g_image[i]) g_read_errors++;
+    }
+
+    lcd_read_area(0, 0, 2, 0, g_capture);           /* 奇数个点 */
+
+    for (i = 0; i < 3; i++)
+    {
+        if (g_capture[i] != WHITE) g_read_errors++;
+    }
+}
+
+static const struct
+{
+    const char *name;
+    void (*draw)(void);
+} g_scenes[] =
+{
+    {"clear",       scene_clear},
+    {"fill",        scene_fill},
+    {"color_fill",  scene_color_fill},
+    {"point",       scene_point},
+    {"line",        scene_line},
+    {"hvline",      scene_hvline},
+    {"circle",      scene_circle},
+    {"fill_circle", scene_fill_circle},
+    {"string",      scene_string},
+    {"char_mode1",  scene_char_mode1},
+    {"num",         scene_num},
+    {"comp",        scene_comp},
+    {"read_point",  scene_read_point},
+    {"read_area",   scene_read_area},
+};
+
+#define SCENE_NUM   (sizeof(g_scenes) / sizeof(g_scenes[0]))
+
+/**
+ * @brief       在标准文件中查找场景的校验值
+ * @retval      0, 找到; -1, 未找到;
+ */
+static int golden_lookup(const char *path, uint8_t dir, const char *name, uint32_t *hash)
+{
+    FILE *f = fopen(path, "r");
+    char n[32];
+    unsigned int d, h;
+    int ret = -1;
+
+    if (f == NULL) return -1;
+
+    while (fscanf(f, "%31s %u %x", n, &d, &h) == 3)
+    {
+        if (d == dir && strcmp(n, name) == 0)
+        {
+            *hash = h;
+            ret = 0;
+        }
+    }
+
+    fclose(f);
+    return ret;
+}
+
+int main(int argc, char **argv)
+{
+    const char *outdir = NULL;
+    const char *golden = NULL;
+    uint8_t update = 0, dir = 0;
+    uint32_t i, hash, expect;
+    int fails = 0;
+    FILE *gf = NULL;
+    char path[256];
+
+    for (i = 1; i < (uint32_t)argc; i++)
+    {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < (uint32_t)argc) outdir = argv[++i];
+        else if (strcmp(argv[i], "-u") == 0 && i + 1 < (uint32_t)argc) { golden = argv[++i]; update = 1; }
+        else if (strcmp(argv[i], "-c") == 0 && i + 1 < (uint32_t)argc) golden = argv[++i];
+        else if (strcmp(argv[i], "-d") == 0 && i + 1 < (uint32_t)argc) dir = atoi(argv[++i]) ? 1 : 0;
+        else
+        {
+            fprintf(stderr, "usage: %s [-d 0|1] [-o dir] [-u golden | -c golden]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    for (i = 0; i < 64 * 64; i++)   /* 测试图片: 红绿渐变 + 蓝色对角线 */
+    {
+        g_image[i] = ((i % 64 / 2) << 11) | ((i / 64) << 5) | ((i % 64 == i / 64) ? 0x1F : 0);
+    }
+
+    lcd_init();
+    lcd_display_dir(dir);
+
+    if (golden && update)
+    {
+        gf = fopen(golden, "w");
+
+        if (gf == NULL)
+        {
+            perror(golden);
+            return 2;
+        }
+    }
+
+    printf("%-12s %8s %8s %6s %6s %8s %8s %6s %10s\n", "scene", "gpio", "wr", "rd", "cmd", "data", "pixel", "cs", "hash");
+
+    for (i = 0; i < SCENE_NUM; i++)
+    {
+        lcd_clear(WHITE);
+        lcd_emu_count_reset();
+        g_scenes[i].draw();
+        hash = lcd_emu_hash();
+
+        printf("%-12s %8u %8u %6u %6u %8u %8u %6u   %08x", g_scenes[i].name,
+               g_lcd_emu_count.gpio, g_lcd_emu_count.wr, g_lcd_emu_count.rd, g_lcd_emu_count.cmd,
+               g_lcd_emu_count.data, g_lcd_emu_count.pixel, g_lcd_emu_count.cs, hash);
+
+        if (gf)
+        {
+            fprintf(gf, "%s %u %08x\n", g_scenes[i].name, dir, hash);
+        }
+        else if (golden)
+        {
+            if (golden_lookup(golden, dir, g_scenes[i].name, &expect) != 0)
+            {
+                printf("  (no golden)");
+                fails++;
+            }
+            else if (expect != hash)
+            {
+                printf("  MISMATCH, golden %08x", expect);
+                fails++;
+            }
+        }
+
+        printf("\n");
+
+        if (outdir)
+        {
+            snprintf(path, sizeof(path), "%s/%s.ppm", outdir, g_scenes[i].name);
+
+            if (lcd_emu_dump_ppm(path) != 0)
+            {
+                perror(path);
+            }
+        }
+    }
+
+    if (gf) fclose(gf);
+
+    if (g_read_errors)
+    {
+        printf("read_point/read_area: %u pixels read back wrong\n", g_read_errors);
+        fails++;
+    }
+
+    return fails ? 1 : 0;
+}
@@ -0,0 +1,14 @@
+/**
+ * @file        delay.h
+ * @brief       Tools/lcd_emu 用的 delay.h 替身, 仿真时不需要延时
+ */
+
+#ifndef __DELAY_H
+#define __DELAY_H
+
+#include "./SYSTEM/sys/sys.h"
+
+#define delay_ms(nms)           ((void)(nms))
+#define delay_us(nus)           ((void)(nus))
+
+#endif
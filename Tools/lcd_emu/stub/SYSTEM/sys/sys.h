@@ -0,0 +1,44 @@
+/**
+ * @file        sys.h
+ * @brief       Tools/lcd_emu 用的 sys.h 替身, 只提供 lcd.c 在主机上编译所需的 HAL 定义
+ */
+
+#ifndef __SYS_H
+#define __SYS_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#define SYS_SUPPORT_OS          0
+
+#define GPIO_PIN_5              ((uint16_t)0x0020)
+#define GPIO_PIN_6              ((uint16_t)0x0040)
+#define GPIO_PIN_7              ((uint16_t)0x0080)
+#define GPIO_PIN_8              ((uint16_t)0x0100)
+#define GPIO_PIN_9              ((uint16_t)0x0200)
+#define GPIO_PIN_10             ((uint16_t)0x0400)
+#define GPIO_PIN_All            ((uint16_t)0xFFFF)
+
+#define GPIO_MODE_INPUT         0
+#define GPIO_MODE_OUTPUT_PP     1
+#define GPIO_PULLUP             1
+#define GPIO_SPEED_FREQ_HIGH    3
+
+typedef struct
+{
+    uint32_t Pin;
+    uint32_t Mode;
+    uint32_t Pull;
+    uint32_t Speed;
+} GPIO_InitTypeDef;
+
+#define GPIOB                   ((void *)0)
+#define GPIOC                   ((void *)0)
+
+#define HAL_GPIO_Init(port, init)           ((void)(port), (void)(init))
+#define __HAL_RCC_GPIOB_CLK_ENABLE()        ((void)0)
+#define __HAL_RCC_GPIOC_CLK_ENABLE()        ((void)0)
+#define __HAL_RCC_AFIO_CLK_ENABLE()         ((void)0)
+#define __HAL_AFIO_REMAP_SWJ_NOJTAG()       ((void)0)
+
+#endif
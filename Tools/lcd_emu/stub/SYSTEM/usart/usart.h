@@ -0,0 +1,12 @@
+/**
+ * @file        usart.h
+ * @brief       Tools/lcd_emu 用的 usart.h 替身, printf 直接输出到终端
+ */
+
+#ifndef __USART_H
+#define __USART_H
+
+#include "stdio.h"
+#include "./SYSTEM/sys/sys.h"
+
+#endif
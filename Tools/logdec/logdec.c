@@ -0,0 +1,619 @@
+/**
+ ****************************************************************************************************
+ * @file        logdec.c
+ * @author      正点原子团队(ALIENTEK)
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       deferred_log 二进制日志的解码工具, 根据 .axf 文件里的格式串还原日志文本
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
+ ****************************************************************************************************
+ * @attention
+ *
+ * configDEFERRED_LOG_MODE 为 logMODE_BINARY 时, 板子上的日志任务只发出格式串地址和参数,
+ * 不做任何格式化. 本工具从同一次编译生成的 .axf(ELF) 文件中按地址取出格式串和 %s 参数指向的
+ * 字符串, 在电脑上完成格式化. 输入为串口收到的原始字节(可以混有 printf 输出), 工具只挑出
+ * 校验正确的日志帧. 帧格式和记录格式直接取自 deferred_log.h, 与目标板代码保持一致.
+ * 在仓库根目录编译:
+ *
+ *   D="FreeRTOS实验1 任务创建与删除(动态方法)/Middlewares/FreeRTOS/include"
+ *   gcc -O2 -DINC_FREERTOS_H -I"$D" -o logdec Tools/logdec/logdec.c
+ *
+ * 用法:
+ *
+ *   ./logdec firmware.axf capture.bin
+ *
+ * 每条日志输出一行, 格式与 logMODE_TEXT 在板子上输出的相同:
+ *
+ *   [   12.345678] I: message
+ *
+ * 时间为 DWT 周期计数器启动以来的秒数. 周期计数器约一分钟回绕一次, 工具按记录顺序展开,
+ * 两条日志之间间隔超过一次回绕时时间会不准.
+ *
+ * .axf 必须与抓取日志时运行的程序是同一次编译的结果, 否则格式串地址对不上.
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "deferred_log.h"
+
+
+#define LD_LINE_MAX         1024    /* 一条日志的最大长度 */
+#define LD_SPEC_MAX         32      /* 一个转换说明的最大长度 */
+
+/* ELF 常量, 只用到 32 位小端文件 */
+#define LD_SHT_NOBITS       8
+#define LD_SHF_ALLOC        0x2
+
+/* .axf 中占用地址空间且有内容的段 */
+typedef struct
+{
+    uint32_t addr;
+    uint32_t size;
+    const uint8_t *data;
+} _ld_section;
+
+static uint8_t *g_elf = NULL;
+static _ld_section *g_sections = NULL;
+static uint32_t g_section_num = 0;
+
+static uint32_t g_cpu_hz = 0;
+static uint32_t g_max_args = logMAX_ARGS;
+static uint32_t g_headers = 0;
+static uint32_t g_bad_frames = 0;
+static uint32_t g_bad_records = 0;
+static uint32_t g_messages = 0;
+static uint32_t g_unknown = 0;
+static uint64_t g_dropped = 0;
+
+/* 周期计数器展开为64位 */
+static uint64_t g_ts_base = 0;
+static uint32_t g_ts_last = 0;
+static uint8_t g_ts_valid = 0;
+
+
+/**
+ * @brief       读取小端16/32位数
+ */
+static uint16_t ld_get16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t ld_get32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/**
+ * @brief       读入整个文件
+ * @param       path    : 文件名
+ * @param       len     : 返回文件长度
+ * @retval      文件内容, 失败返回 NULL
+ */
+static uint8_t *ld_read_file(const char *path, size_t *len)
+{
+    uint8_t *buf;
+    long size;
+    FILE *f;
+
+    f = fopen(path, "rb");
+
+    if (f == NULL)
+    {
+        perror(path);
+        return NULL;
+    }
+
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    buf = malloc(size > 0 ? (size_t)size : 1);
+
+    if (buf == NULL || fread(buf, 1, (size_t)size, f) != (size_t)size)
+    {
+        fprintf(stderr, "%s: read failed\n", path);
+        fclose(f);
+        free(buf);
+        return NULL;
+    }
+
+    fclose(f);
+    *len = (size_t)size;
+    return buf;
+}
+
+/**
+ * @brief       读取 .axf 的段表, 记下所有装入内存且有内容的段
+ * @param       path    : .axf 文件名
+ * @retval      0, 成功; 其他, 失败
+ */
+static int ld_load_elf(const char *path)
+{
+    size_t len;
+    uint32_t shoff;
+    uint16_t shentsize;
+    uint16_t shnum;
+    const uint8_t *sh;
+    uint32_t i;
+
+    g_elf = ld_read_file(path, &len);
+
+    if (g_elf == NULL)
+    {
+        return 1;
+    }
+
+    if (len < 52 || memcmp(g_elf, "\x7F" "ELF", 4) != 0 || g_elf[4] != 1 || g_elf[5] != 1)
+    {
+        fprintf(stderr, "%s: not a 32-bit little endian ELF file\n", path);
+        return 1;
+    }
+
+    shoff = ld_get32(g_elf + 0x20);
+    shentsize = ld_get16(g_elf + 0x2E);
+    shnum = ld_get16(g_elf + 0x30);
+
+    if (shentsize < 40 || shoff > len || (size_t)shnum * shentsize > len - shoff)
+    {
+        fprintf(stderr, "%s: bad section header table\n", path);
+        return 1;
+    }
+
+    g_sections = calloc(shnum ? shnum : 1, sizeof(_ld_section));
+
+    if (g_sections == NULL)
+    {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    for (i = 0; i < shnum; i++)
+    {
+        sh = g_elf + shoff + (size_t)i * shentsize;
+
+        if (ld_get32(sh + 4) == 0 || ld_get32(sh + 4) == LD_SHT_NOBITS || (ld_get32(sh + 8) & LD_SHF_ALLOC) == 0)
+        {
+            continue;   /* 不占地址空间, 或者是没有初值的 .bss */
+        }
+
+        if (ld_get32(sh + 16) > len || ld_get32(sh + 20) > len - ld_get32(sh + 16))
+        {
+            continue;
+        }
+
+        g_sections[g_section_num].addr = ld_get32(sh + 12);
+        g_sections[g_section_num].size = ld_get32(sh + 20);
+        g_sections[g_section_num].data = g_elf + ld_get32(sh + 16);
+        g_section_num++;
+    }
+
+    if (g_section_num == 0)
+    {
+        fprintf(stderr, "%s: no loadable sections\n", path);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief       按目标板地址取出 .axf 中的字符串
+ * @param       addr    : 目标板上的地址
+ * @retval      字符串, 地址不在任何段内或字符串没有结束符时返回 NULL
+ */
+static const char *ld_string(uint32_t addr)
+{
+    const _ld_section *s;
+    uint32_t off;
+    uint32_t i;
+
+    for (i = 0; i < g_section_num; i++)
+    {
+        s = &g_sections[i];
+
+        if (addr >= s->addr && addr - s->addr < s->size)
+        {
+            off = addr - s->addr;
+
+            if (memchr(s->data + off, '\0', s->size - off) == NULL)
+            {
+                return NULL;
+            }
+
+            return (const char *)(s->data + off);
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief       追加文本, 超出部分丢弃
+ */
+static void ld_append(char *out, size_t *pos, const char *text)
+{
+    size_t n = strlen(text);
+
+    if (n > LD_LINE_MAX - 1 - *pos)
+    {
+        n = LD_LINE_MAX - 1 - *pos;
+    }
+
+    memcpy(out + *pos, text, n);
+    *pos += n;
+    out[*pos] = '\0';
+}
+
+/**
+ * @brief       按格式串和32位参数生成日志文本, 规则与目标板上的 printf 相同
+ * @note        参数都按32位处理: d i 为有符号数, u o x X 为无符号数, c 为字符, p 为地址,
+ *              s 为 .axf 中的字符串. 不支持的转换原样输出, 缺少的参数输出 <?>
+ * @param       fmt     : 格式串
+ * @param       args    : 参数
+ * @param       nargs   : 参数个数
+ * @param       out     : 输出, LD_LINE_MAX 字节
+ */
+static void ld_format(const char *fmt, const uint32_t *args, uint32_t nargs, char *out)
+{
+    char spec[LD_SPEC_MAX];
+    char text[LD_LINE_MAX];
+    const char *start;
+    const char *str;
+    size_t pos = 0;
+    size_t n;
+    uint32_t next = 0;
+    uint32_t value;
+    char conv;
+
+    out[0] = '\0';
+
+    while (*fmt != '\0')
+    {
+        if (*fmt != '%')
+        {
+            start = fmt;
+
+            while (*fmt != '\0' && *fmt != '%')
+            {
+                fmt++;
+            }
+
+            n = (size_t)(fmt - start) < sizeof(text) - 1 ? (size_t)(fmt - start) : sizeof(text) - 1;
+            memcpy(text, start, n);
+            text[n] = '\0';
+            ld_append(out, &pos, text);
+            continue;
+        }
+
+        /* 转换说明: 标志, 宽度, 精度, 长度, 转换字符. * 宽度和精度从参数中取, 换成数字 */
+        start = fmt++;
+        n = 0;
+        spec[n++] = '%';
+
+        while (*fmt != '\0' && strchr("-+ #0", *fmt) != NULL && n < LD_SPEC_MAX - 16)
+        {
+            spec[n++] = *fmt++;
+        }
+
+        for (value = 0; value < 2; value++)     /* 0: 宽度, 1: 精度 */
+        {
+            if (value == 1)
+            {
+                if (*fmt != '.')
+                {
+                    break;
+                }
+
+                spec[n++] = *fmt++;
+            }
+
+            if (*fmt == '*')
+            {
+                n += (size_t)snprintf(spec + n, LD_SPEC_MAX - n, "%d", next < nargs ? (int32_t)args[next] : 0);
+                next++;
+                fmt++;
+            }
+            else
+            {
+                while (*fmt >= '0' && *fmt <= '9' && n < LD_SPEC_MAX - 8)
+                {
+                    spec[n++] = *fmt++;
+                }
+            }
+        }
+
+        while (*fmt == 'h' || *fmt == 'l' || *fmt == 'z' || *fmt == 't')
+        {
+            fmt++;      /* 目标板上这些长度都是32位 */
+        }
+
+        conv = *fmt;
+
+        if (conv == '\0')
+        {
+            ld_append(out, &pos, start);
+            break;
+        }
+
+        fmt++;
+
+        if (conv == '%')
+        {
+            ld_append(out, &pos, "%");
+            continue;
+        }
+
+        if (strchr("diuoxXcsp", conv) == NULL)
+        {
+            n = (size_t)(fmt - start) < sizeof(text) - 1 ? (size_t)(fmt - start) : sizeof(text) - 1;
+            memcpy(text, start, n);
+            text[n] = '\0';
+            ld_append(out, &pos, text);
+            continue;
+        }
+
+        if (next >= nargs)
+        {
+            ld_append(out, &pos, "<?>");
+            continue;
+        }
+
+        value = args[next++];
+        spec[n++] = (conv == 'i') ? 'd' : conv;
+        spec[n] = '\0';
+
+        switch (conv)
+        {
+            case 'd':
+            case 'i':
+                snprintf(text, sizeof(text), spec, (int)(int32_t)value);
+                break;
+
+            case 'c':
+                snprintf(text, sizeof(text), spec, (int)(uint8_t)value);
+                break;
+
+            case 's':
+                str = ld_string(value);
+
+                if (str != NULL)
+                {
+                    snprintf(text, sizeof(text), spec, str);
+                }
+                else
+                {
+                    snprintf(text, sizeof(text), "<0x%08X>", value);
+                }
+                break;
+
+            case 'p':
+                snprintf(text, sizeof(text), "0x%08x", value);
+                break;
+
+            default:
+                snprintf(text, sizeof(text), spec, (unsigned int)value);
+                break;
+        }
+
+        ld_append(out, &pos, text);
+    }
+}
+
+/**
+ * @brief       周期计数器展开为64位并换算为微秒
+ * @param       ts      : 32位周期数
+ * @retval      微秒数
+ */
+static uint64_t ld_time_us(uint32_t ts)
+{
+    if (g_ts_valid && ts < g_ts_last)
+    {
+        g_ts_base += 1ULL << 32;
+    }
+
+    g_ts_last = ts;
+    g_ts_valid = 1;
+
+    return (g_ts_base + ts) / (g_cpu_hz / 1000000U);
+}
+
+/**
+ * @brief       输出一条日志
+ */
+static void ld_print(uint64_t us, uint32_t level, const char *text)
+{
+    static const char levels[] = "?EWID";
+
+    printf("[%5llu.%06llu] %c: %s\n", (unsigned long long)(us / 1000000U), (unsigned long long)(us % 1000000U),
+           levels[level < sizeof(levels) - 1 ? level : 0], text);
+}
+
+/**
+ * @brief       解析一个记录帧, 其中是若干条完整的日志记录
+ * @param       p       : 负载
+ * @param       len     : 负载长度
+ */
+static void ld_parse_records(const uint8_t *p, uint16_t len)
+{
+    uint32_t words = len / 4;
+    uint32_t args[256];
+    uint32_t header;
+    uint32_t rec;
+    uint32_t i = 0;
+    uint32_t j;
+    uint64_t us;
+    const char *fmt;
+    char line[LD_LINE_MAX];
+
+    while (i < words)
+    {
+        header = ld_get32(p + i * 4);
+        rec = logRECORD_WORDS(header);
+
+        if (rec < 3 || rec > 3 + g_max_args || i + rec > words)
+        {
+            g_bad_records++;
+            return;
+        }
+
+        us = ld_time_us(ld_get32(p + i * 4 + 4));
+        fmt = ld_string(ld_get32(p + i * 4 + 8));
+
+        for (j = 0; j < rec - 3; j++)
+        {
+            args[j] = ld_get32(p + (i + 3 + j) * 4);
+        }
+
+        if (fmt != NULL)
+        {
+            ld_format(fmt, args, rec - 3, line);
+        }
+        else
+        {
+            g_unknown++;    /* .axf 与程序不是同一次编译 */
+            snprintf(line, sizeof(line), "<unknown format 0x%08X>", ld_get32(p + i * 4 + 8));
+
+            for (j = 0; j < rec - 3; j++)
+            {
+                snprintf(line + strlen(line), sizeof(line) - strlen(line), " 0x%08X", args[j]);
+            }
+        }
+
+        ld_print(us, logRECORD_LEVEL(header), line);
+        g_messages++;
+        i += rec;
+    }
+}
+
+/**
+ * @brief       在原始字节流中查找并解析所有日志帧
+ * @param       buf     : 原始数据
+ * @param       len     : 长度
+ */
+static void ld_parse(const uint8_t *buf, size_t len)
+{
+    size_t i = 0;
+    uint16_t plen;
+    uint8_t sum;
+    uint32_t j;
+    const uint8_t *pl;
+    char line[64];
+
+    while (i + 8 <= len)
+    {
+        if (buf[i] != 0xA5 || buf[i + 1] != 0x5A || buf[i + 2] != 'L' || buf[i + 3] != 'G')
+        {
+            i++;            /* printf 输出, trace 帧或者残缺的帧 */
+            continue;
+        }
+
+        plen = ld_get16(buf + i + 5);
+
+        if (i + 8 + plen > len)
+        {
+            break;          /* 文件末尾被截断 */
+        }
+
+        pl = buf + i + 7;
+        sum = buf[i + 4] + buf[i + 5] + buf[i + 6];
+
+        for (j = 0; j < plen; j++)
+        {
+            sum += pl[j];
+        }
+
+        if (sum != pl[plen])
+        {
+            g_bad_frames++;
+            i++;
+            continue;
+        }
+
+        switch (buf[i + 4])
+        {
+            case logFRAME_HEADER:
+                if (plen >= 8 && pl[0] == 1)
+                {
+                    g_max_args = pl[1];
+                    g_cpu_hz = ld_get32(pl + 4);
+                    g_headers++;
+                }
+                else
+                {
+                    fprintf(stderr, "unsupported log format version %u\n", pl[0]);
+                    exit(2);
+                }
+                break;
+
+            case logFRAME_RECORDS:
+                if (g_cpu_hz != 0)
+                {
+                    ld_parse_records(pl, plen);
+                }
+                break;
+
+            case logFRAME_DROPPED:
+                if (plen >= 8 && g_cpu_hz != 0)
+                {
+                    snprintf(line, sizeof(line), "--- %u log messages dropped ---", ld_get32(pl + 4));
+                    ld_print(ld_time_us(ld_get32(pl)), logLEVEL_WARN, line);
+                    g_dropped += ld_get32(pl + 4);
+                }
+                break;
+
+            default:
+                break;
+        }
+
+        i += 8 + (size_t)plen;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    uint8_t *buf;
+    size_t len;
+
+    if (argc != 3)
+    {
+        fprintf(stderr, "usage: %s firmware.axf capture.bin\n", argv[0]);
+        return 2;
+    }
+
+    if (ld_load_elf(argv[1]) != 0)
+    {
+        return 2;
+    }
+
+    buf = ld_read_file(argv[2], &len);
+
+    if (buf == NULL)
+    {
+        return 2;
+    }
+
+    /* 记录帧要用头帧里的主频换算时间, 没有头帧时按默认主频 */
+    ld_parse(buf, len);
+
+    if (g_headers == 0)
+    {
+        g_cpu_hz = 72000000;
+        fprintf(stderr, "warning: no header frame, assuming %u Hz\n", g_cpu_hz);
+        ld_parse(buf, len);
+    }
+
+    free(buf);
+
+    fprintf(stderr, "%u messages, %llu dropped, %u with unknown format, %u bad frames, %u bad records\n",
+            g_messages, (unsigned long long)g_dropped, g_unknown, g_bad_frames, g_bad_records);
+
+    return g_messages ? 0 : 1;
+}
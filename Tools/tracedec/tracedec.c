@@ -0,0 +1,1243 @@
+/**
+ ****************************************************************************************************
+ * @file        tracedec.c
+ * @author      正点原子团队(ALIENTEK)
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       trace_recorder 记录的解码工具, 输出 Perfetto/Chrome JSON 和 CTF, 并统计运行指标
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
+ ****************************************************************************************************
+ * @attention
+ *
+ * 输入为串口收到的原始字节(可以混有 printf 输出), 工具只挑出校验正确的 trace 帧. 事件码,
+ * 帧格式和对象类型直接取自 trace_recorder.h, 与目标板代码保持一致. 在仓库根目录编译:
+ *
+ *   D="FreeRTOS实验1 任务创建与删除(动态方法)/Middlewares/FreeRTOS/include"
+ *   gcc -O2 -DconfigUSE_TRACE_FACILITY=1 -I"$D" -o tracedec Tools/tracedec/tracedec.c
+ *
+ * 用法:
+ *
+ *   ./tracedec [-j trace.json] [-c ctf目录] capture.bin
+ *
+ * -j  输出 Chrome trace event JSON, 可以直接拖进 ui.perfetto.dev 或 chrome://tracing 查看.
+ *     每个任务, 每个中断, 每个队列/流缓冲区/事件组/定时器各占一条轨道, 队列深度和堆用量
+ *     显示为计数器.
+ * -c  输出 CTF 1.8 (metadata + stream), 可以用 babeltrace2 或 Trace Compass 打开.
+ *
+ * 不论是否输出文件, 都会在终端打印:
+ *   任务: 运行时间(已扣除中断时间), CPU占用, 切换次数, 唤醒延迟(就绪到开始运行)
+ *   中断: 次数, 总时间, 最长时间
+ *   对象: 任务在队列/信号量/互斥量/流缓冲区/事件组上阻塞的次数和时间(从切出到就绪)
+ *
+ * 丢失过事件(流模式缓冲区满)时状态跟踪可能出错, 统计结果只作参考.
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <errno.h>
+#include <sys/stat.h>
+#include "trace_recorder.h"
+
+#ifdef _WIN32
+#include <direct.h>
+#define TD_MKDIR(path)      _mkdir(path)
+#else
+#define TD_MKDIR(path)      mkdir(path, 0755)
+#endif
+
+
+/* trace_recorder.h 之外, 解码器自己区分的对象类型 */
+#define TD_OBJ_NONE         0
+#define TD_OBJ_STREAM       4
+#define TD_OBJ_GROUP        5
+#define TD_OBJ_MEM          6
+
+/* 任务状态 */
+#define TD_TASK_UNKNOWN     0
+#define TD_TASK_RUNNING     1
+#define TD_TASK_PREEMPTED   2   /* 被抢占或让出, 仍在就绪列表 */
+#define TD_TASK_BLOCKED     3
+#define TD_TASK_WAKING      4   /* 已就绪, 等待运行, 用于计算唤醒延迟 */
+#define TD_TASK_DELETED     5
+
+#define TD_ISR_NEST         8   /* 中断嵌套最大深度 */
+
+/* Chrome JSON 里的进程号, 每个进程下按对象分轨道 */
+#define TD_PID_TASKS        1
+#define TD_PID_ISRS         2
+#define TD_PID_OBJECTS      3
+#define TD_PID_HEAP         4
+
+/* 解码后的一条事件 */
+typedef struct
+{
+    uint64_t ts;                    /* 展开后的64位时间戳, 单位: CPU周期 */
+    uint32_t param;                 /* trcEVT_PARAM 附带的值 */
+    uint16_t obj;
+    uint8_t evt;
+    uint8_t arg;
+} _td_event;
+
+/* 对象: 任务, 队列, 流缓冲区, 事件组, 定时器 */
+typedef struct
+{
+    uint16_t id;
+    uint8_t kind;                   /* trcOBJ_xxx 或 TD_OBJ_xxx */
+    uint8_t subtype;                /* 队列类型 / 是否消息缓冲区 */
+    uint8_t prio;
+    uint8_t state;                  /* 任务状态 TD_TASK_xxx */
+    uint8_t used;                   /* 已输出轨道名 */
+    char name[32];
+
+    /* 任务 */
+    uint64_t state_ts;              /* 进入当前状态的时间 */
+    int32_t wait_obj;               /* 阻塞所等的对象, -1 表示延时/挂起/通知 */
+    uint8_t wait_pending;           /* 运行中记录到阻塞事件, 切出时生效 */
+    uint64_t run;
+    uint64_t blocked;
+    uint32_t switches;
+    uint32_t wakeups;
+    uint64_t lat_sum;
+    uint64_t lat_max;
+
+    /* 被等待的对象 */
+    uint32_t blocks;
+    uint64_t block_sum;
+    uint64_t block_max;
+} _td_obj;
+
+/* 事件描述 */
+typedef struct
+{
+    uint8_t code;
+    uint8_t kind;                   /* 事件对象的类型 */
+    const char *macro;              /* trcEVT_xxx 宏名 */
+} _td_evt_desc;
+
+#define TD_EVT(code, kind)  { code, kind, #code }
+
+static const _td_evt_desc g_evt_desc[] =
+{
+    TD_EVT(trcEVT_DROPPED,                      TD_OBJ_NONE),
+    TD_EVT(trcEVT_USER,                         TD_OBJ_NONE),
+    TD_EVT(trcEVT_TASK_SWITCHED_IN,             trcOBJ_TASK),
+    TD_EVT(trcEVT_TASK_READY,                   trcOBJ_TASK),
+    TD_EVT(trcEVT_TASK_CREATE,                  trcOBJ_TASK),
+    TD_EVT(trcEVT_TASK_DELETE,                  trcOBJ_TASK),
+    TD_EVT(trcEVT_TASK_DELAY,                   trcOBJ_TASK),
+    TD_EVT(trcEVT_TASK_DELAY_UNTIL,             trcOBJ_TASK),
+    TD_EVT(trcEVT_TASK_SUSPEND,                 trcOBJ_TASK),
+    TD_EVT(trcEVT_TASK_RESUME,                  trcOBJ_TASK),
+    TD_EVT(trcEVT_TASK_RESUME_FROM_ISR,         trcOBJ_TASK),
+    TD_EVT(trcEVT_TASK_PRIORITY_SET,            trcOBJ_TASK),
+    TD_EVT(trcEVT_TASK_PRIORITY_INHERIT,        trcOBJ_TASK),
+    TD_EVT(trcEVT_TASK_PRIORITY_DISINHERIT,     trcOBJ_TASK),
+    TD_EVT(trcEVT_TASK_NOTIFY,                  trcOBJ_TASK),
+    TD_EVT(trcEVT_TASK_NOTIFY_FROM_ISR,         trcOBJ_TASK),
+    TD_EVT(trcEVT_TASK_NOTIFY_WAIT_BLOCK,       trcOBJ_TASK),
+    TD_EVT(trcEVT_TICK,                         TD_OBJ_NONE),
+    TD_EVT(trcEVT_ISR_ENTER,                    TD_OBJ_NONE),
+    TD_EVT(trcEVT_ISR_EXIT,                     TD_OBJ_NONE),
+    TD_EVT(trcEVT_QUEUE_CREATE,                 trcOBJ_QUEUE),
+    TD_EVT(trcEVT_QUEUE_DELETE,                 trcOBJ_QUEUE),
+    TD_EVT(trcEVT_QUEUE_SEND,                   trcOBJ_QUEUE),
+    TD_EVT(trcEVT_QUEUE_SEND_FAILED,            trcOBJ_QUEUE),
+    TD_EVT(trcEVT_QUEUE_SEND_FROM_ISR,          trcOBJ_QUEUE),
+    TD_EVT(trcEVT_QUEUE_SEND_FROM_ISR_FAILED,   trcOBJ_QUEUE),
+    TD_EVT(trcEVT_QUEUE_RECEIVE,                trcOBJ_QUEUE),
+    TD_EVT(trcEVT_QUEUE_RECEIVE_FAILED,         trcOBJ_QUEUE),
+    TD_EVT(trcEVT_QUEUE_RECEIVE_FROM_ISR,       trcOBJ_QUEUE),
+    TD_EVT(trcEVT_QUEUE_RECEIVE_FROM_ISR_FAILED, trcOBJ_QUEUE),
+    TD_EVT(trcEVT_QUEUE_PEEK,                   trcOBJ_QUEUE),
+    TD_EVT(trcEVT_QUEUE_BLOCK_SEND,             trcOBJ_QUEUE),
+    TD_EVT(trcEVT_QUEUE_BLOCK_RECEIVE,          trcOBJ_QUEUE),
+    TD_EVT(trcEVT_STREAM_CREATE,                TD_OBJ_STREAM),
+    TD_EVT(trcEVT_STREAM_DELETE,                TD_OBJ_STREAM),
+    TD_EVT(trcEVT_STREAM_SEND,                  TD_OBJ_STREAM),
+    TD_EVT(trcEVT_STREAM_SEND_FROM_ISR,         TD_OBJ_STREAM),
+    TD_EVT(trcEVT_STREAM_RECEIVE,               TD_OBJ_STREAM),
+    TD_EVT(trcEVT_STREAM_RECEIVE_FROM_ISR,      TD_OBJ_STREAM),
+    TD_EVT(trcEVT_STREAM_BLOCK_SEND,            TD_OBJ_STREAM),
+    TD_EVT(trcEVT_STREAM_BLOCK_RECEIVE,         TD_OBJ_STREAM),
+    TD_EVT(trcEVT_EVENT_GROUP_CREATE,           TD_OBJ_GROUP),
+    TD_EVT(trcEVT_EVENT_GROUP_DELETE,           TD_OBJ_GROUP),
+    TD_EVT(trcEVT_EVENT_GROUP_SET_BITS,         TD_OBJ_GROUP),
+    TD_EVT(trcEVT_EVENT_GROUP_SET_BITS_FROM_ISR, TD_OBJ_GROUP),
+    TD_EVT(trcEVT_EVENT_GROUP_CLEAR_BITS,       TD_OBJ_GROUP),
+    TD_EVT(trcEVT_EVENT_GROUP_WAIT_BLOCK,       TD_OBJ_GROUP),
+    TD_EVT(trcEVT_EVENT_GROUP_SYNC_BLOCK,       TD_OBJ_GROUP),
+    TD_EVT(trcEVT_TIMER_CREATE,                 trcOBJ_TIMER),
+    TD_EVT(trcEVT_TIMER_EXPIRED,                trcOBJ_TIMER),
+    TD_EVT(trcEVT_MALLOC,                       TD_OBJ_MEM),
+    TD_EVT(trcEVT_FREE,                         TD_OBJ_MEM),
+};
+
+#define TD_EVT_NUM          (sizeof(g_evt_desc) / sizeof(g_evt_desc[0]))
+
+/* STM32F103xE 中断名, 下标为 IRQn */
+static const char *const g_irq_name[] =
+{
+    "WWDG", "PVD", "TAMPER", "RTC", "FLASH", "RCC", "EXTI0", "EXTI1", "EXTI2", "EXTI3", "EXTI4",
+    "DMA1_Channel1", "DMA1_Channel2", "DMA1_Channel3", "DMA1_Channel4", "DMA1_Channel5", "DMA1_Channel6",
+    "DMA1_Channel7", "ADC1_2", "USB_HP_CAN1_TX", "USB_LP_CAN1_RX0", "CAN1_RX1", "CAN1_SCE", "EXTI9_5",
+    "TIM1_BRK", "TIM1_UP", "TIM1_TRG_COM", "TIM1_CC", "TIM2", "TIM3", "TIM4", "I2C1_EV", "I2C1_ER",
+    "I2C2_EV", "I2C2_ER", "SPI1", "SPI2", "USART1", "USART2", "USART3", "EXTI15_10", "RTC_Alarm",
+    "USBWakeUp", "TIM8_BRK", "TIM8_UP", "TIM8_TRG_COM", "TIM8_CC", "ADC3", "FSMC", "SDIO", "TIM5",
+    "SPI3", "UART4", "UART5", "TIM6", "TIM7", "DMA2_Channel1", "DMA2_Channel2", "DMA2_Channel3",
+    "DMA2_Channel4_5",
+};
+
+static const char *const g_kind_name[] = {"-", "task", "queue", "timer", "stream", "group", "mem"};
+static const char *const g_queue_type[] = {"queue", "mutex", "counting", "binary", "rmutex"};
+
+static const _td_evt_desc *g_evt_index[256];
+static char g_evt_name[256][40];
+
+/* 解码结果 */
+static _td_event *g_events = NULL;
+static size_t g_event_num = 0;
+static size_t g_event_cap = 0;
+
+static _td_obj *g_objs = NULL;
+static size_t g_obj_num = 0;
+static size_t g_obj_cap = 0;
+static int32_t g_obj_index[65536];
+
+static uint32_t g_cpu_hz = 0;
+static uint32_t g_tick_hz = 0;
+static uint32_t g_mode = 0;
+static uint32_t g_ring = 0;
+static uint32_t g_headers = 0;
+static uint32_t g_bad_frames = 0;
+static uint64_t g_dropped = 0;
+
+/* 中断统计, 下标为异常号 */
+static uint32_t g_isr_count[256];
+static uint64_t g_isr_sum[256];
+static uint64_t g_isr_max[256];
+
+static FILE *g_json = NULL;
+static uint8_t g_json_first = 1;
+static uint64_t g_ts0 = 0;
+
+
+/**
+ * @brief       读取小端16/32位数
+ */
+static uint16_t td_get16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t td_get32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/**
+ * @brief       建立事件码索引, 事件名取宏名去掉 trcEVT_ 前缀后转小写
+ */
+static void td_evt_init(void)
+{
+    uint32_t i, j;
+    const char *s;
+
+    for (i = 0; i < TD_EVT_NUM; i++)
+    {
+        g_evt_index[g_evt_desc[i].code] = &g_evt_desc[i];
+        s = g_evt_desc[i].macro + strlen("trcEVT_");
+
+        for (j = 0; s[j] != '\0' && j < sizeof(g_evt_name[0]) - 1; j++)
+        {
+            g_evt_name[g_evt_desc[i].code][j] = (char)tolower((unsigned char)s[j]);
+        }
+    }
+
+    for (i = 0; i < 256; i++)
+    {
+        if (g_evt_index[i] == NULL)
+        {
+            snprintf(g_evt_name[i], sizeof(g_evt_name[i]), "event_0x%02x", i);
+        }
+    }
+}
+
+/**
+ * @brief       查找对象, 不存在时新建
+ * @param       id      : 对象编号
+ * @param       kind    : 已知的对象类型, TD_OBJ_NONE 表示不确定
+ * @retval      对象在 g_objs 中的下标
+ */
+static int32_t td_obj(uint16_t id, uint8_t kind)
+{
+    _td_obj *o;
+
+    if (g_obj_index[id] < 0)
+    {
+        if (g_obj_num == g_obj_cap)
+        {
+            g_obj_cap = g_obj_cap ? g_obj_cap * 2 : 64;
+            g_objs = realloc(g_objs, g_obj_cap * sizeof(_td_obj));
+
+            if (g_objs == NULL)
+            {
+                perror("realloc");
+                exit(2);
+            }
+        }
+
+        o = &g_objs[g_obj_num];
+        memset(o, 0, sizeof(*o));
+        o->id = id;
+        o->wait_obj = -1;
+        g_obj_index[id] = (int32_t)g_obj_num++;
+    }
+
+    o = &g_objs[g_obj_index[id]];
+
+    if (o->kind == TD_OBJ_NONE && kind != TD_OBJ_NONE)
+    {
+        o->kind = kind;
+    }
+
+    if (o->name[0] == '\0' && o->kind != TD_OBJ_NONE)
+    {
+        snprintf(o->name, sizeof(o->name), "%s_%04x", g_kind_name[o->kind], id);
+    }
+
+    return g_obj_index[id];
+}
+
+/**
+ * @brief       追加一条事件
+ */
+static _td_event *td_event_add(void)
+{
+    if (g_event_num == g_event_cap)
+    {
+        g_event_cap = g_event_cap ? g_event_cap * 2 : 4096;
+        g_events = realloc(g_events, g_event_cap * sizeof(_td_event));
+
+        if (g_events == NULL)
+        {
+            perror("realloc");
+            exit(2);
+        }
+    }
+
+    memset(&g_events[g_event_num], 0, sizeof(_td_event));
+    return &g_events[g_event_num++];
+}
+
+/**
+ * @brief       解析一个事件帧
+ * @note        时间戳为32位 DWT 周期数, 记录按槽位顺序有序, 变小说明计数器回绕.
+ *              trcEVT_PARAM 紧跟在它所属的事件后面, 可能落在下一帧.
+ *              trcEVT_DROPPED 由发送任务直接发出, 时间戳比缓冲区里还没发出的记录新, 不参与回绕判断.
+ */
+static void td_parse_events(const uint8_t *p, uint16_t len)
+{
+    static uint32_t last = 0;
+    static uint64_t high = 0;
+    static uint8_t param_ok = 0;
+    _td_event *e;
+    uint32_t ts;
+    uint8_t evt;
+
+    for (; len >= 8; p += 8, len -= 8)
+    {
+        ts = td_get32(p);
+        evt = p[4];
+
+        if (evt == trcEVT_NONE)
+        {
+            param_ok = 0;
+            continue;
+        }
+
+        if (evt == trcEVT_PARAM)
+        {
+            if (param_ok)
+            {
+                g_events[g_event_num - 1].param = ts;
+                param_ok = 0;
+            }
+
+            continue;
+        }
+
+        e = td_event_add();
+        e->evt = evt;
+        e->arg = p[5];
+        e->obj = td_get16(p + 6);
+
+        if (evt == trcEVT_DROPPED)
+        {
+            e->ts = high | ts;
+        }
+        else
+        {
+            if (g_event_num > 1 && ts < last)
+            {
+                high += (uint64_t)1 << 32;
+            }
+
+            last = ts;
+            e->ts = high | ts;
+        }
+
+        param_ok = 1;
+    }
+}
+
+/**
+ * @brief       在原始字节流中查找并解析所有 trace 帧
+ * @param       buf     : 原始数据
+ * @param       len     : 长度
+ */
+static void td_parse(const uint8_t *buf, size_t len)
+{
+    size_t i = 0;
+    uint16_t plen;
+    uint8_t sum;
+    uint32_t j;
+    const uint8_t *pl;
+    int32_t idx;
+    _td_obj *o;
+
+    while (i + 8 <= len)
+    {
+        if (buf[i] != 0xA5 || buf[i + 1] != 0x5A || buf[i + 2] != 'T' || buf[i + 3] != 'R')
+        {
+            i++;            /* printf 输出或者残缺的帧 */
+            continue;
+        }
+
+        plen = td_get16(buf + i + 5);
+
+        if (i + 8 + plen > len)
+        {
+            break;          /* 文件末尾被截断 */
+        }
+
+        pl = buf + i + 7;
+        sum = buf[i + 4] + buf[i + 5] + buf[i + 6];
+
+        for (j = 0; j < plen; j++)
+        {
+            sum += pl[j];
+        }
+
+        if (sum != pl[plen])
+        {
+            g_bad_frames++;
+            i++;
+            continue;
+        }
+
+        switch (buf[i + 4])
+        {
+            case trcFRAME_HEADER:
+                if (plen >= 20 && pl[0] == 1 && pl[1] == 8)
+                {
+                    g_mode = pl[2];
+                    g_cpu_hz = td_get32(pl + 4);
+                    g_tick_hz = td_get32(pl + 8);
+                    g_ring = td_get32(pl + 16);
+                    g_headers++;
+                }
+                else
+                {
+                    fprintf(stderr, "unsupported trace format version %u, record size %u\n", pl[0], pl[1]);
+                    exit(2);
+                }
+                break;
+
+            case trcFRAME_SYMBOL:
+                if (plen >= 4)
+                {
+                    idx = td_obj(td_get16(pl), pl[2]);
+                    o = &g_objs[idx];
+                    o->kind = pl[2];
+                    o->prio = pl[3];
+                    j = ((size_t)plen - 4 < sizeof(o->name) - 1) ? (uint32_t)plen - 4 : (uint32_t)sizeof(o->name) - 1;
+                    memcpy(o->name, pl + 4, j);
+                    o->name[j] = '\0';
+                }
+                break;
+
+            case trcFRAME_EVENTS:
+                td_parse_events(pl, plen);
+                break;
+
+            default:
+                break;
+        }
+
+        i += 8 + (size_t)plen;
+    }
+}
+
+/**
+ * @brief       周期数转微秒
+ */
+static double td_us(uint64_t cyc)
+{
+    return (double)cyc * 1e6 / (double)g_cpu_hz;
+}
+
+/**
+ * @brief       异常号对应的名字
+ */
+static const char *td_isr_name(uint32_t exc)
+{
+    static char name[16];
+
+    if (exc >= 16 && exc - 16 < sizeof(g_irq_name) / sizeof(g_irq_name[0])) return g_irq_name[exc - 16];
+
+    switch (exc)
+    {
+        case 11: return "SVCall";
+        case 14: return "PendSV";
+        case 15: return "SysTick";
+        default: break;
+    }
+
+    snprintf(name, sizeof(name), "exception_%u", exc);
+    return name;
+}
+
+/**
+ * @brief       输出一个 JSON 字符串, 转义引号和控制字符
+ */
+static void td_json_str(const char *s)
+{
+    fputc('"', g_json);
+
+    for (; *s; s++)
+    {
+        if (*s == '"' || *s == '\\') fprintf(g_json, "\\%c", *s);
+        else if ((unsigned char)*s < 0x20) fprintf(g_json, "\\u%04x", (unsigned char)*s);
+        else fputc(*s, g_json);
+    }
+
+    fputc('"', g_json);
+}
+
+/**
+ * @brief       开始一个 JSON 事件, 后面由调用者补充字段并以 "}" 结束
+ */
+static void td_json_begin(const char *name, char ph, uint32_t pid, uint32_t tid, uint64_t ts)
+{
+    fprintf(g_json, "%s\n{\"name\":", g_json_first ? "" : ",");
+    g_json_first = 0;
+    td_json_str(name);
+    fprintf(g_json, ",\"ph\":\"%c\",\"pid\":%u,\"tid\":%u,\"ts\":%.3f", ph, pid, tid, td_us(ts - g_ts0));
+}
+
+/**
+ * @brief       输出一段时间片 (ph = "X")
+ */
+static void td_json_slice(const char *name, uint32_t pid, uint32_t tid, uint64_t t0, uint64_t t1, const char *args)
+{
+    if (g_json == NULL || t1 < t0) return;
+
+    td_json_begin(name, 'X', pid, tid, t0);
+    fprintf(g_json, ",\"dur\":%.3f", td_us(t1 - t0));
+
+    if (args) fprintf(g_json, ",\"args\":{%s}", args);
+
+    fputc('}', g_json);
+}
+
+/**
+ * @brief       输出一个瞬时事件 (ph = "i")
+ */
+static void td_json_instant(const char *name, uint32_t pid, uint32_t tid, uint64_t ts, const char *args)
+{
+    if (g_json == NULL) return;
+
+    td_json_begin(name, 'i', pid, tid, ts);
+    fprintf(g_json, ",\"s\":\"%c\"", pid ? 't' : 'g');
+
+    if (args) fprintf(g_json, ",\"args\":{%s}", args);
+
+    fputc('}', g_json);
+}
+
+/**
+ * @brief       输出计数器 (ph = "C")
+ */
+static void td_json_counter(const char *name, uint32_t pid, uint64_t ts, const char *key, int64_t value)
+{
+    if (g_json == NULL) return;
+
+    td_json_begin(name, 'C', pid, 0, ts);
+    fprintf(g_json, ",\"args\":{\"%s\":%lld}}", key, (long long)value);
+}
+
+/**
+ * @brief       输出进程名或轨道名 (ph = "M")
+ */
+static void td_json_meta(const char *what, uint32_t pid, uint32_t tid, const char *name)
+{
+    if (g_json == NULL) return;
+
+    fprintf(g_json, "%s\n{\"name\":\"%s\",\"ph\":\"M\",\"pid\":%u,\"tid\":%u,\"args\":{\"name\":", g_json_first ? "" : ",", what, pid, tid);
+    g_json_first = 0;
+    td_json_str(name);
+    fputs("}}", g_json);
+}
+
+/**
+ * @brief       任务离开当前状态, 输出上一个状态的时间片并累计统计
+ * @param       t       : 任务
+ * @param       ts      : 当前时间
+ * @param       state   : 新状态
+ */
+static void td_task_state(_td_obj *t, uint64_t ts, uint8_t state)
+{
+    _td_obj *w;
+    uint64_t d = ts - t->state_ts;
+    char args[64];
+
+    switch (t->state)
+    {
+        case TD_TASK_BLOCKED:
+            t->blocked += d;
+
+            if (t->wait_obj >= 0)
+            {
+                w = &g_objs[t->wait_obj];
+                w->blocks++;
+                w->block_sum += d;
+
+                if (d > w->block_max) w->block_max = d;
+
+                snprintf(args, sizeof(args), "\"on\":\"%s\"", w->name);
+                td_json_slice("Blocked", TD_PID_TASKS, t->id, t->state_ts, ts, args);
+            }
+            else
+            {
+                td_json_slice("Blocked", TD_PID_TASKS, t->id, t->state_ts, ts, NULL);
+            }
+            break;
+
+        case TD_TASK_WAKING:
+            if (state == TD_TASK_RUNNING)
+            {
+                t->wakeups++;
+                t->lat_sum += d;
+
+                if (d > t->lat_max) t->lat_max = d;
+            }
+
+            td_json_slice("Ready", TD_PID_TASKS, t->id, t->state_ts, ts, NULL);
+            break;
+
+        case TD_TASK_PREEMPTED:
+            td_json_slice("Preempted", TD_PID_TASKS, t->id, t->state_ts, ts, NULL);
+            break;
+
+        default:
+            break;
+    }
+
+    t->state = state;
+    t->state_ts = ts;
+    t->used = 1;
+}
+
+/**
+ * @brief       按顺序回放所有事件, 跟踪任务和中断状态, 同时输出 JSON
+ */
+static void td_replay(void)
+{
+    size_t i;
+    _td_event *e;
+    _td_obj *o, *cur = NULL;
+    const _td_evt_desc *d;
+    uint64_t run_ts = 0, isr_in_run = 0;
+    uint64_t isr_ts[TD_ISR_NEST];
+    uint8_t isr_exc[TD_ISR_NEST];
+    uint32_t depth = 0;
+    uint32_t pid, tid;
+    int64_t heap = 0;
+    uint8_t isr_used[256] = {0};
+    int32_t items;
+    char args[96];
+    uint64_t t;
+
+    /* 先建好所有对象, 回放过程中 g_objs 不再重新分配 */
+    for (i = 0; i < g_event_num; i++)
+    {
+        d = g_evt_index[g_events[i].evt];
+
+        if (g_events[i].obj != 0 && d != NULL && d->kind != TD_OBJ_NONE && d->kind != TD_OBJ_MEM)
+        {
+            td_obj(g_events[i].obj, d->kind);
+        }
+    }
+
+    for (i = 0; i < g_event_num; i++)
+    {
+        e = &g_events[i];
+        d = g_evt_index[e->evt];
+        o = NULL;
+
+        if (e->obj != 0 && d != NULL && d->kind != TD_OBJ_NONE && d->kind != TD_OBJ_MEM)
+        {
+            o = &g_objs[g_obj_index[e->obj]];
+        }
+        else if (d != NULL && d->kind == trcOBJ_TASK)
+        {
+            continue;   /* 任务事件必须带任务 */
+        }
+
+        /* 事件发生在哪条轨道上: 中断里, 或者当前运行的任务 */
+        if (depth > 0)
+        {
+            pid = TD_PID_ISRS;
+            tid = isr_exc[depth - 1];
+        }
+        else
+        {
+            pid = TD_PID_TASKS;
+            tid = cur ? cur->id : 0;
+        }
+
+        switch (e->evt)
+        {
+            case trcEVT_TASK_SWITCHED_IN:
+                if (cur)
+                {
+                    snprintf(args, sizeof(args), "\"prio\":%u", cur->prio);
+                    td_json_slice("Running", TD_PID_TASKS, cur->id, run_ts, e->ts, args);
+                    cur->run += e->ts - run_ts - isr_in_run;
+
+                    if (cur->state == TD_TASK_RUNNING)
+                    {
+                        td_task_state(cur, e->ts, cur->wait_pending ? TD_TASK_BLOCKED : TD_TASK_PREEMPTED);
+                    }
+
+                    cur->wait_pending = 0;
+                }
+
+                cur = o;
+                o->prio = e->arg;
+                o->switches++;
+                td_task_state(o, e->ts, TD_TASK_RUNNING);
+                run_ts = e->ts;
+                isr_in_run = 0;
+                break;
+
+            case trcEVT_TASK_READY:
+                if (o->state == TD_TASK_BLOCKED)
+                {
+                    td_task_state(o, e->ts, TD_TASK_WAKING);
+                }
+                else if (o == cur)
+                {
+                    o->wait_pending = 0;    /* 阻塞之前就被唤醒了 */
+                }
+                break;
+
+            case trcEVT_TASK_DELETE:
+                td_task_state(o, e->ts, TD_TASK_DELETED);
+                break;
+
+            case trcEVT_TASK_DELAY:
+            case trcEVT_TASK_DELAY_UNTIL:
+            case trcEVT_TASK_NOTIFY_WAIT_BLOCK:
+            case trcEVT_TASK_SUSPEND:
+                if (o == cur)
+                {
+                    cur->wait_pending = 1;
+                    cur->wait_obj = -1;
+                }
+                else if (e->evt == trcEVT_TASK_SUSPEND && o->state != TD_TASK_DELETED)
+                {
+                    td_task_state(o, e->ts, TD_TASK_BLOCKED);
+                    o->wait_obj = -1;
+                }
+                break;
+
+            case trcEVT_QUEUE_BLOCK_SEND:
+            case trcEVT_QUEUE_BLOCK_RECEIVE:
+            case trcEVT_STREAM_BLOCK_SEND:
+            case trcEVT_STREAM_BLOCK_RECEIVE:
+            case trcEVT_EVENT_GROUP_WAIT_BLOCK:
+            case trcEVT_EVENT_GROUP_SYNC_BLOCK:
+                if (cur && depth == 0)
+                {
+                    cur->wait_pending = 1;
+                    cur->wait_obj = g_obj_index[e->obj];
+                }
+                break;
+
+            case trcEVT_ISR_ENTER:
+                if (depth < TD_ISR_NEST)
+                {
+                    isr_ts[depth] = e->ts;
+                    isr_exc[depth] = e->arg;
+                }
+
+                depth++;
+                break;
+
+            case trcEVT_ISR_EXIT:
+                if (depth == 0) break;      /* 记录从中断中间开始 */
+
+                depth--;
+
+                if (depth < TD_ISR_NEST)
+                {
+                    t = e->ts - isr_ts[depth];
+                    g_isr_count[isr_exc[depth]]++;
+                    g_isr_sum[isr_exc[depth]] += t;
+
+                    if (t > g_isr_max[isr_exc[depth]]) g_isr_max[isr_exc[depth]] = t;
+
+                    if (depth == 0 && cur) isr_in_run += t;     /* 嵌套的中断已经算在外层里 */
+
+                    isr_used[isr_exc[depth]] = 1;
+                    td_json_slice(td_isr_name(isr_exc[depth]), TD_PID_ISRS, isr_exc[depth], isr_ts[depth], e->ts, NULL);
+                }
+                break;
+
+            case trcEVT_QUEUE_CREATE:
+                o->subtype = e->arg;
+                break;
+
+            case trcEVT_STREAM_CREATE:
+                o->subtype = e->arg;
+                break;
+
+            case trcEVT_MALLOC:
+            case trcEVT_FREE:
+                heap += (e->evt == trcEVT_MALLOC) ? (int64_t)e->param : -(int64_t)e->param;
+                td_json_counter("heap", TD_PID_HEAP, e->ts, "bytes", heap);
+                break;
+
+            case trcEVT_DROPPED:
+                g_dropped += e->param;
+                snprintf(args, sizeof(args), "\"lost\":%u", e->param);
+                td_json_instant("dropped", 0, 0, e->ts, args);
+                break;
+
+            default:
+                break;
+        }
+
+        /* 任务轨道以外的事件都标在发生的轨道上, 对象事件再标在对象轨道上 */
+        if (e->evt == trcEVT_TASK_SWITCHED_IN || e->evt == trcEVT_ISR_ENTER || e->evt == trcEVT_ISR_EXIT ||
+            e->evt == trcEVT_DROPPED || e->evt == trcEVT_TICK || (pid == TD_PID_TASKS && tid == 0))
+        {
+            continue;
+        }
+
+        if (o && o != cur)
+        {
+            snprintf(args, sizeof(args), "\"object\":\"%s\",\"arg\":%u,\"param\":%u", o->name, e->arg, e->param);
+        }
+        else
+        {
+            snprintf(args, sizeof(args), "\"arg\":%u,\"param\":%u", e->arg, e->param);
+        }
+
+        td_json_instant(g_evt_name[e->evt], pid, tid, e->ts, args);
+
+        if (o && o->kind != trcOBJ_TASK)
+        {
+            o->used = 1;
+            snprintf(args, sizeof(args), "\"by\":\"%s\",\"arg\":%u,\"param\":%u",
+                     pid == TD_PID_ISRS ? td_isr_name(tid) : cur->name, e->arg, e->param);
+            td_json_instant(g_evt_name[e->evt], TD_PID_OBJECTS, o->id, e->ts, args);
+
+            if (o->kind == trcOBJ_QUEUE && e->evt >= trcEVT_QUEUE_SEND && e->evt <= trcEVT_QUEUE_BLOCK_RECEIVE)
+            {
+                items = e->arg;     /* 调用之前的消息数 */
+
+                if (e->evt == trcEVT_QUEUE_SEND || e->evt == trcEVT_QUEUE_SEND_FROM_ISR) items++;
+                else if (e->evt == trcEVT_QUEUE_RECEIVE || e->evt == trcEVT_QUEUE_RECEIVE_FROM_ISR) items--;
+
+                td_json_counter(o->name, TD_PID_OBJECTS, e->ts, "items", items < 0 ? 0 : items);
+            }
+        }
+    }
+
+    /* 记录结束时关闭还没结束的时间片 */
+    if (g_event_num > 0)
+    {
+        t = g_events[g_event_num - 1].ts;
+
+        if (cur)
+        {
+            td_json_slice("Running", TD_PID_TASKS, cur->id, run_ts, t, NULL);
+            cur->run += t - run_ts - isr_in_run;
+        }
+
+        for (i = 0; i < g_obj_num; i++)
+        {
+            if (g_objs[i].kind == trcOBJ_TASK && &g_objs[i] != cur)
+            {
+                td_task_state(&g_objs[i], t, g_objs[i].state);
+            }
+        }
+    }
+
+    td_json_meta("process_name", TD_PID_TASKS, 0, "Tasks");
+    td_json_meta("process_name", TD_PID_ISRS, 0, "Interrupts");
+    td_json_meta("process_name", TD_PID_OBJECTS, 0, "Objects");
+    td_json_meta("process_name", TD_PID_HEAP, 0, "Heap");
+
+    for (i = 0; i < g_obj_num; i++)
+    {
+        if (g_objs[i].used)
+        {
+            td_json_meta("thread_name", g_objs[i].kind == trcOBJ_TASK ? TD_PID_TASKS : TD_PID_OBJECTS, g_objs[i].id, g_objs[i].name);
+        }
+    }
+
+    for (i = 0; i < 256; i++)
+    {
+        if (isr_used[i]) td_json_meta("thread_name", TD_PID_ISRS, (uint32_t)i, td_isr_name((uint32_t)i));
+    }
+}
+
+/**
+ * @brief       写 CTF 1.8 的 metadata 文件
+ */
+static int td_ctf_metadata(const char *path)
+{
+    FILE *f = fopen(path, "w");
+    uint32_t i;
+
+    if (f == NULL)
+    {
+        perror(path);
+        return 1;
+    }
+
+    fprintf(f, "/* CTF 1.8 */\n\n"
+               "typealias integer { size = 8; align = 8; signed = false; } := uint8_t;\n"
+               "typealias integer { size = 16; align = 8; signed = false; } := uint16_t;\n"
+               "typealias integer { size = 32; align = 8; signed = false; } := uint32_t;\n"
+               "typealias integer { size = 64; align = 8; signed = false; } := uint64_t;\n\n"
+               "trace {\n"
+               "    major = 1;\n"
+               "    minor = 8;\n"
+               "    byte_order = le;\n"
+               "    packet.header := struct {\n"
+               "        uint32_t magic;\n"
+               "        uint32_t stream_id;\n"
+               "    };\n"
+               "};\n\n"
+               "env {\n"
+               "    domain = \"freertos\";\n"
+               "    tick_rate_hz = %u;\n"
+               "    recorder_mode = %u;\n"
+               "    ring_records = %u;\n"
+               "};\n\n"
+               "clock {\n"
+               "    name = cycles;\n"
+               "    description = \"DWT CYCCNT\";\n"
+               "    freq = %u;\n"
+               "};\n\n"
+               "typealias integer { size = 64; align = 8; signed = false; map = clock.cycles.value; } := cycles_t;\n\n"
+               "stream {\n"
+               "    id = 0;\n"
+               "    packet.context := struct {\n"
+               "        cycles_t timestamp_begin;\n"
+               "        cycles_t timestamp_end;\n"
+               "        uint64_t content_size;\n"
+               "        uint64_t packet_size;\n"
+               "    };\n"
+               "    event.header := struct {\n"
+               "        uint8_t id;\n"
+               "        cycles_t timestamp;\n"
+               "    };\n"
+               "};\n\n"
+               "event {\n"
+               "    name = \"symbol\";\n"
+               "    id = 255;\n"
+               "    stream_id = 0;\n"
+               "    fields := struct {\n"
+               "        uint16_t object;\n"
+               "        uint8_t kind;\n"
+               "        uint8_t arg;\n"
+               "        string name;\n"
+               "    };\n"
+               "};\n",
+            g_tick_hz, g_mode, g_ring, g_cpu_hz);
+
+    for (i = 0; i < TD_EVT_NUM; i++)
+    {
+        fprintf(f, "\nevent {\n"
+                   "    name = \"%s\";\n"
+                   "    id = %u;\n"
+                   "    stream_id = 0;\n"
+                   "    fields := struct {\n"
+                   "        uint16_t object;\n"
+                   "        uint8_t arg;\n"
+                   "        uint32_t param;\n"
+                   "    };\n"
+                   "};\n",
+                g_evt_name[g_evt_desc[i].code], g_evt_desc[i].code);
+    }
+
+    fclose(f);
+    return 0;
+}
+
+/**
+ * @brief       小端写入
+ */
+static void td_put(FILE *f, uint64_t v, uint32_t bytes)
+{
+    while (bytes--)
+    {
+        fputc((int)(v & 0xFF), f);
+        v >>= 8;
+    }
+}
+
+/**
+ * @brief       输出 CTF 目录: metadata 和一个只有一个包的 stream 文件
+ * @note        对象名作为 "symbol" 事件放在最前面, 时间戳与第一条事件相同
+ */
+static int td_ctf(const char *dir)
+{
+    char path[512];
+    FILE *f;
+    size_t i;
+    uint64_t bytes;
+    uint64_t t0 = g_event_num ? g_events[0].ts : 0;
+    uint64_t t1 = g_event_num ? g_events[g_event_num - 1].ts : 0;
+
+    if (TD_MKDIR(dir) != 0 && errno != EEXIST)
+    {
+        perror(dir);
+        return 1;
+    }
+
+    snprintf(path, sizeof(path), "%s/metadata", dir);
+
+    if (td_ctf_metadata(path) != 0) return 1;
+
+    snprintf(path, sizeof(path), "%s/stream", dir);
+    f = fopen(path, "wb");
+
+    if (f == NULL)
+    {
+        perror(path);
+        return 1;
+    }
+
+    td_put(f, 0xC1FC1FC1, 4);       /* packet.header */
+    td_put(f, 0, 4);
+    td_put(f, t0, 8);               /* packet.context, 大小最后回填 */
+    td_put(f, t1, 8);
+    td_put(f, 0, 8);
+    td_put(f, 0, 8);
+
+    for (i = 0; i < g_obj_num; i++)
+    {
+        if (g_objs[i].kind == TD_OBJ_NONE) continue;
+
+        td_put(f, 255, 1);
+        td_put(f, t0, 8);
+        td_put(f, g_objs[i].id, 2);
+        td_put(f, g_objs[i].kind, 1);
+        td_put(f, g_objs[i].kind == trcOBJ_TASK ? g_objs[i].prio : g_objs[i].subtype, 1);
+        fwrite(g_objs[i].name, 1, strlen(g_objs[i].name) + 1, f);
+    }
+
+    for (i = 0; i < g_event_num; i++)
+    {
+        if (g_evt_index[g_events[i].evt] == NULL) continue;    /* metadata 里没有的事件 */
+
+        td_put(f, g_events[i].evt, 1);
+        td_put(f, g_events[i].ts < t0 ? t0 : g_events[i].ts, 8);
+        td_put(f, g_events[i].obj, 2);
+        td_put(f, g_events[i].arg, 1);
+        td_put(f, g_events[i].param, 4);
+    }
+
+    bytes = (uint64_t)ftell(f);
+    fseek(f, 24, SEEK_SET);
+    td_put(f, bytes * 8, 8);        /* content_size 和 packet_size, 单位: 位 */
+    td_put(f, bytes * 8, 8);
+    fclose(f);
+    return 0;
+}
+
+/**
+ * @brief       打印统计结果
+ */
+static void td_report(void)
+{
+    uint64_t span = g_event_num ? g_events[g_event_num - 1].ts - g_events[0].ts : 0;
+    size_t i;
+    _td_obj *o;
+    const char *kind;
+
+    printf("%zu events, %.3f ms, cpu %u Hz, tick %u Hz, %s mode, %llu dropped, %u bad frames\n",
+           g_event_num, td_us(span) / 1000, g_cpu_hz, g_tick_hz, g_mode == trcMODE_STREAM ? "stream" : "snapshot",
+           (unsigned long long)g_dropped, g_bad_frames);
+
+    if (g_dropped)
+    {
+        printf("warning: events were dropped, the figures below are approximate\n");
+    }
+
+    printf("\n%-16s %4s %10s %6s %8s %8s %10s %10s %10s\n", "task", "prio", "run(ms)", "cpu%", "switches",
+           "wakeups", "lat avg", "lat max", "blocked(ms)");
+
+    for (i = 0; i < g_obj_num; i++)
+    {
+        o = &g_objs[i];
+
+        if (o->kind != trcOBJ_TASK) continue;
+
+        printf("%-16s %4u %10.3f %6.2f %8u %8u %8.1fus %8.1fus %10.3f\n", o->name, o->prio, td_us(o->run) / 1000,
+               span ? 100.0 * (double)o->run / (double)span : 0.0, o->switches, o->wakeups,
+               o->wakeups ? td_us(o->lat_sum) / o->wakeups : 0.0, td_us(o->lat_max), td_us(o->blocked) / 1000);
+    }
+
+    printf("\n%-16s %8s %12s %10s %10s\n", "isr", "count", "total(us)", "avg(us)", "max(us)");
+
+    for (i = 0; i < 256; i++)
+    {
+        if (g_isr_count[i] == 0) continue;
+
+        printf("%-16s %8u %12.1f %10.2f %10.2f\n", td_isr_name((uint32_t)i), g_isr_count[i], td_us(g_isr_sum[i]),
+               td_us(g_isr_sum[i]) / g_isr_count[i], td_us(g_isr_max[i]));
+    }
+
+    printf("\n%-16s %-9s %8s %12s %10s %10s\n", "object", "kind", "blocks", "blocked(ms)", "avg(us)", "max(us)");
+
+    for (i = 0; i < g_obj_num; i++)
+    {
+        o = &g_objs[i];
+
+        if (o->kind == trcOBJ_TASK || o->kind == TD_OBJ_NONE || (o->blocks == 0 && o->used == 0)) continue;
+
+        kind = g_kind_name[o->kind];
+
+        if (o->kind == trcOBJ_QUEUE && o->subtype < sizeof(g_queue_type) / sizeof(g_queue_type[0]))
+        {
+            kind = g_queue_type[o->subtype];
+        }
+        else if (o->kind == TD_OBJ_STREAM && o->subtype)
+        {
+            kind = "message";
+        }
+
+        printf("%-16s %-9s %8u %12.3f %10.1f %10.1f\n", o->name, kind, o->blocks, td_us(o->block_sum) / 1000,
+               o->blocks ? td_us(o->block_sum) / o->blocks : 0.0, td_us(o->block_max));
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const char *json = NULL;
+    const char *ctf = NULL;
+    const char *input = NULL;
+    uint8_t *buf;
+    long len;
+    FILE *f;
+    int i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) json = argv[++i];
+        else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc) ctf = argv[++i];
+        else if (argv[i][0] != '-' && input == NULL) input = argv[i];
+        else input = NULL, i = argc;
+    }
+
+    if (input == NULL)
+    {
+        fprintf(stderr, "usage: %s [-j trace.json] [-c ctf_dir] capture.bin\n", argv[0]);
+        return 2;
+    }
+
+    f = fopen(input, "rb");
+
+    if (f == NULL)
+    {
+        perror(input);
+        return 2;
+    }
+
+    fseek(f, 0, SEEK_END);
+    len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    buf = malloc(len > 0 ? (size_t)len : 1);
+
+    if (buf == NULL || fread(buf, 1, (size_t)len, f) != (size_t)len)
+    {
+        fprintf(stderr, "%s: read failed\n", input);
+        return 2;
+    }
+
+    fclose(f);
+
+    memset(g_obj_index, 0xFF, sizeof(g_obj_index));
+    td_evt_init();
+    td_parse(buf, (size_t)len);
+    free(buf);
+
+    if (g_headers == 0)
+    {
+        g_cpu_hz = 72000000;    /* 没有收到头帧, 按默认主频 */
+        fprintf(stderr, "warning: no header frame, assuming %u Hz\n", g_cpu_hz);
+    }
+
+    if (g_event_num == 0)
+    {
+        fprintf(stderr, "%s: no trace events found\n", input);
+        return 1;
+    }
+
+    g_ts0 = g_events[0].ts;
+
+    if (json)
+    {
+        g_json = fopen(json, "w");
+
+        if (g_json == NULL)
+        {
+            perror(json);
+            return 2;
+        }
+
+        fprintf(g_json, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+    }
+
+    td_replay();
+
+    if (g_json)
+    {
+        fprintf(g_json, "\n]}\n");
+        fclose(g_json);
+    }
+
+    if (ctf && td_ctf(ctf) != 0)
+    {
+        return 2;
+    }
+
+    td_report();
+    return 0;
+}